@@ -1,3 +1,6 @@
+#include "../../normal/cpp_apportionment_methods.hpp"
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 
 class cpp_gen_main
@@ -113,8 +116,39 @@ private:
         }
     }
 
-public:
-    static int main_function()
+    // https://en.cppreference.com/w/cpp/io/manip/fixed
+    // Each element is printed as a hexadecimal floating literal, so it is read back exactly.
+    template <typename D>
+    static void print_multiplier_table(unsigned long max_num_reps)
+    {
+        std::cout << "template <>";
+        std::cout << '\n';
+        std::cout << "class cpp_gen_multiplier_table<" << D::name() << "> final";
+        std::cout << '\n';
+        std::cout << "{";
+        std::cout << '\n';
+        std::cout << "public:";
+        std::cout << '\n';
+        std::cout << "    static constexpr uint32_t MAX_NUM_REPS = " << max_num_reps << ";";
+        std::cout << '\n';
+        std::cout << "    static constexpr double VALUES[MAX_NUM_REPS + 1] = {";
+        std::cout << '\n';
+        std::cout << "        0.0,";
+        std::cout << '\n';
+        for (unsigned long n = 1; n <= max_num_reps; n++)
+        {
+            std::cout << "        " << std::hexfloat << static_cast<double>(D::multiplier(static_cast<uint32_t>(n))) << std::defaultfloat << ",";
+            std::cout << '\n';
+        }
+        std::cout << "    };";
+        std::cout << '\n';
+        std::cout << "};";
+        std::cout << '\n';
+        std::cout << "";
+        std::cout << '\n';
+    }
+
+    static int print_trie()
     {
         std::cout << "#ifndef SANDBOX_GEN_TRIE";
         std::cout << '\n';
@@ -148,6 +182,96 @@ public:
         std::cout << '\n';
         return 0;
     }
+
+    static int print_multipliers(unsigned long max_num_reps)
+    {
+        std::cout << "#ifndef SANDBOX_GEN_MULTIPLIERS";
+        std::cout << '\n';
+        std::cout << "#define SANDBOX_GEN_MULTIPLIERS";
+        std::cout << '\n';
+        std::cout << "";
+        std::cout << '\n';
+        std::cout << "// This file was generated from one or more other files.";
+        std::cout << '\n';
+        std::cout << "// Hence, changes made to this file will be destroyed if";
+        std::cout << '\n';
+        std::cout << "// the generation program for this file is run again.";
+        std::cout << '\n';
+        std::cout << "";
+        std::cout << '\n';
+        std::cout << "#include <cstdint>";
+        std::cout << '\n';
+        std::cout << "";
+        std::cout << '\n';
+        std::cout << "// See cpp_apportionment_methods.hpp.";
+        std::cout << '\n';
+        std::cout << "class huntington_hill;";
+        std::cout << '\n';
+        std::cout << "class webster;";
+        std::cout << '\n';
+        std::cout << "class jefferson;";
+        std::cout << '\n';
+        std::cout << "class adams;";
+        std::cout << '\n';
+        std::cout << "class dean;";
+        std::cout << '\n';
+        std::cout << "";
+        std::cout << '\n';
+        std::cout << "// Element n of VALUES is D::multiplier(n) rounded to a double, for each n";
+        std::cout << '\n';
+        std::cout << "// from 1 to MAX_NUM_REPS. Element 0 is unused. A divisor method without";
+        std::cout << '\n';
+        std::cout << "// a table of its own has MAX_NUM_REPS == 0.";
+        std::cout << '\n';
+        std::cout << "template <typename D>";
+        std::cout << '\n';
+        std::cout << "class cpp_gen_multiplier_table final";
+        std::cout << '\n';
+        std::cout << "{";
+        std::cout << '\n';
+        std::cout << "public:";
+        std::cout << '\n';
+        std::cout << "    static constexpr uint32_t MAX_NUM_REPS = 0;";
+        std::cout << '\n';
+        std::cout << "    static constexpr double VALUES[MAX_NUM_REPS + 1] = {0.0};";
+        std::cout << '\n';
+        std::cout << "};";
+        std::cout << '\n';
+        std::cout << "";
+        std::cout << '\n';
+        print_multiplier_table<huntington_hill>(max_num_reps);
+        print_multiplier_table<webster>(max_num_reps);
+        print_multiplier_table<jefferson>(max_num_reps);
+        print_multiplier_table<adams>(max_num_reps);
+        print_multiplier_table<dean>(max_num_reps);
+        std::cout << "#endif // SANDBOX_GEN_MULTIPLIERS";
+        std::cout << '\n';
+        return 0;
+    }
+
+public:
+    // With no arguments, print cpp_gen_trie.hpp. With the arguments "multipliers" and a
+    // number of seats, print cpp_gen_multipliers.hpp with tables up to that many seats.
+    static int main_function(int argc, char *argv[])
+    {
+        if (argc == 1)
+        {
+            return print_trie();
+        }
+
+        if (argc == 3 && strcmp(argv[1], "multipliers") == 0)
+        {
+            char *end = nullptr;
+            const unsigned long max_num_reps = strtoul(argv[2], &end, 10);
+            if (*argv[2] != '\0' && *end == '\0' && max_num_reps >= 1 && max_num_reps <= 1000000)
+            {
+                return print_multipliers(max_num_reps);
+            }
+        }
+
+        std::cerr << "Usage: " << argv[0] << " [multipliers MAX_NUM_REPS]\n";
+        return 1;
+    }
 };
 
-int main() { return cpp_gen_main::main_function(); }
+int main(int argc, char *argv[]) { return cpp_gen_main::main_function(argc, argv); }
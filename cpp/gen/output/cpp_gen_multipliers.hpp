@@ -0,0 +1,5198 @@
+#ifndef SANDBOX_GEN_MULTIPLIERS
+#define SANDBOX_GEN_MULTIPLIERS
+
+// This file was generated from one or more other files.
+// Hence, changes made to this file will be destroyed if
+// the generation program for this file is run again.
+
+#include <cstdint>
+
+// See cpp_apportionment_methods.hpp.
+class huntington_hill;
+class webster;
+class jefferson;
+class adams;
+class dean;
+
+// Element n of VALUES is D::multiplier(n) rounded to a double, for each n
+// from 1 to MAX_NUM_REPS. Element 0 is unused. A divisor method without
+// a table of its own has MAX_NUM_REPS == 0.
+template <typename D>
+class cpp_gen_multiplier_table final
+{
+public:
+    static constexpr uint32_t MAX_NUM_REPS = 0;
+    static constexpr double VALUES[MAX_NUM_REPS + 1] = {0.0};
+};
+
+template <>
+class cpp_gen_multiplier_table<huntington_hill> final
+{
+public:
+    static constexpr uint32_t MAX_NUM_REPS = 1024;
+    static constexpr double VALUES[MAX_NUM_REPS + 1] = {
+        0.0,
+        0x1.6a09e667f3bcdp-1,
+        0x1.a20bd700c2c3ep-2,
+        0x1.279a74590331cp-2,
+        0x1.c9f25c5bfedd9p-3,
+        0x1.75e9746a0b098p-3,
+        0x1.3c03650e00e03p-3,
+        0x1.11acee560242ap-3,
+        0x1.e2b7dddfefa66p-4,
+        0x1.afc19d8606169p-4,
+        0x1.8689cc7e07e7dp-4,
+        0x1.6482d37a5a3d2p-4,
+        0x1.47f144fe17f9fp-4,
+        0x1.2f9d9fd52fd5p-4,
+        0x1.1aa69e4f2777fp-4,
+        0x1.08654a2d4f6dbp-4,
+        0x1.f0b6848d2af1cp-5,
+        0x1.d44e33454e16cp-5,
+        0x1.baf8fe1a5149ap-5,
+        0x1.a43da0adc6899p-5,
+        0x1.8fba8a1bf6f96p-5,
+        0x1.7d205754f8246p-5,
+        0x1.6c2dc73154e5ep-5,
+        0x1.5cacb7802f342p-5,
+        0x1.4e6fdf33cf032p-5,
+        0x1.415111aa791bp-5,
+        0x1.352fe6cc70c0dp-5,
+        0x1.29f0ae4a7bd7bp-5,
+        0x1.1f7b9b8275ce1p-5,
+        0x1.15bc1c9442957p-5,
+        0x1.0ca052ba80977p-5,
+        0x1.0418a4806de7dp-5,
+        0x1.f82ec882c0f9bp-6,
+        0x1.e9210d67044a5p-6,
+        0x1.daf2cc775852ap-6,
+        0x1.cd912108d1d79p-6,
+        0x1.c0eb38bfb39ebp-6,
+        0x1.b4f20ccfd732fp-6,
+        0x1.a99826457b7abp-6,
+        0x1.9ed16b6197ff5p-6,
+        0x1.9492f477d78e3p-6,
+        0x1.8ad2e709e304ap-6,
+        0x1.81885618bd484p-6,
+        0x1.78ab26d563528p-6,
+        0x1.7033f90087124p-6,
+        0x1.681c126839d66p-6,
+        0x1.605d4d0b58481p-6,
+        0x1.58f2077eca743p-6,
+        0x1.51d517412838ep-6,
+        0x1.4b01bcb6d0379p-6,
+        0x1.44739893955dp-6,
+        0x1.3e26a2804cc95p-6,
+        0x1.381720d219fb2p-6,
+        0x1.3241a12fa4b02p-6,
+        0x1.2ca2f205a6e91p-6,
+        0x1.27381cb0a9f33p-6,
+        0x1.21fe60457df9cp-6,
+        0x1.1cf32ce517b72p-6,
+        0x1.18141f8b24ce6p-6,
+        0x1.135efe48e5d9fp-6,
+        0x1.0ed1b4dfc63eap-6,
+        0x1.0a6a51b0cb3ffp-6,
+        0x1.062702f7591e1p-6,
+        0x1.02061446ffa9ap-6,
+        0x1.fc0bd88a0f1d9p-7,
+        0x1.f44a152eba5c9p-7,
+        0x1.ecc40c0675386p-7,
+        0x1.e577156d39c87p-7,
+        0x1.de60b170499cfp-7,
+        0x1.d77e84f308999p-7,
+        0x1.d0ce571214606p-7,
+        0x1.ca4e0ebe8024cp-7,
+        0x1.c3fbb08bc8f1bp-7,
+        0x1.bdd55cabad887p-7,
+        0x1.b7d94d1399d52p-7,
+        0x1.b205d3c7caf7bp-7,
+        0x1.ac595948b81ddp-7,
+        0x1.a6d25b1fa7a74p-7,
+        0x1.a16f6a87a8d82p-7,
+        0x1.9c2f2b3071fddp-7,
+        0x1.97105218e28c1p-7,
+        0x1.9211a47f21502p-7,
+        0x1.8d31f6e481439p-7,
+        0x1.88702c238485dp-7,
+        0x1.83cb34967d33bp-7,
+        0x1.7f420d4d6fcbp-7,
+        0x1.7ad3bf51fb01ap-7,
+        0x1.767f5ef825dcep-7,
+        0x1.72440b3b0ecf4p-7,
+        0x1.6e20ed248dfb8p-7,
+        0x1.6a15373ef1c56p-7,
+        0x1.662025100fccep-7,
+        0x1.6240fa9cf5908p-7,
+        0x1.5e7703f593696p-7,
+        0x1.5ac194c7ca946p-7,
+        0x1.572007f953a73p-7,
+        0x1.5391bf47fe4fcp-7,
+        0x1.501622efd5aaap-7,
+        0x1.4caca156bdf7ap-7,
+        0x1.4954aebd29139p-7,
+        0x1.460dc4f386f76p-7,
+        0x1.42d763141ea35p-7,
+        0x1.3fb10d410265p-7,
+        0x1.3c9a4c65d85b5p-7,
+        0x1.3992adfd358bfp-7,
+        0x1.3699c3d94edc3p-7,
+        0x1.33af23efc7ca9p-7,
+        0x1.30d268286af62p-7,
+        0x1.2e032e2e9c54ep-7,
+        0x1.2b411745587e6p-7,
+        0x1.288bc81d97a9dp-7,
+        0x1.25e2e8aeedf93p-7,
+        0x1.234624124562dp-7,
+        0x1.20b5285e90123p-7,
+        0x1.1e2fa6875466fp-7,
+        0x1.1bb5523cf5ddbp-7,
+        0x1.1945e1cea026ep-7,
+        0x1.16e10e0dbb806p-7,
+        0x1.14869232d317ep-7,
+        0x1.12362bc3d7c76p-7,
+        0x1.0fef9a7baaefbp-7,
+        0x1.0db2a032de88fp-7,
+        0x1.0b7f00c998bdcp-7,
+        0x1.095482128a89cp-7,
+        0x1.0732ebbee9e5ep-7,
+        0x1.051a074b6107p-7,
+        0x1.03099fede51fap-7,
+        0x1.0101828467ee9p-7,
+        0x1.fe02fb08b05cbp-8,
+        0x1.fa12c1d5cb6fap-8,
+        0x1.f631fc5bfdadfp-8,
+        0x1.f260505bf9eeap-8,
+        0x1.ee9d664feec67p-8,
+        0x1.eae8e95166c3dp-8,
+        0x1.e74287005304ap-8,
+        0x1.e3a9ef6b30bdp-8,
+        0x1.e01ed4f83b2bap-8,
+        0x1.dca0ec4f9c51bp-8,
+        0x1.d92fec468f8dfp-8,
+        0x1.d5cb8dcb69f68p-8,
+        0x1.d2738bd27d00ap-8,
+        0x1.cf27a343c8a8p-8,
+        0x1.cbe792e972e4dp-8,
+        0x1.c8b31b5efad12p-8,
+        0x1.c589ff011e648p-8,
+        0x1.c26c01de6a2f2p-8,
+        0x1.bf58e9a86af56p-8,
+        0x1.bc507da5797b9p-8,
+        0x1.b95286a3193fp-8,
+        0x1.b65ecee8e3395p-8,
+        0x1.b375222bf62bfp-8,
+        0x1.b0954d82e6478p-8,
+        0x1.adbf1f5a2656ap-8,
+        0x1.aaf26768e4e15p-8,
+        0x1.a82ef6a658088p-8,
+        0x1.a5749f3f731c8p-8,
+        0x1.a2c3348d0134ep-8,
+        0x1.a01a8b0a204bap-8,
+        0x1.9d7a784b18992p-8,
+        0x1.9ae2d2f48c23cp-8,
+        0x1.985372b2faaa8p-8,
+        0x1.95cc30329642bp-8,
+        0x1.934ce517652fp-8,
+        0x1.90d56bf5ada1p-8,
+        0x1.8e65a04aa83fap-8,
+        0x1.8bfd5e757675bp-8,
+        0x1.899c83b059ad3p-8,
+        0x1.8742ee0a28c19p-8,
+        0x1.84f07c600113fp-8,
+        0x1.82a50e5730c92p-8,
+        0x1.8060845757da8p-8,
+        0x1.7e22bf84bdbb4p-8,
+        0x1.7beba1bad970fp-8,
+        0x1.79bb0d870a15cp-8,
+        0x1.7790e6237dd2fp-8,
+        0x1.756d0f724579fp-8,
+        0x1.734f6df892f5dp-8,
+        0x1.7137e6da20e5ep-8,
+        0x1.6f265fd4c1c3p-8,
+        0x1.6d1abf3c15058p-8,
+        0x1.6b14ebf560d24p-8,
+        0x1.6914cd738ec67p-8,
+        0x1.671a4bb34a885p-8,
+        0x1.65254f3740d4cp-8,
+        0x1.6335c1047dcc4p-8,
+        0x1.614b8a9ee952bp-8,
+        0x1.5f669605e0608p-8,
+        0x1.5d86cdb0ea30fp-8,
+        0x1.5bac1c8c88437p-8,
+        0x1.59d66df720345p-8,
+        0x1.5805adbdfe77cp-8,
+        0x1.5639c81a710f6p-8,
+        0x1.5472a9aef95b4p-8,
+        0x1.52b03f84942f1p-8,
+        0x1.50f2770817606p-8,
+        0x1.4f393e07a406dp-8,
+        0x1.4d8482b02cb36p-8,
+        0x1.4bd4338b0ee8cp-8,
+        0x1.4a283f7bbf26ap-8,
+        0x1.488095bd86e22p-8,
+        0x1.46dd25e153ca2p-8,
+        0x1.453ddfcb97bdfp-8,
+        0x1.43a2b3b238e32p-8,
+        0x1.420b921a914bep-8,
+        0x1.40786bd77da57p-8,
+        0x1.3ee932077a6c1p-8,
+        0x1.3d5dd612cf269p-8,
+        0x1.3bd649a9c72f2p-8,
+        0x1.3a527ec2f7964p-8,
+        0x1.38d2679991af6p-8,
+        0x1.3755f6abc1dacp-8,
+        0x1.35dd1eb91a25bp-8,
+        0x1.3467d2c1085cdp-8,
+        0x1.32f6060157308p-8,
+        0x1.3187abf4ba0f3p-8,
+        0x1.301cb851635bap-8,
+        0x1.2eb51f07a4aadp-8,
+        0x1.2d50d44098b54p-8,
+        0x1.2befcc5cd6adbp-8,
+        0x1.2a91fbf32eaedp-8,
+        0x1.293757cf6ef7ep-8,
+        0x1.27dfd4f131afbp-8,
+        0x1.268b688ab2e97p-8,
+        0x1.253a07ffaeaa3p-8,
+        0x1.23eba8e446ad7p-8,
+        0x1.22a040fbefad3p-8,
+        0x1.2157c63865f02p-8,
+        0x1.20122eb8a8e5fp-8,
+        0x1.1ecf70c7fd9a3p-8,
+        0x1.1d8f82dcf7c7fp-8,
+        0x1.1c525b98895abp-8,
+        0x1.1b17f1c5182b6p-8,
+        0x1.19e03c5599c92p-8,
+        0x1.18ab3264b51e8p-8,
+        0x1.1778cb33e9c86p-8,
+        0x1.1648fe2abcf0fp-8,
+        0x1.151bc2d5eb868p-8,
+        0x1.13f110e6a1a55p-8,
+        0x1.12c8e031b70cfp-8,
+        0x1.11a328aef07bep-8,
+        0x1.107fe27845ccep-8,
+        0x1.0f5f05c92cb24p-8,
+        0x1.0e408afde7eddp-8,
+        0x1.0d246a92dae37p-8,
+        0x1.0c0a9d23e1674p-8,
+        0x1.0af31b6baba82p-8,
+        0x1.09ddde431e186p-8,
+        0x1.08cadea0b5384p-8,
+        0x1.07ba1597ed262p-8,
+        0x1.06ab7c58acd8ap-8,
+        0x1.059f0c2eb4e97p-8,
+        0x1.0494be8111d7p-8,
+        0x1.038c8cd191a41p-8,
+        0x1.028670bc3cbe1p-8,
+        0x1.018263f6d212dp-8,
+        0x1.00806050463f4p-8,
+        0x1.ff00bf608b827p-9,
+        0x1.fd04b82d74311p-9,
+        0x1.fb0c9f36a3826p-9,
+        0x1.f91868da15e97p-9,
+        0x1.f72809a3823d1p-9,
+        0x1.f53b764b79e25p-9,
+        0x1.f352a3b68e14ap-9,
+        0x1.f16d86f47a295p-9,
+        0x1.ef8c153f52abdp-9,
+        0x1.edae43fab932cp-9,
+        0x1.ebd408b314cd8p-9,
+        0x1.e9fd591cceecp-9,
+        0x1.e82a2b1394a2ap-9,
+        0x1.e65a74999c2ccp-9,
+        0x1.e48e2bd6ee92dp-9,
+        0x1.e2c54718b557cp-9,
+        0x1.e0ffbcd08c13ap-9,
+        0x1.df3d8393d5e1cp-9,
+        0x1.dd7e921b16894p-9,
+        0x1.dbc2df414f47dp-9,
+        0x1.da0a62035f26fp-9,
+        0x1.d855117f66c56p-9,
+        0x1.d6a2e4f42f7ddp-9,
+        0x1.d4f3d3c095d58p-9,
+        0x1.d347d562f71e2p-9,
+        0x1.d19ee178a2366p-9,
+        0x1.cff8efbd4b552p-9,
+        0x1.ce55f80a82cc8p-9,
+        0x1.ccb5f2572eb18p-9,
+        0x1.cb18d6b707575p-9,
+        0x1.c97e9d5a168a7p-9,
+        0x1.c7e73e8c397cfp-9,
+        0x1.c652b2b4a5515p-9,
+        0x1.c4c0f2556e34ap-9,
+        0x1.c331f60b10f7cp-9,
+        0x1.c1a5b68bff18bp-9,
+        0x1.c01c2ca82d2cbp-9,
+        0x1.be955148a39cep-9,
+        0x1.bd111d6f11a74p-9,
+        0x1.bb8f8a3562961p-9,
+        0x1.ba1090cd5520cp-9,
+        0x1.b8942a8014e87p-9,
+        0x1.b71a50add604dp-9,
+        0x1.b5a2fccd72931p-9,
+        0x1.b42e286c0a3d3p-9,
+        0x1.b2bbcd2ca3abcp-9,
+        0x1.b14be4c7cfd8ap-9,
+        0x1.afde690b4f36p-9,
+        0x1.ae7353d9b8a05p-9,
+        0x1.ad0a9f2a220f6p-9,
+        0x1.aba44507cafdap-9,
+        0x1.aa403f91c87a8p-9,
+        0x1.a8de88fab2decp-9,
+        0x1.a77f1b8855197p-9,
+        0x1.a621f1935d8bbp-9,
+        0x1.a4c70587106b6p-9,
+        0x1.a36e51e0fba28p-9,
+        0x1.a217d130ac243p-9,
+        0x1.a0c37e1764aep-9,
+        0x1.9f715347d5ee2p-9,
+        0x1.9e214b85d805ep-9,
+        0x1.9cd361a62561cp-9,
+        0x1.9b87908e16de7p-9,
+        0x1.9a3dd33361346p-9,
+        0x1.98f6249bd3a27p-9,
+        0x1.97b07fdd17d09p-9,
+        0x1.966ce01c72e3cp-9,
+        0x1.952b408e87bd3p-9,
+        0x1.93eb9c771a5cfp-9,
+        0x1.92adef28d463bp-9,
+        0x1.917234050aab7p-9,
+        0x1.9038667b83f27p-9,
+        0x1.8f00820a40929p-9,
+        0x1.8dca823d433eap-9,
+        0x1.8c9662ae5ac09p-9,
+        0x1.8b641f04ecb31p-9,
+        0x1.8a33b2f5c131bp-9,
+        0x1.89051a42cf79p-9,
+        0x1.87d850bb0b73ep-9,
+        0x1.86ad523a342e8p-9,
+        0x1.85841aa8a32c8p-9,
+        0x1.845ca5fb1c9bfp-9,
+        0x1.8336f032a061cp-9,
+        0x1.8212f55c3bfap-9,
+        0x1.80f0b190dd28dp-9,
+        0x1.7fd020f52576bp-9,
+        0x1.7eb13fb93e747p-9,
+        0x1.7d940a18aec3p-9,
+        0x1.7c787c5a2fdabp-9,
+        0x1.7b5e92cf848dep-9,
+        0x1.7a4649d550443p-9,
+        0x1.792f9dd2eee93p-9,
+        0x1.781a8b3a4d8c6p-9,
+        0x1.77070e87c3ad9p-9,
+        0x1.75f52441ed338p-9,
+        0x1.74e4c8f985082p-9,
+        0x1.73d5f94940582p-9,
+        0x1.72c8b1d5aa722p-9,
+        0x1.71bcef4d01425p-9,
+        0x1.70b2ae6712676p-9,
+        0x1.6fa9ebe518de9p-9,
+        0x1.6ea2a4919b425p-9,
+        0x1.6d9cd5404a99fp-9,
+        0x1.6c987acde1b7bp-9,
+        0x1.6b95922005208p-9,
+        0x1.6a941825237d9p-9,
+        0x1.699409d456929p-9,
+        0x1.6895642d44b7cp-9,
+        0x1.6798243802d4p-9,
+        0x1.669c4704f6d5bp-9,
+        0x1.65a1c9acbaa6ep-9,
+        0x1.64a8a94fff9b2p-9,
+        0x1.63b0e31772544p-9,
+        0x1.62ba74339f1bfp-9,
+        0x1.61c559dcd6b03p-9,
+        0x1.60d19153138p-9,
+        0x1.5fdf17dddf568p-9,
+        0x1.5eedeacc39724p-9,
+        0x1.5dfe07747d071p-9,
+        0x1.5d0f6b344827dp-9,
+        0x1.5c2213706317p-9,
+        0x1.5b35fd94a7fb1p-9,
+        0x1.5a4b2713eaf61p-9,
+        0x1.59618d67e29dcp-9,
+        0x1.58792e1110d28p-9,
+        0x1.57920696abf3ap-9,
+        0x1.56ac1486886f9p-9,
+        0x1.55c7557502ad5p-9,
+        0x1.54e3c6fce94e8p-9,
+        0x1.540166bf67c81p-9,
+        0x1.53203263f14fdp-9,
+        0x1.524027982c1dcp-9,
+        0x1.5161440fdcff4p-9,
+        0x1.50838584d33abp-9,
+        0x1.4fa6e9b6d4c2ap-9,
+        0x1.4ecb6e6b8ab6p-9,
+        0x1.4df1116e6e2d4p-9,
+        0x1.4d17d090b552p-9,
+        0x1.4c3fa9a940c08p-9,
+        0x1.4b689a9489317p-9,
+        0x1.4a92a1348d6a9p-9,
+        0x1.49bdbb70c0756p-9,
+        0x1.48e9e735f81a2p-9,
+        0x1.481722765b9e7p-9,
+        0x1.47456b2952c5dp-9,
+        0x1.4674bf4b75136p-9,
+        0x1.45a51cde794b7p-9,
+        0x1.44d681e92533ep-9,
+        0x1.4408ec773d924p-9,
+        0x1.433c5a9976664p-9,
+        0x1.4270ca6563605p-9,
+        0x1.41a639f568926p-9,
+        0x1.40dca768ab5a3p-9,
+        0x1.401410e303846p-9,
+        0x1.3f4c748ceca71p-9,
+        0x1.3e85d09377b34p-9,
+        0x1.3dc023283cbbcp-9,
+        0x1.3cfb6a814cf0fp-9,
+        0x1.3c37a4d924d0cp-9,
+        0x1.3b74d06e9e899p-9,
+        0x1.3ab2eb84e48f1p-9,
+        0x1.39f1f4636460cp-9,
+        0x1.3931e955c1812p-9,
+        0x1.3872c8abc89cp-9,
+        0x1.37b490b962dc8p-9,
+        0x1.36f73fd68970cp-9,
+        0x1.363ad45f393aep-9,
+        0x1.357f4cb366af2p-9,
+        0x1.34c4a736f1dd4p-9,
+        0x1.340ae2519aa5cp-9,
+        0x1.3351fc6ef5192p-9,
+        0x1.3299f3fe5e00ep-9,
+        0x1.31e2c772ef92p-9,
+        0x1.312c754376478p-9,
+        0x1.3076fbea65e5p-9,
+        0x1.2fc259e5cea01p-9,
+        0x1.2f0e8db752708p-9,
+        0x1.2e5b95e41a862p-9,
+        0x1.2da970f4cce4p-9,
+        0x1.2cf81d7582205p-9,
+        0x1.2c4799f5bb485p-9,
+        0x1.2b97e50857e77p-9,
+        0x1.2ae8fd438c322p-9,
+        0x1.2a3ae140d7522p-9,
+        0x1.298d8f9cf9d53p-9,
+        0x1.28e106f7ec3cdp-9,
+        0x1.283545f4d5af1p-9,
+        0x1.278a4b3a02c6fp-9,
+        0x1.26e01570dc856p-9,
+        0x1.2636a345df60fp-9,
+        0x1.258df36892742p-9,
+        0x1.24e6048b7eca8p-9,
+        0x1.243ed56426cb2p-9,
+        0x1.239864aafdc08p-9,
+        0x1.22f2b11b5f7dap-9,
+        0x1.224db973881edp-9,
+        0x1.21a97c748be75p-9,
+        0x1.2105f8e24f39fp-9,
+        0x1.20632d837eadp-9,
+        0x1.1fc119218738fp-9,
+        0x1.1f1fba888e814p-9,
+        0x1.1e7f10876b377p-9,
+        0x1.1ddf19ef9d974p-9,
+        0x1.1d3fd59547fc1p-9,
+        0x1.1ca1424f278f6p-9,
+        0x1.1c035ef68d0f4p-9,
+        0x1.1b662a6755ac9p-9,
+        0x1.1ac9a37fe401cp-9,
+        0x1.1a2dc921191fep-9,
+        0x1.19929a2e4db32p-9,
+        0x1.18f8158d4b3dcp-9,
+        0x1.185e3a2645697p-9,
+        0x1.17c506e3d36e4p-9,
+        0x1.172c7ab2e98f4p-9,
+        0x1.16949482d2acep-9,
+        0x1.15fd534529eb7p-9,
+        0x1.1566b5edd46ecp-9,
+        0x1.14d0bb72fb2a3p-9,
+        0x1.143b62cd04c49p-9,
+        0x1.13a6aaf68f8f7p-9,
+        0x1.131292ec6b92dp-9,
+        0x1.127f19ad94aacp-9,
+        0x1.11ec3e3b2cb91p-9,
+        0x1.1159ff9875e8ap-9,
+        0x1.10c85ccacd03cp-9,
+        0x1.103754d9a3dc1p-9,
+        0x1.0fa6e6ce7bc4dp-9,
+        0x1.0f1711b4e01dfp-9,
+        0x1.0e87d49a60f15p-9,
+        0x1.0df92e8e8da01p-9,
+        0x1.0d6b1ea2efa1bp-9,
+        0x1.0cdda3eb05531p-9,
+        0x1.0c50bd7c3cd5dp-9,
+        0x1.0bc46a6def001p-9,
+        0x1.0b38a9d95a5c1p-9,
+        0x1.0aad7ad99e36ep-9,
+        0x1.0a22dc8bb5bf3p-9,
+        0x1.0998ce0e7333p-9,
+        0x1.090f4e827b1c1p-9,
+        0x1.08865d0a3f9bap-9,
+        0x1.07fdf8c9fbc42p-9,
+        0x1.077620e7af01ep-9,
+        0x1.06eed48b18912p-9,
+        0x1.066812ddb302ep-9,
+        0x1.05e1db0aafcf1p-9,
+        0x1.055c2c3ef2f4p-9,
+        0x1.04d705a90ea3ep-9,
+        0x1.045266793efeep-9,
+        0x1.03ce4de165dacp-9,
+        0x1.034abb150696ap-9,
+        0x1.02c7ad4941fc4p-9,
+        0x1.024523b4d22cep-9,
+        0x1.01c31d90069b3p-9,
+        0x1.01419a14c010ep-9,
+        0x1.00c0987e6cc04p-9,
+        0x1.0040180a0462p-9,
+        0x1.ff802fec08bc1p-10,
+        0x1.fe812f04d800ep-10,
+        0x1.fd832be171724p-10,
+        0x1.fc862507c4ce5p-10,
+        0x1.fb8a1900af5dcp-10,
+        0x1.fa8f0657f4b5bp-10,
+        0x1.f994eb9c378f5p-10,
+        0x1.f89bc75ef2b4cp-10,
+        0x1.f7a3983472023p-10,
+        0x1.f6ac5cb3cb7c7p-10,
+        0x1.f5b61376d87b3p-10,
+        0x1.f4c0bb1a2ee7ap-10,
+        0x1.f3cc523d1a8eap-10,
+        0x1.f2d8d7819686dp-10,
+        0x1.f1e6498c46a96p-10,
+        0x1.f0f4a704711e8p-10,
+        0x1.f003ee93f7fbfp-10,
+        0x1.ef141ee752f68p-10,
+        0x1.ee2536ad89259p-10,
+        0x1.ed3734982ad9p-10,
+        0x1.ec4a175b4b805p-10,
+        0x1.eb5dddad7ba3ap-10,
+        0x1.ea728647c2ee4p-10,
+        0x1.e9880fe59a49dp-10,
+        0x1.e89e7944e60abp-10,
+        0x1.e7b5c125f02ccp-10,
+        0x1.e6cde64b62a0ep-10,
+        0x1.e5e6e77a41aa9p-10,
+        0x1.e500c379e64d6p-10,
+        0x1.e41b7913f8ca5p-10,
+        0x1.e33707146b2cfp-10,
+        0x1.e2536c4973e7ep-10,
+        0x1.e170a78388801p-10,
+        0x1.e08eb7955847ap-10,
+        0x1.dfad9b53c7274p-10,
+        0x1.decd5195e8764p-10,
+        0x1.ddedd934f9e0dp-10,
+        0x1.dd0f310c5e5d3p-10,
+        0x1.dc3157f9992e1p-10,
+        0x1.db544cdc48f3ap-10,
+        0x1.da780e9622c9ap-10,
+        0x1.d99c9c0aed73cp-10,
+        0x1.d8c1f4207c96ap-10,
+        0x1.d7e815beabfeap-10,
+        0x1.d70effcf5af34p-10,
+        0x1.d636b13e6797cp-10,
+        0x1.d55f28f9aa585p-10,
+        0x1.d48865f0f163bp-10,
+        0x1.d3b26715fc317p-10,
+        0x1.d2dd2b5c77145p-10,
+        0x1.d208b1b9f6d89p-10,
+        0x1.d134f925f46e9p-10,
+        0x1.d0620099c8a0fp-10,
+        0x1.cf8fc710a7d69p-10,
+        0x1.cebe4b879ddf8p-10,
+        0x1.cded8cfd89ce6p-10,
+        0x1.cd1d8a7319db9p-10,
+        0x1.cc4e42eac755p-10,
+        0x1.cb7fb568d2979p-10,
+        0x1.cab1e0f33f143p-10,
+        0x1.c9e4c491cf5f1p-10,
+        0x1.c9185f4e014a1p-10,
+        0x1.c84cb0330a08dp-10,
+        0x1.c781b64dd25f9p-10,
+        0x1.c6b770acf2dc5p-10,
+        0x1.c5edde60b0195p-10,
+        0x1.c524fe7af70a8p-10,
+        0x1.c45cd00f5953bp-10,
+        0x1.c395523309a94p-10,
+        0x1.c2ce83fcd83a2p-10,
+        0x1.c20864852f22fp-10,
+        0x1.c142f2e60eeafp-10,
+        0x1.c07e2e3b0b0a2p-10,
+        0x1.bfba15a146781p-10,
+        0x1.bef6a83770441p-10,
+        0x1.be33e51dc0367p-10,
+        0x1.bd71cb75f37a1p-10,
+        0x1.bcb05a63494efp-10,
+        0x1.bbef910a7fc57p-10,
+        0x1.bb2f6e91d081cp-10,
+        0x1.ba6ff220ed87fp-10,
+        0x1.b9b11ae0fe1p-10,
+        0x1.b8f2e7fc9b62ep-10,
+        0x1.b835589fcdbe5p-10,
+        0x1.b7786bf80941fp-10,
+        0x1.b6bc21342ae38p-10,
+        0x1.b6007784756b4p-10,
+        0x1.b5456e1a8e77ep-10,
+        0x1.b48b04297b8a3p-10,
+        0x1.b3d138e59f185p-10,
+        0x1.b3180b84b5a84p-10,
+        0x1.b25f7b3dd2f2p-10,
+        0x1.b1a787495f08dp-10,
+        0x1.b0f02ee1138bcp-10,
+        0x1.b039713ff8dd2p-10,
+        0x1.af834da263615p-10,
+        0x1.aecdc345f0c47p-10,
+        0x1.ae18d16985469p-10,
+        0x1.ad64774d490f4p-10,
+        0x1.acb0b432a5878p-10,
+        0x1.abfd875c42ba4p-10,
+        0x1.ab4af00e04bbbp-10,
+        0x1.aa98ed8d09172p-10,
+        0x1.a9e77f1fa442ap-10,
+        0x1.a936a40d5f1ap-10,
+        0x1.a8865b9ef45f3p-10,
+        0x1.a7d6a51e4e416p-10,
+        0x1.a7277fd683eap-10,
+        0x1.a678eb13d70fcp-10,
+        0x1.a5cae623b19p-10,
+        0x1.a51d7054a30d7p-10,
+        0x1.a47088f65e956p-10,
+        0x1.a3c42f59b84a3p-10,
+        0x1.a31862d0a313dp-10,
+        0x1.a26d22ae2e55ep-10,
+        0x1.a1c26e4683ab7p-10,
+        0x1.a11844eee4a81p-10,
+        0x1.a06ea5fda89ecp-10,
+        0x1.9fc590ca3a6dep-10,
+        0x1.9f1d04ad1650dp-10,
+        0x1.9e7500ffc7b6ap-10,
+        0x1.9dcd851ce71e4p-10,
+        0x1.9d26906017f78p-10,
+        0x1.9c80222606899p-10,
+        0x1.9bda39cc65de5p-10,
+        0x1.9b34d6b1edb2ep-10,
+        0x1.9a8ff836586ccp-10,
+        0x1.99eb9dba61145p-10,
+        0x1.9947c69fc153cp-10,
+        0x1.98a472492f7b5p-10,
+        0x1.9801a01a5c898p-10,
+        0x1.975f4f77f238fp-10,
+        0x1.96bd7fc79111fp-10,
+        0x1.961c306fce816p-10,
+        0x1.957b60d832f3dp-10,
+        0x1.94db106937f4fp-10,
+        0x1.943b3e8c4653dp-10,
+        0x1.939beaabb44b5p-10,
+        0x1.92fd1432c3aeep-10,
+        0x1.925eba8da01bdp-10,
+        0x1.91c0dd295d2e6p-10,
+        0x1.91237b73f4bbbp-10,
+        0x1.908694dc450f5p-10,
+        0x1.8fea28d20f2dp-10,
+        0x1.8f4e36c5f5172p-10,
+        0x1.8eb2be297818p-10,
+        0x1.8e17be6ef7108p-10,
+        0x1.8d7d3709acc98p-10,
+        0x1.8ce3276dae4a1p-10,
+        0x1.8c498f0fe930fp-10,
+        0x1.8bb06d6622122p-10,
+        0x1.8b17c1e6f2d82p-10,
+        0x1.8a7f8c09c9295p-10,
+        0x1.89e7cb46e4d03p-10,
+        0x1.89507f1756283p-10,
+        0x1.88b9a6f4fc8dap-10,
+        0x1.8823425a84d14p-10,
+        0x1.878d50c367afbp-10,
+        0x1.86f7d1abe84bcp-10,
+        0x1.8662c49112ad1p-10,
+        0x1.85ce28f0ba415p-10,
+        0x1.8539fe4978619p-10,
+        0x1.84a6441aaada9p-10,
+        0x1.8412f9e472788p-10,
+        0x1.83801f27b195ep-10,
+        0x1.82edb3660aae3p-10,
+        0x1.825bb621def31p-10,
+        0x1.81ca26de4ce57p-10,
+        0x1.8139051f2ef11p-10,
+        0x1.80a850691a0bdp-10,
+        0x1.801808415c57ap-10,
+        0x1.7f882c2dfbc81p-10,
+        0x1.7ef8bbb5b4ca5p-10,
+        0x1.7e69b65ff8f06p-10,
+        0x1.7ddb1bb4ed9f9p-10,
+        0x1.7d4ceb3d6ac1bp-10,
+        0x1.7cbf2482f978fp-10,
+        0x1.7c31c70fd2d71p-10,
+        0x1.7ba4d26ede974p-10,
+        0x1.7b18462bb1daap-10,
+        0x1.7a8c21d28de82p-10,
+        0x1.7a0064f05eee5p-10,
+        0x1.79750f12bac8cp-10,
+        0x1.78ea1fc7dfc76p-10,
+        0x1.785f969eb3796p-10,
+        0x1.77d57326c179dp-10,
+        0x1.774bb4f03a3fcp-10,
+        0x1.76c25b8bf1f02p-10,
+        0x1.7639668b5f332p-10,
+        0x1.75b0d5809a0b6p-10,
+        0x1.7528a7fe5abp-10,
+        0x1.74a0dd97f8692p-10,
+        0x1.741975e1686efp-10,
+        0x1.7392706f3ccb2p-10,
+        0x1.730bccd6a33cap-10,
+        0x1.72858aad641e1p-10,
+        0x1.71ffa989e14e8p-10,
+        0x1.717a2903151c2p-10,
+        0x1.70f508b091322p-10,
+        0x1.7070482a7d88p-10,
+        0x1.6febe7099753bp-10,
+        0x1.6f67e4e72ffddp-10,
+        0x1.6ee4415d2c183p-10,
+        0x1.6e60fc060256cp-10,
+        0x1.6dde147cba8ap-10,
+        0x1.6d5b8a5cec9cbp-10,
+        0x1.6cd95d42bf92bp-10,
+        0x1.6c578ccae88abp-10,
+        0x1.6bd61892a9c19p-10,
+        0x1.6b550037d1982p-10,
+        0x1.6ad44358b99adp-10,
+        0x1.6a53e194458b7p-10,
+        0x1.69d3da89e26dp-10,
+        0x1.69542dd98591ap-10,
+        0x1.68d4db23abaa6p-10,
+        0x1.6855e20957d8fp-10,
+        0x1.67d7422c12c39p-10,
+        0x1.6758fb2de9aadp-10,
+        0x1.66db0cb16d81p-10,
+        0x1.665d7659b204p-10,
+        0x1.65e037ca4cd87p-10,
+        0x1.656350a754a75p-10,
+        0x1.64e6c095603cep-10,
+        0x1.646a873985a9dp-10,
+        0x1.63eea4395965ep-10,
+        0x1.6373173aed74bp-10,
+        0x1.62f7dfe4d08c1p-10,
+        0x1.627cfdde0d3c4p-10,
+        0x1.620270ce2919bp-10,
+        0x1.6188385d23e8ap-10,
+        0x1.610e543376cadp-10,
+        0x1.6094c3fa136e2p-10,
+        0x1.601b875a633dbp-10,
+        0x1.5fa29dfe4693fp-10,
+        0x1.5f2a079013ef2p-10,
+        0x1.5eb1c3ba97268p-10,
+        0x1.5e39d22910a2p-10,
+        0x1.5dc2328734932p-10,
+        0x1.5d4ae4812a2f6p-10,
+        0x1.5cd3e7c38aec4p-10,
+        0x1.5c5d3bfb61bd4p-10,
+        0x1.5be6e0d62a52cp-10,
+        0x1.5b70d601d05afp-10,
+        0x1.5afb1b2caec3ep-10,
+        0x1.5a85b0058eff9p-10,
+        0x1.5a10943ba848dp-10,
+        0x1.599bc77e9eea6p-10,
+        0x1.5927497e8386dp-10,
+        0x1.58b319ebd2627p-10,
+        0x1.583f387772ae1p-10,
+        0x1.57cba4d2b5d3dp-10,
+        0x1.57585eaf56c4dp-10,
+        0x1.56e565bf7948bp-10,
+        0x1.5672b9b5a94e3p-10,
+        0x1.56005a44da3d2p-10,
+        0x1.558e4720664a1p-10,
+        0x1.551c7ffc0dcbp-10,
+        0x1.54ab048bf68d4p-10,
+        0x1.5439d484ab2d3p-10,
+        0x1.53c8ef9b1a6fp-10,
+        0x1.5358558496987p-10,
+        0x1.52e805f6d4cc7p-10,
+        0x1.527800a7ec67ap-10,
+        0x1.5208454e565e1p-10,
+        0x1.5198d3a0ec9abp-10,
+        0x1.5129ab56e95f5p-10,
+        0x1.50bacc27e6a6ap-10,
+        0x1.504c35cbdd86ap-10,
+        0x1.4fdde7fb2594dp-10,
+        0x1.4f6fe26e744b8p-10,
+        0x1.4f0224dedc702p-10,
+        0x1.4e94af05cd7acp-10,
+        0x1.4e27809d12ffp-10,
+        0x1.4dba995ed415dp-10,
+        0x1.4d4df90592c8cp-10,
+        0x1.4ce19f4c2b7dcp-10,
+        0x1.4c758bedd464dp-10,
+        0x1.4c09bea61ce65p-10,
+        0x1.4b9e3730ed127p-10,
+        0x1.4b32f54a8512p-10,
+        0x1.4ac7f8af7c98p-10,
+        0x1.4a5d411cc2546p-10,
+        0x1.49f2ce4f9b681p-10,
+        0x1.4988a005a2d9dp-10,
+        0x1.491eb5fcc90bfp-10,
+        0x1.48b50ff35333cp-10,
+        0x1.484bada7dad12p-10,
+        0x1.47e28ed94d27ep-10,
+        0x1.4779b346eab9ap-10,
+        0x1.47111ab046c1p-10,
+        0x1.46a8c4d546adap-10,
+        0x1.4640b17621a13p-10,
+        0x1.45d8e0535fed6p-10,
+        0x1.4571512dda92fp-10,
+        0x1.450a03c6bac1ap-10,
+        0x1.44a2f7df79592p-10,
+        0x1.443c2d39de6adp-10,
+        0x1.43d5a39800bcap-10,
+        0x1.436f5abc454c9p-10,
+        0x1.430952695ed5ap-10,
+        0x1.42a38a624d552p-10,
+        0x1.423e026a5d912p-10,
+        0x1.41d8ba45289ffp-10,
+        0x1.4173b1b693702p-10,
+        0x1.410ee882ce51dp-10,
+        0x1.40aa5e6e54806p-10,
+        0x1.4046133debadap-10,
+        0x1.3fe206b6a38d5p-10,
+        0x1.3f7e389dd5619p-10,
+        0x1.3f1aa8b923889p-10,
+        0x1.3eb756ce790a9p-10,
+        0x1.3e5442a40928fp-10,
+        0x1.3df16c004eee3p-10,
+        0x1.3d8ed2aa0cbe8p-10,
+        0x1.3d2c76684be96p-10,
+        0x1.3cca57025c3bcp-10,
+        0x1.3c68743fd3935p-10,
+        0x1.3c06cde88d723p-10,
+        0x1.3ba563c4aa93dp-10,
+        0x1.3b44359c90821p-10,
+        0x1.3ae34338e92bdp-10,
+        0x1.3a828c62a27bap-10,
+        0x1.3a2210e2edefap-10,
+        0x1.39c1d0834031ep-10,
+        0x1.3961cb0d50b1dp-10,
+        0x1.3902004b193dep-10,
+        0x1.38a27006d59e6p-10,
+        0x1.38431a0b0330ep-10,
+        0x1.37e3fe2260845p-10,
+        0x1.37851c17ecf5ep-10,
+        0x1.372673b6e84e6p-10,
+        0x1.36c804cad260cp-10,
+        0x1.3669cf1f6aa8bp-10,
+        0x1.360bd280afeabp-10,
+        0x1.35ae0ebadfd3ep-10,
+        0x1.3550839a769b5p-10,
+        0x1.34f330ec2ea38p-10,
+        0x1.3496167d001cfp-10,
+        0x1.3439341a20a8bp-10,
+        0x1.33dc899102fc7p-10,
+        0x1.338016af5686ap-10,
+        0x1.3323db4307134p-10,
+        0x1.32c7d71a3c71ap-10,
+        0x1.326c0a035a1a9p-10,
+        0x1.321073ccfed72p-10,
+        0x1.31b5144604682p-10,
+        0x1.3159eb3d7f2e5p-10,
+        0x1.30fef882bdd2cp-10,
+        0x1.30a43be548f0ap-10,
+        0x1.3049b534e2bebp-10,
+        0x1.2fef644186bap-10,
+        0x1.2f9548db6950ep-10,
+        0x1.2f3b62d2f78eep-10,
+        0x1.2ee1b1f8d6c8ap-10,
+        0x1.2e88361de4493p-10,
+        0x1.2e2eef1334fefp-10,
+        0x1.2dd5dcaa152ap-10,
+        0x1.2d7cfeb4080acp-10,
+        0x1.2d245502c790ap-10,
+        0x1.2ccbdf68440a2p-10,
+        0x1.2c739db6a3d51p-10,
+        0x1.2c1b8fc0430f1p-10,
+        0x1.2bc3b557b3473p-10,
+        0x1.2b6c0e4fbb2fap-10,
+        0x1.2b149a7b56502p-10,
+        0x1.2abd59adb4b8fp-10,
+        0x1.2a664bba3ab65p-10,
+        0x1.2a0f707480848p-10,
+        0x1.29b8c7b052041p-10,
+        0x1.29625141ae6f3p-10,
+        0x1.290c0cfcc80edp-10,
+        0x1.28b5fab603f12p-10,
+        0x1.28601a41f99fap-10,
+        0x1.280a6b7572d69p-10,
+        0x1.27b4ee256b3c1p-10,
+        0x1.275fa2271018ap-10,
+        0x1.270a874fc00fp-10,
+        0x1.26b59d750ad5dp-10,
+        0x1.2660e46cb0f09p-10,
+        0x1.260c5c0ca369ap-10,
+        0x1.25b8042b038cep-10,
+        0x1.2563dc9e22a27p-10,
+        0x1.250fe53c81a9ep-10,
+        0x1.24bc1ddcd1163p-10,
+        0x1.24688655f08a1p-10,
+        0x1.24151e7eee945p-10,
+        0x1.23c1e62f086d6p-10,
+        0x1.236edd3da9b4bp-10,
+        0x1.231c03826c2eep-10,
+        0x1.22c958d517841p-10,
+        0x1.2276dd0da0fefp-10,
+        0x1.222490042b4c1p-10,
+        0x1.21d2719106398p-10,
+        0x1.2180818cae775p-10,
+        0x1.212ebfcfcd57fp-10,
+        0x1.20dd2c3338916p-10,
+        0x1.208bc68ff1fe8p-10,
+        0x1.203a8ebf27613p-10,
+        0x1.1fe9849a32244p-10,
+        0x1.1f98a7fa971e6p-10,
+        0x1.1f47f8ba06553p-10,
+        0x1.1ef776b25ac0cp-10,
+        0x1.1ea721bd9a0f4p-10,
+        0x1.1e56f9b5f4699p-10,
+        0x1.1e06fe75c437cp-10,
+        0x1.1db72fd78de63p-10,
+        0x1.1d678db5ffabp-10,
+        0x1.1d1817ebf14bep-10,
+        0x1.1cc8ce5463e44p-10,
+        0x1.1c79b0ca81acp-10,
+        0x1.1c2abf299dbe4p-10,
+        0x1.1bdbf94d33e0dp-10,
+        0x1.1b8d5f10e84bep-10,
+        0x1.1b3ef0508771fp-10,
+        0x1.1af0ace805c86p-10,
+        0x1.1aa294b37f903p-10,
+        0x1.1a54a78f389f3p-10,
+        0x1.1a06e5579c294p-10,
+        0x1.19b94de93c8a9p-10,
+        0x1.196be120d3116p-10,
+        0x1.191e9edb3fc9p-10,
+        0x1.18d186f589443p-10,
+        0x1.1884994cdc68dp-10,
+        0x1.1837d5be8c3b4p-10,
+        0x1.17eb3c2811aa2p-10,
+        0x1.179ecc670b5acp-10,
+        0x1.175286593d75cp-10,
+        0x1.170669dc9173bp-10,
+        0x1.16ba76cf15ea6p-10,
+        0x1.166ead0efe5abp-10,
+        0x1.16230c7aa2fep-10,
+        0x1.15d794f08094ap-10,
+        0x1.158c464f38345p-10,
+        0x1.154120758f17p-10,
+        0x1.14f623426e69ep-10,
+        0x1.14ab4e94e31cfp-10,
+        0x1.1460a24c1db2bp-10,
+        0x1.14161e4772102p-10,
+        0x1.13cbc266574d2p-10,
+        0x1.13818e8867853p-10,
+        0x1.1337828d5fa84p-10,
+        0x1.12ed9e551f4bfp-10,
+        0x1.12a3e1bfa87d2p-10,
+        0x1.125a4cad1f92p-10,
+        0x1.1210defdcafbap-10,
+        0x1.11c798921318fp-10,
+        0x1.117e794a82091p-10,
+        0x1.11358107c37e8p-10,
+        0x1.10ecafaaa4924p-10,
+        0x1.10a4051413975p-10,
+        0x1.105b81251feebp-10,
+        0x1.101323bef9db5p-10,
+        0x1.0fcaecc2f2568p-10,
+        0x1.0f82dc127ae47p-10,
+        0x1.0f3af18f25694p-10,
+        0x1.0ef32d1aa3fe3p-10,
+        0x1.0eab8e96c8c6cp-10,
+        0x1.0e6415e585c6ep-10,
+        0x1.0e1cc2e8ecb86p-10,
+        0x1.0dd595832ee1bp-10,
+        0x1.0d8e8d969cebcp-10,
+        0x1.0d47ab05a6b96p-10,
+        0x1.0d00edb2db3dcp-10,
+        0x1.0cba5580e853dp-10,
+        0x1.0c73e2529a95fp-10,
+        0x1.0c2d940add355p-10,
+        0x1.0be76a8cb9d23p-10,
+        0x1.0ba165bb58543p-10,
+        0x1.0b5b8579fec27p-10,
+        0x1.0b15c9ac111c8p-10,
+        0x1.0ad0323511337p-10,
+        0x1.0a8abef89e82bp-10,
+        0x1.0a456fda7609ep-10,
+        0x1.0a0044be72261p-10,
+        0x1.09bb3d888a6c1p-10,
+        0x1.09765a1cd3824p-10,
+        0x1.09319a5f7efb1p-10,
+        0x1.08ecfe34db2f9p-10,
+        0x1.08a88581531a4p-10,
+        0x1.086430296e322p-10,
+        0x1.081ffe11d045fp-10,
+        0x1.07dbef1f39578p-10,
+        0x1.079803368577dp-10,
+        0x1.07543a3caca28p-10,
+        0x1.07109416c29a6p-10,
+        0x1.06cd10a9f6c56p-10,
+        0x1.0689afdb94099p-10,
+        0x1.0646719100a99p-10,
+        0x1.060355afbe21bp-10,
+        0x1.05c05c1d69055p-10,
+        0x1.057d84bfb8dbep-10,
+        0x1.053acf7c7fffp-10,
+        0x1.04f83c39ab77dp-10,
+        0x1.04b5cadd42dd7p-10,
+        0x1.04737b4d6832dp-10,
+        0x1.04314d7057c58p-10,
+        0x1.03ef412c680cp-10,
+        0x1.03ad56680984dp-10,
+        0x1.036b8d09c6954p-10,
+        0x1.0329e4f84368ep-10,
+        0x1.02e85e1a3dd0dp-10,
+        0x1.02a6f8568d235p-10,
+        0x1.0265b394221bbp-10,
+        0x1.02248fba06ba1p-10,
+        0x1.01e38caf5e23fp-10,
+        0x1.01a2aa5b64842p-10,
+        0x1.0161e8a56eeb9p-10,
+        0x1.01214774eb322p-10,
+        0x1.00e0c6b15fd75p-10,
+        0x1.00a066426be37p-10,
+        0x1.0060260fc6c9p-10,
+        0x1.0020060140461p-10,
+        0x1.ffc00bfd808bep-11,
+    };
+};
+
+template <>
+class cpp_gen_multiplier_table<webster> final
+{
+public:
+    static constexpr uint32_t MAX_NUM_REPS = 1024;
+    static constexpr double VALUES[MAX_NUM_REPS + 1] = {
+        0.0,
+        0x1.5555555555555p-1,
+        0x1.999999999999ap-2,
+        0x1.2492492492492p-2,
+        0x1.c71c71c71c71cp-3,
+        0x1.745d1745d1746p-3,
+        0x1.3b13b13b13b14p-3,
+        0x1.1111111111111p-3,
+        0x1.e1e1e1e1e1e1ep-4,
+        0x1.af286bca1af28p-4,
+        0x1.8618618618618p-4,
+        0x1.642c8590b2164p-4,
+        0x1.47ae147ae147bp-4,
+        0x1.2f684bda12f68p-4,
+        0x1.1a7b9611a7b96p-4,
+        0x1.0842108421084p-4,
+        0x1.f07c1f07c1f08p-5,
+        0x1.d41d41d41d41dp-5,
+        0x1.bacf914c1badp-5,
+        0x1.a41a41a41a41ap-5,
+        0x1.8f9c18f9c18fap-5,
+        0x1.7d05f417d05f4p-5,
+        0x1.6c16c16c16c17p-5,
+        0x1.5c9882b931057p-5,
+        0x1.4e5e0a72f0539p-5,
+        0x1.4141414141414p-5,
+        0x1.3521cfb2b78c1p-5,
+        0x1.29e4129e4129ep-5,
+        0x1.1f7047dc11f7p-5,
+        0x1.15b1e5f75270dp-5,
+        0x1.0c9714fbcda3bp-5,
+        0x1.041041041041p-5,
+        0x1.f81f81f81f82p-6,
+        0x1.e9131abf0b767p-6,
+        0x1.dae6076b981dbp-6,
+        0x1.cd85689039b0bp-6,
+        0x1.c0e070381c0ep-6,
+        0x1.b4e81b4e81b4fp-6,
+        0x1.a98ef606a63bep-6,
+        0x1.9ec8e951033d9p-6,
+        0x1.948b0fcd6e9ep-6,
+        0x1.8acb90f6bf3aap-6,
+        0x1.8181818181818p-6,
+        0x1.78a4c8178a4c8p-6,
+        0x1.702e05c0b817p-6,
+        0x1.6816816816817p-6,
+        0x1.6058160581606p-6,
+        0x1.58ed2308158edp-6,
+        0x1.51d07eae2f815p-6,
+        0x1.4afd6a052bf5bp-6,
+        0x1.446f86562d9fbp-6,
+        0x1.3e22cbce4a902p-6,
+        0x1.3813813813814p-6,
+        0x1.323e34a2b10bfp-6,
+        0x1.2c9fb4d812cap-6,
+        0x1.27350b8812735p-6,
+        0x1.21fb78121fb78p-6,
+        0x1.1cf06ada2811dp-6,
+        0x1.1811811811812p-6,
+        0x1.135c81135c811p-6,
+        0x1.0ecf56be69c9p-6,
+        0x1.0a6810a6810a7p-6,
+        0x1.0624dd2f1a9fcp-6,
+        0x1.0204081020408p-6,
+        0x1.fc07f01fc07fp-7,
+        0x1.f44659e4a4271p-7,
+        0x1.ecc07b301eccp-7,
+        0x1.e573ac901e574p-7,
+        0x1.de5d6e3f8868ap-7,
+        0x1.d77b654b82c34p-7,
+        0x1.d0cb58f6ec074p-7,
+        0x1.ca4b3055ee191p-7,
+        0x1.c3f8f01c3f8fp-7,
+        0x1.bdd2b899406f7p-7,
+        0x1.b7d6c3dda338bp-7,
+        0x1.b2036406c80d9p-7,
+        0x1.ac5701ac5701bp-7,
+        0x1.a6d01a6d01a6dp-7,
+        0x1.a16d3f97a4b02p-7,
+        0x1.9c2d14ee4a102p-7,
+        0x1.970e4f80cb872p-7,
+        0x1.920fb49d0e229p-7,
+        0x1.8d3018d3018d3p-7,
+        0x1.886e5f0abb04ap-7,
+        0x1.83c977ab2beddp-7,
+        0x1.7f405fd017f4p-7,
+        0x1.7ad2208e0ecc3p-7,
+        0x1.767dce434a9b1p-7,
+        0x1.724287f46debcp-7,
+        0x1.6e1f76b4337c7p-7,
+        0x1.6a13cd153729p-7,
+        0x1.661ec6a5122f9p-7,
+        0x1.623fa7701624p-7,
+        0x1.5e75bb8d015e7p-7,
+        0x1.5ac056b015acp-7,
+        0x1.571ed3c506b3ap-7,
+        0x1.5390948f40febp-7,
+        0x1.5015015015015p-7,
+        0x1.4cab88725af6ep-7,
+        0x1.49539e3b2d067p-7,
+        0x1.460cbc7f5cf9ap-7,
+        0x1.42d6625d51f87p-7,
+        0x1.3fb013fb013fbp-7,
+        0x1.3c995a47babe7p-7,
+        0x1.3991c2c187f63p-7,
+        0x1.3698df3de0748p-7,
+        0x1.33ae45b57bcb2p-7,
+        0x1.30d190130d19p-7,
+        0x1.2e025c04b8097p-7,
+        0x1.2b404ad012b4p-7,
+        0x1.288b01288b013p-7,
+        0x1.25e22708092f1p-7,
+        0x1.23456789abcdfp-7,
+        0x1.20b470c67c0d9p-7,
+        0x1.1e2ef3b3fb874p-7,
+        0x1.1bb4a4046ed29p-7,
+        0x1.19453808ca29cp-7,
+        0x1.16e0689427379p-7,
+        0x1.1485f0e0acd3bp-7,
+        0x1.12358e75d3033p-7,
+        0x1.0fef010fef011p-7,
+        0x1.0db20a88f4696p-7,
+        0x1.0b7e6ec259dc8p-7,
+        0x1.0953f39010954p-7,
+        0x1.073260a47f7c6p-7,
+        0x1.05197f7d73404p-7,
+        0x1.03091b51f5e1ap-7,
+        0x1.010101010101p-7,
+        0x1.fe01fe01fe02p-8,
+        0x1.fa11caa01fa12p-8,
+        0x1.f6310aca0dbb5p-8,
+        0x1.f25f644230ab5p-8,
+        0x1.ee9c7f8458e02p-8,
+        0x1.eae807aba01ebp-8,
+        0x1.e741aa59750e4p-8,
+        0x1.e3a9179dc1a73p-8,
+        0x1.e01e01e01e01ep-8,
+        0x1.dca01dca01dcap-8,
+        0x1.d92f2231e7f8ap-8,
+        0x1.d5cac807572b2p-8,
+        0x1.d272ca3fc5b1ap-8,
+        0x1.cf26e5c44bfc6p-8,
+        0x1.cbe6d9601cbe7p-8,
+        0x1.c8b265afb8a42p-8,
+        0x1.c5894d10d4986p-8,
+        0x1.c26b5392ea01cp-8,
+        0x1.bf583ee868d8bp-8,
+        0x1.bc4fd65883e7bp-8,
+        0x1.b951e2b18ff23p-8,
+        0x1.b65e2e3beee05p-8,
+        0x1.b37484ad806cep-8,
+        0x1.b094b31d922a4p-8,
+        0x1.adbe87f94905ep-8,
+        0x1.aaf1d2f87ebfdp-8,
+        0x1.a82e65130e159p-8,
+        0x1.a574107688a4ap-8,
+        0x1.a2c2a87c51cap-8,
+        0x1.a01a01a01a01ap-8,
+        0x1.9d79f176b682dp-8,
+        0x1.9ae24ea5510dap-8,
+        0x1.9852f0d8ec0ffp-8,
+        0x1.95cbb0be377aep-8,
+        0x1.934c67f9b2ce6p-8,
+        0x1.90d4f120190d5p-8,
+        0x1.8e6527af1373fp-8,
+        0x1.8bfce8062ff3ap-8,
+        0x1.899c0f601899cp-8,
+        0x1.87427bcc092b9p-8,
+        0x1.84f00c2780614p-8,
+        0x1.82a4a0182a4ap-8,
+        0x1.8060180601806p-8,
+        0x1.7e225515a4f1dp-8,
+        0x1.7beb3922e017cp-8,
+        0x1.79baa6bb6398bp-8,
+        0x1.77908119ac60dp-8,
+        0x1.756cac201756dp-8,
+        0x1.734f0c541fe8dp-8,
+        0x1.713786d9c7c09p-8,
+        0x1.6f26016f26017p-8,
+        0x1.6d1a62681c861p-8,
+        0x1.6b1490aa31a3dp-8,
+        0x1.691473a88d0cp-8,
+        0x1.6719f3601671ap-8,
+        0x1.6524f853b4aa3p-8,
+        0x1.63356b88ac0dep-8,
+        0x1.614b36831ae94p-8,
+        0x1.5f66434292dfcp-8,
+        0x1.5d867c3ece2a5p-8,
+        0x1.5babcc647fa91p-8,
+        0x1.59d61f123ccaap-8,
+        0x1.580560158056p-8,
+        0x1.56397ba7c52e2p-8,
+        0x1.54725e6bb82fep-8,
+        0x1.52aff56a8054bp-8,
+        0x1.50f22e111c4c5p-8,
+        0x1.4f38f62dd4c9bp-8,
+        0x1.4d843bedc2c4cp-8,
+        0x1.4bd3edda68fe1p-8,
+        0x1.4a27fad76014ap-8,
+        0x1.488052201488p-8,
+        0x1.46dce34596066p-8,
+        0x1.453d9e2c776cap-8,
+        0x1.43a2730abee4dp-8,
+        0x1.420b5265e5951p-8,
+        0x1.40782d10e6566p-8,
+        0x1.3ee8f42a5af07p-8,
+        0x1.3d5d991aa75c6p-8,
+        0x1.3bd60d9232955p-8,
+        0x1.3a524387ac822p-8,
+        0x1.38d22d366088ep-8,
+        0x1.3755bd1c945eep-8,
+        0x1.35dce5f9f2af8p-8,
+        0x1.34679ace01346p-8,
+        0x1.32f5ced6a1dfap-8,
+        0x1.3187758e9ebb6p-8,
+        0x1.301c82ac4026p-8,
+        0x1.2eb4ea1fed14bp-8,
+        0x1.2d50a012d50ap-8,
+        0x1.2bef98e5a3711p-8,
+        0x1.2a91c92f3c105p-8,
+        0x1.293725bb804a5p-8,
+        0x1.27dfa38a1ce4dp-8,
+        0x1.268b37cd60127p-8,
+        0x1.2539d7e9177b2p-8,
+        0x1.23eb79717605bp-8,
+        0x1.22a0122a0122ap-8,
+        0x1.21579804855e6p-8,
+        0x1.2012012012012p-8,
+        0x1.1ecf43c7fb84cp-8,
+        0x1.1d8f5672e4abdp-8,
+        0x1.1c522fc1ce059p-8,
+        0x1.1b17c67f2bae3p-8,
+        0x1.19e0119e0119ep-8,
+        0x1.18ab083902bdbp-8,
+        0x1.1778a191bd684p-8,
+        0x1.1648d50fc3201p-8,
+        0x1.151b9a3fdd5c9p-8,
+        0x1.13f0e8d344724p-8,
+        0x1.12c8b89edc0acp-8,
+        0x1.11a3019a74826p-8,
+        0x1.107fbbe01108p-8,
+        0x1.0f5edfab325a2p-8,
+        0x1.0e40655826011p-8,
+        0x1.0d24456359e3ap-8,
+        0x1.0c0a7868b4171p-8,
+        0x1.0af2f722eecb5p-8,
+        0x1.09ddba6af836p-8,
+        0x1.08cabb37565e2p-8,
+        0x1.07b9f29b8eae2p-8,
+        0x1.06ab59c7912fbp-8,
+        0x1.059eea0727586p-8,
+        0x1.04949cc1664c5p-8,
+        0x1.038c6b78247fcp-8,
+        0x1.02864fc7729e9p-8,
+        0x1.0182436517a37p-8,
+        0x1.008040201008p-8,
+        0x1.ff007fc01ffp-9,
+        0x1.fd04794a10e6ap-9,
+        0x1.fb0c610d5e939p-9,
+        0x1.f9182b6813bafp-9,
+        0x1.f727cce5f530ap-9,
+        0x1.f53b3a3fa204ep-9,
+        0x1.f3526859b8cecp-9,
+        0x1.f16d4c4401f17p-9,
+        0x1.ef8bdb389ebadp-9,
+        0x1.edae0a9b3d3a5p-9,
+        0x1.ebd3cff850b0cp-9,
+        0x1.e9fd21044e799p-9,
+        0x1.e829f39aef509p-9,
+        0x1.e65a3dbe74d6bp-9,
+        0x1.e48df596f3394p-9,
+        0x1.e2c511719ee16p-9,
+        0x1.e0ff87c01e1p-9,
+        0x1.df3d4f17de4dbp-9,
+        0x1.dd7e5e316d94cp-9,
+        0x1.dbc2abe7d71d4p-9,
+        0x1.da0a2f3803b41p-9,
+        0x1.d854df401d855p-9,
+        0x1.d6a2b33ef7448p-9,
+        0x1.d4f3a293769cap-9,
+        0x1.d347a4bc01d34p-9,
+        0x1.d19eb155f08a4p-9,
+        0x1.cff8c01cff8cp-9,
+        0x1.ce55c8eac79p-9,
+        0x1.ccb5c3b636e3ap-9,
+        0x1.cb18a8930de6p-9,
+        0x1.c97e6fb15e44dp-9,
+        0x1.c7e7115d0ce95p-9,
+        0x1.c65285fd56843p-9,
+        0x1.c4c0c61456a8ep-9,
+        0x1.c331ca3e91679p-9,
+        0x1.c1a58b327f576p-9,
+        0x1.c01c01c01c01cp-9,
+        0x1.be9526d0769fap-9,
+        0x1.bd10f365451b6p-9,
+        0x1.bb8f609879493p-9,
+        0x1.ba10679bd8488p-9,
+        0x1.b89401b89401cp-9,
+        0x1.b71a284ee6b34p-9,
+        0x1.b5a2d4d5b081fp-9,
+        0x1.b42e00da17007p-9,
+        0x1.b2bba5ff26a23p-9,
+        0x1.b14bbdfd760e6p-9,
+        0x1.afde42a2cb482p-9,
+        0x1.ae732dd1c2a09p-9,
+        0x1.ad0a798177693p-9,
+        0x1.aba41fbd2e5b1p-9,
+        0x1.aa401aa401aa4p-9,
+        0x1.a8de64688ebabp-9,
+        0x1.a77ef750a56dap-9,
+        0x1.a621cdb4f8fdfp-9,
+        0x1.a4c6e200d2637p-9,
+        0x1.a36e2eb1c432dp-9,
+        0x1.a217ae575ff2fp-9,
+        0x1.a0c35b92ecdf1p-9,
+        0x1.9f713117200dp-9,
+        0x1.9e2129a7d5f0ap-9,
+        0x1.9cd34019cd34p-9,
+        0x1.9b876f5262dd1p-9,
+        0x1.9a3db2474fb98p-9,
+        0x1.98f603fe670ap-9,
+        0x1.97b05f8d56652p-9,
+        0x1.966cc01966ccp-9,
+        0x1.952b20d73ee97p-9,
+        0x1.93eb7d0aa6759p-9,
+        0x1.92add0064ab74p-9,
+        0x1.9172152b841ddp-9,
+        0x1.903847ea1cec1p-9,
+        0x1.8f0063c018fp-9,
+        0x1.8dca64397e408p-9,
+        0x1.8c9644f01efbcp-9,
+        0x1.8b64018b64019p-9,
+        0x1.8a3395c018a34p-9,
+        0x1.8904fd503744bp-9,
+        0x1.87d8340ab6e97p-9,
+        0x1.86ad35cb59a84p-9,
+        0x1.8583fe7a7c018p-9,
+        0x1.845c8a0ce5129p-9,
+        0x1.8336d48397a24p-9,
+        0x1.8212d9eba4018p-9,
+        0x1.80f0965dfabcbp-9,
+        0x1.7fd005ff4018p-9,
+        0x1.7eb124ffa053bp-9,
+        0x1.7d93ef9aa4b46p-9,
+        0x1.7c7862170949fp-9,
+        0x1.7b5e78c693733p-9,
+        0x1.7a463005e918cp-9,
+        0x1.792f843c689c3p-9,
+        0x1.781a71dc01782p-9,
+        0x1.7706f5610d8dp-9,
+        0x1.75f50b522b17cp-9,
+        0x1.74e4b040174e5p-9,
+        0x1.73d5e0c5899f7p-9,
+        0x1.72c899870f91fp-9,
+        0x1.71bcd732e940ap-9,
+        0x1.70b29680e66fap-9,
+        0x1.6fa9d4324438p-9,
+        0x1.6ea28d118b474p-9,
+        0x1.6d9cbdf26eaefp-9,
+        0x1.6c9863b1ab429p-9,
+        0x1.6b957b34e7803p-9,
+        0x1.6a94016a94017p-9,
+        0x1.6993f349cc726p-9,
+        0x1.68954dd2390bap-9,
+        0x1.67980e0bf08c7p-9,
+        0x1.669c31075ab4p-9,
+        0x1.65a1b3dd13357p-9,
+        0x1.64a893adcd25fp-9,
+        0x1.63b0cda236e1cp-9,
+        0x1.62ba5eeade65ep-9,
+        0x1.61c544c0161c5p-9,
+        0x1.60d17c61da198p-9,
+        0x1.5fdf0317b5c6fp-9,
+        0x1.5eedd630a9fb3p-9,
+        0x1.5dfdf303137b6p-9,
+        0x1.5d0f56ec91e57p-9,
+        0x1.5c21ff51ef005p-9,
+        0x1.5b35e99f06714p-9,
+        0x1.5a4b1346add2bp-9,
+        0x1.596179c29d2cep-9,
+        0x1.58791a9357ccep-9,
+        0x1.5791f34015792p-9,
+        0x1.56ac0156ac015p-9,
+        0x1.55c7426b79286p-9,
+        0x1.54e3b4194ce66p-9,
+        0x1.5401540154015p-9,
+        0x1.53201fcb02fb1p-9,
+        0x1.5240152401524p-9,
+        0x1.516131c015161p-9,
+        0x1.508373590ec9cp-9,
+        0x1.4fa6d7aeb597cp-9,
+        0x1.4ecb5c86b3d24p-9,
+        0x1.4df0ffac83c01p-9,
+        0x1.4d17bef15cb4ep-9,
+        0x1.4c3f982c20723p-9,
+        0x1.4b68893948d1cp-9,
+        0x1.4a928ffad5b5cp-9,
+        0x1.49bdaa583b401p-9,
+        0x1.48e9d63e504d1p-9,
+        0x1.4817119f3d325p-9,
+        0x1.47455a726abf2p-9,
+        0x1.4674aeb4717e9p-9,
+        0x1.45a50c670938fp-9,
+        0x1.44d67190f8b43p-9,
+        0x1.4408dc3e05b22p-9,
+        0x1.433c4a7ee52b4p-9,
+        0x1.4270ba692bc4dp-9,
+        0x1.41a62a173e821p-9,
+        0x1.40dc97a843ae8p-9,
+        0x1.4014014014014p-9,
+        0x1.3f4c65072bf74p-9,
+        0x1.3e85c12a9d651p-9,
+        0x1.3dc013dc013dcp-9,
+        0x1.3cfb5b51698ebp-9,
+        0x1.3c3795c553afbp-9,
+        0x1.3b74c1769aa5cp-9,
+        0x1.3ab2dca869b81p-9,
+        0x1.39f1e5a22f36ep-9,
+        0x1.3931daaf8f721p-9,
+        0x1.3872ba2057e04p-9,
+        0x1.37b4824872744p-9,
+        0x1.36f7317fd9212p-9,
+        0x1.363ac622898b1p-9,
+        0x1.357f3e9078e5bp-9,
+        0x1.34c4992d87fd9p-9,
+        0x1.340ad461776d3p-9,
+        0x1.3351ee97dbfc6p-9,
+        0x1.3299e6401329ap-9,
+        0x1.31e2b9cd37dc2p-9,
+        0x1.312c67b6173eep-9,
+        0x1.3076ee7525c2cp-9,
+        0x1.2fc24c8874486p-9,
+        0x1.2f0e8071a5703p-9,
+        0x1.2e5b88b5e3104p-9,
+        0x1.2da963ddd3cfbp-9,
+        0x1.2cf8107590e67p-9,
+        0x1.2c478d0c9c013p-9,
+        0x1.2b97d835d548ep-9,
+        0x1.2ae8f087718dp-9,
+        0x1.2a3ad49af0907p-9,
+        0x1.298d830d1378p-9,
+        0x1.28e0fa7dd35a3p-9,
+        0x1.2835399057efdp-9,
+        0x1.278a3eeaee65p-9,
+        0x1.26e009370049cp-9,
+        0x1.263697210aa18p-9,
+        0x1.258de75895121p-9,
+        0x1.24e5f89029305p-9,
+        0x1.243ec97d49eaep-9,
+        0x1.239858d86b11fp-9,
+        0x1.22f2a55ce8fc5p-9,
+        0x1.224dadc900489p-9,
+        0x1.21a970ddc5ba7p-9,
+        0x1.2105ed5f1e336p-9,
+        0x1.20632213b6c6dp-9,
+        0x1.1fc10dc4fce8bp-9,
+        0x1.1f1faf3f16b64p-9,
+        0x1.1e7f0550db594p-9,
+        0x1.1ddf0ecbcb841p-9,
+        0x1.1d3fca840a074p-9,
+        0x1.1ca13750547fep-9,
+        0x1.1c035409fc1dfp-9,
+        0x1.1b661f8cde833p-9,
+        0x1.1ac998b75eb9p-9,
+        0x1.1a2dbe6a5e3e4p-9,
+        0x1.19928f89362b7p-9,
+        0x1.18f80af9b06dcp-9,
+        0x1.185e2fa401186p-9,
+        0x1.17c4fc72bfcb9p-9,
+        0x1.172c7052e1316p-9,
+        0x1.16948a33b08fap-9,
+        0x1.15fd4906c96f1p-9,
+        0x1.1566abc011567p-9,
+        0x1.14d0b155b19aep-9,
+        0x1.143b58c01143bp-9,
+        0x1.13a6a0f9cf01ep-9,
+        0x1.131288ffbb3b6p-9,
+        0x1.127f0fd0d2295p-9,
+        0x1.11ec346e36092p-9,
+        0x1.1159f5db29606p-9,
+        0x1.10c8531d0952ep-9,
+        0x1.10374b3b480aap-9,
+        0x1.0fa6dd3f67322p-9,
+        0x1.0f170834f27fap-9,
+        0x1.0e87cb297a51ep-9,
+        0x1.0df9252c8e5e6p-9,
+        0x1.0d6b154fb86f9p-9,
+        0x1.0cdd9aa677344p-9,
+        0x1.0c50b446391f3p-9,
+        0x1.0bc4614657569p-9,
+        0x1.0b38a0c010b39p-9,
+        0x1.0aad71ce84d16p-9,
+        0x1.0a22d38eaf2bfp-9,
+        0x1.0998c51f624d5p-9,
+        0x1.090f45a1430aap-9,
+        0x1.08865436c3cf7p-9,
+        0x1.07fdf0041ff7cp-9,
+        0x1.0776182f57386p-9,
+        0x1.06eecbe029155p-9,
+        0x1.06680a4010668p-9,
+        0x1.05e1d27a3ee9cp-9,
+        0x1.055c23bb98e2ap-9,
+        0x1.04d6fd32b0c7bp-9,
+        0x1.04525e0fc2fcbp-9,
+        0x1.03ce4584b19ap-9,
+        0x1.034ab2c50040dp-9,
+        0x1.02c7a505cffbfp-9,
+        0x1.02451b7ddb2d2p-9,
+        0x1.01c315657186bp-9,
+        0x1.014191f674111p-9,
+        0x1.00c0906c513cfp-9,
+        0x1.0040100401004p-9,
+        0x1.ff801ff801ff8p-10,
+        0x1.fe811f28a186ep-10,
+        0x1.fd831c1cdbed1p-10,
+        0x1.fc86155aa1659p-10,
+        0x1.fb8a096acfaccp-10,
+        0x1.fa8ef6d92aca5p-10,
+        0x1.f994dc3455e8dp-10,
+        0x1.f89bb80dcc421p-10,
+        0x1.f7a388f9da20fp-10,
+        0x1.f6ac4d8f95f7ap-10,
+        0x1.f5b60468d989fp-10,
+        0x1.f4c0ac223b2bcp-10,
+        0x1.f3cc435b0713cp-10,
+        0x1.f2d8c8b538c0fp-10,
+        0x1.f1e63ad57473cp-10,
+        0x1.f0f4986300ba6p-10,
+        0x1.f003e007c00f8p-10,
+        0x1.ef1410702a8bcp-10,
+        0x1.ee25284b47a92p-10,
+        0x1.ed37264aa8191p-10,
+        0x1.ec4a09225fab6p-10,
+        0x1.eb5dcf88ff47cp-10,
+        0x1.ea7278378ef7ap-10,
+        0x1.e98801e98801fp-10,
+        0x1.e89e6b5ccf172p-10,
+        0x1.e7b5b351ae8e7p-10,
+        0x1.e6cdd88ad0b2cp-10,
+        0x1.e5e6d9cd3a20cp-10,
+        0x1.e500b5e044342p-10,
+        0x1.e41b6b8d97851p-10,
+        0x1.e336f9a126758p-10,
+        0x1.e2535ee927cd2p-10,
+        0x1.e1709a3611655p-10,
+        0x1.e08eaa5a92e3ap-10,
+        0x1.dfad8e2b90833p-10,
+        0x1.decd44801decdp-10,
+        0x1.ddedcc31791dap-10,
+        0x1.dd0f241b055b9p-10,
+        0x1.dc314b1a46384p-10,
+        0x1.db54400edaa2p-10,
+        0x1.da7801da7801ep-10,
+        0x1.d99c8f60e567dp-10,
+        0x1.d8c1e787f6c43p-10,
+        0x1.d7e80937882e1p-10,
+        0x1.d70ef3597937p-10,
+        0x1.d636a4d9a84b5p-10,
+        0x1.d55f1ca5ee1fap-10,
+        0x1.d48859ae192a5p-10,
+        0x1.d3b25ae3e929dp-10,
+        0x1.d2dd1f3b0ab6dp-10,
+        0x1.d208a5a912e32p-10,
+        0x1.d134ed257ae3ap-10,
+        0x1.d061f4a99bc6ep-10,
+        0x1.cf8fbb30aa36cp-10,
+        0x1.cebe3fb7b2461p-10,
+        0x1.cded813d9348ep-10,
+        0x1.cd1d7ec2fbb8ep-10,
+        0x1.cc4e374a65243p-10,
+        0x1.cb7fa9d810278p-10,
+        0x1.cab1d5720072bp-10,
+        0x1.c9e4b91ff8d87p-10,
+        0x1.c91853eb77684p-10,
+        0x1.c84ca4dfb192dp-10,
+        0x1.c781ab099058fp-10,
+        0x1.c6b76577ac845p-10,
+        0x1.c5edd33a4aea8p-10,
+        0x1.c524f36358b9ep-10,
+        0x1.c45cc50667d05p-10,
+        0x1.c3954738ab1b9p-10,
+        0x1.c2ce7910f3035p-10,
+        0x1.c20859a7a9dc6p-10,
+        0x1.c142e816d065dp-10,
+        0x1.c07e2379fa4e6p-10,
+        0x1.bfba0aee4ac45p-10,
+        0x1.bef69d92710cep-10,
+        0x1.be33da86a525bp-10,
+        0x1.bd71c0eca46e8p-10,
+        0x1.bcb04fe7ae5bap-10,
+        0x1.bbef869c81313p-10,
+        0x1.bb2f643156c6ap-10,
+        0x1.ba6fe7cde152cp-10,
+        0x1.b9b1109b483fdp-10,
+        0x1.b8f2ddc425086p-10,
+        0x1.b8354e74801b8p-10,
+        0x1.b77861d9cdc98p-10,
+        0x1.b6bc1722eb385p-10,
+        0x1.b6006d801b6p-10,
+        0x1.b5456423040e8p-10,
+        0x1.b48afa3eaaf37p-10,
+        0x1.b3d12f0772b33p-10,
+        0x1.b31801b31801bp-10,
+        0x1.b25f7178aec46p-10,
+        0x1.b1a77d909f3b8p-10,
+        0x1.b0f02534a3328p-10,
+        0x1.b039679fc337fp-10,
+        0x1.af83440e53dbcp-10,
+        0x1.aecdb9bdf2f54p-10,
+        0x1.ae18c7ed84ef7p-10,
+        0x1.ad646ddd321c2p-10,
+        0x1.acb0aace640e4p-10,
+        0x1.abfd7e03c2fa6p-10,
+        0x1.ab4ae6c1331ddp-10,
+        0x1.aa98e44bd22c9p-10,
+        0x1.a9e775e9f4c52p-10,
+        0x1.a9369ae323eb4p-10,
+        0x1.a88652801a886p-10,
+        0x1.a7d69c0ac2f2fp-10,
+        0x1.a72776ce347b2p-10,
+        0x1.a678e216b0fe2p-10,
+        0x1.a5cadd31a27f4p-10,
+        0x1.a51d676d98c71p-10,
+        0x1.a470801a4708p-10,
+        0x1.a3c4268881898p-10,
+        0x1.a3185a0a3b583p-10,
+        0x1.a26d19f283fbfp-10,
+        0x1.a1c265958533ap-10,
+        0x1.a1183c4880b68p-10,
+        0x1.a06e9d61cdfabp-10,
+        0x1.9fc58838d801ap-10,
+        0x1.9f1cfc261b292p-10,
+        0x1.9e74f8832302ap-10,
+        0x1.9dcd7caa882eep-10,
+        0x1.9d2687f7ee3f6p-10,
+        0x1.9c8019c8019c8p-10,
+        0x1.9bda317875714p-10,
+        0x1.9b34ce68019b3p-10,
+        0x1.9a8feff660a06p-10,
+        0x1.99eb95844da92p-10,
+        0x1.9947be73827f8p-10,
+        0x1.98a46a26b5931p-10,
+        0x1.980198019801ap-10,
+        0x1.975f4768d3a48p-10,
+        0x1.96bd77c20922cp-10,
+        0x1.961c2873ce079p-10,
+        0x1.957b58e5aadd6p-10,
+        0x1.94db0880194dbp-10,
+        0x1.943b36ac82451p-10,
+        0x1.939be2d53c1b9p-10,
+        0x1.92fd0c6588c1ap-10,
+        0x1.925eb2c993f11p-10,
+        0x1.91c0d56e7162bp-10,
+        0x1.912373c21b07ap-10,
+        0x1.90868d336f476p-10,
+        0x1.8fea21322f417p-10,
+        0x1.8f4e2f2efd135p-10,
+        0x1.8eb2b69b5a22ap-10,
+        0x1.8e17b6e9a56b2p-10,
+        0x1.8d7d2f8d19d04p-10,
+        0x1.8ce31ff9cc738p-10,
+        0x1.8c4987a4ab0dcp-10,
+        0x1.8bb066037a4cep-10,
+        0x1.8b17ba8cd4354p-10,
+        0x1.8a7f84b826867p-10,
+        0x1.89e7c3fdb1246p-10,
+        0x1.895077d684836p-10,
+        0x1.88b99fbc80189p-10,
+        0x1.88233b2a50cd4p-10,
+        0x1.878d499b6f766p-10,
+        0x1.86f7ca8c1f4edp-10,
+        0x1.8662bd796c763p-10,
+        0x1.85ce21e12a71dp-10,
+        0x1.8539f741f2b24p-10,
+        0x1.84a63d1b231b8p-10,
+        0x1.8412f2ecdc90cp-10,
+        0x1.8380183801838p-10,
+        0x1.82edac7e3485cp-10,
+        0x1.825baf41d6dfcp-10,
+        0x1.81ca200607288p-10,
+        0x1.8138fe4e9fe1ep-10,
+        0x1.80a849a03617bp-10,
+        0x1.8018018018018p-10,
+        0x1.7f8825744ba86p-10,
+        0x1.7ef8b5038d8ebp-10,
+        0x1.7e69afb54f5bbp-10,
+        0x1.7ddb1511b689ap-10,
+        0x1.7d4ce4a19b16ep-10,
+        0x1.7cbf1dee863a6p-10,
+        0x1.7c31c082b11a3p-10,
+        0x1.7ba4cbe90385ap-10,
+        0x1.7b183fad12b21p-10,
+        0x1.7a8c1b5b1ffa1p-10,
+        0x1.7a005e8017ap-10,
+        0x1.797508a98f92ep-10,
+        0x1.78ea1965c6362p-10,
+        0x1.785f9043a12bfp-10,
+        0x1.77d56cd2ac228p-10,
+        0x1.774baea317a3ap-10,
+        0x1.76c25545b7e72p-10,
+        0x1.7639604c03a79p-10,
+        0x1.75b0cf4812fap-10,
+        0x1.7528a1cc9e27cp-10,
+        0x1.74a0d76cfc8bp-10,
+        0x1.74196fbd236dfp-10,
+        0x1.73926a51a4ebep-10,
+        0x1.730bc6bfaed57p-10,
+        0x1.7285849d0996bp-10,
+        0x1.71ffa380172p-10,
+        0x1.717a22ffd1d0cp-10,
+        0x1.70f502b3cb651p-10,
+        0x1.707042342be56p-10,
+        0x1.6febe119b0985p-10,
+        0x1.6f67defdaaf73p-10,
+        0x1.6ee43b79ffa44p-10,
+        0x1.6e60f6292563ap-10,
+        0x1.6dde0ea624162p-10,
+        0x1.6d5b848c93b68p-10,
+        0x1.6cd957789b589p-10,
+        0x1.6c578706f02abp-10,
+        0x1.6bd612d4d4798p-10,
+        0x1.6b54fa8016b55p-10,
+        0x1.6ad43da71079ep-10,
+        0x1.6a53dbe8a5985p-10,
+        0x1.69d3d4e44322dp-10,
+        0x1.69542839de7a7p-10,
+        0x1.68d4d589f45f2p-10,
+        0x1.6855dc7588017p-10,
+        0x1.67d73c9e22162p-10,
+        0x1.6758f5a5cfec6p-10,
+        0x1.66db072f2284dp-10,
+        0x1.665d70dd2dabbp-10,
+        0x1.65e032538713cp-10,
+        0x1.65634b3645741p-10,
+        0x1.64e6bb29ffa6cp-10,
+        0x1.646a81d3cbca6p-10,
+        0x1.63ee9ed93e647p-10,
+        0x1.637311e069863p-10,
+        0x1.62f7da8fdbf2dp-10,
+        0x1.627cf88ea048p-10,
+        0x1.62026b843c277p-10,
+        0x1.61883318af629p-10,
+        0x1.610e4ef473283p-10,
+        0x1.6094bec079332p-10,
+        0x1.601b82262afb6p-10,
+        0x1.5fa298cf68e82p-10,
+        0x1.5f2a026689843p-10,
+        0x1.5eb1be9658b37p-10,
+        0x1.5e39cd0a16ea5p-10,
+        0x1.5dc22d6d78667p-10,
+        0x1.5d4adf6ca469cp-10,
+        0x1.5cd3e2b43475ep-10,
+        0x1.5c5d36f1338a5p-10,
+        0x1.5be6dbd11d636p-10,
+        0x1.5b70d101ddbb2p-10,
+        0x1.5afb1631cf8b7p-10,
+        0x1.5a85ab0fbc51ep-10,
+        0x1.5a108f4adb55p-10,
+        0x1.599bc292d0eaep-10,
+        0x1.59274497adc1ap-10,
+        0x1.58b31509ee28cp-10,
+        0x1.583f339a795c4p-10,
+        0x1.57cb9ffaa0d18p-10,
+        0x1.575859dc1f84ap-10,
+        0x1.56e560f119483p-10,
+        0x1.5672b4ec1a15cp-10,
+        0x1.56005580156p-10,
+        0x1.558e426065664p-10,
+        0x1.551c7b40ca88fp-10,
+        0x1.54aaffd56aap-10,
+        0x1.5439cfd2d0526p-10,
+        0x1.53c8eaedea6e8p-10,
+        0x1.535850dc0b447p-10,
+        0x1.52e80152e8015p-10,
+        0x1.5277fc08980bep-10,
+        0x1.520840b394626p-10,
+        0x1.5198cf0ab6f99p-10,
+        0x1.5129a6c53a1d5p-10,
+        0x1.50bac79ab7d1fp-10,
+        0x1.504c314329375p-10,
+        0x1.4fdde376e5ecap-10,
+        0x1.4f6fddeea375cp-10,
+        0x1.4f02206374a1ap-10,
+        0x1.4e94aa8ec8f1dp-10,
+        0x1.4e277c2a6c034p-10,
+        0x1.4dba94f084f85p-10,
+        0x1.4d4df49b95e3bp-10,
+        0x1.4ce19ae67b348p-10,
+        0x1.4c75878c6b23ep-10,
+        0x1.4c09ba48f5233p-10,
+        0x1.4b9e32d8014bap-10,
+        0x1.4b32f0f5cfcedp-10,
+        0x1.4ac7f45ef868bp-10,
+        0x1.4a5d3cd069d1ep-10,
+        0x1.49f2ca0769341p-10,
+        0x1.49889bc1919e8p-10,
+        0x1.491eb1bcd37c4p-10,
+        0x1.48b50bb7740afp-10,
+        0x1.484ba9700cd2fp-10,
+        0x1.47e28aa58b208p-10,
+        0x1.4779af172f7d8p-10,
+        0x1.471116848d2cep-10,
+        0x1.46a8c0ad89a66p-10,
+        0x1.4640ad525c13cp-10,
+        0x1.45d8dc338ccedp-10,
+        0x1.45714d11f4e06p-10,
+        0x1.4509ffaebd801p-10,
+        0x1.44a2f3cb5f958p-10,
+        0x1.443c2929a339dp-10,
+        0x1.43d59f8b9f3abp-10,
+        0x1.436f56b3b89dfp-10,
+        0x1.43094e64a2263p-10,
+        0x1.42a386615bd85p-10,
+        0x1.423dfe6d3281fp-10,
+        0x1.41d8b64bbf40ep-10,
+        0x1.4173adc0e70b2p-10,
+        0x1.410ee490da382p-10,
+        0x1.40aa5a80140aap-10,
+        0x1.40460f535a3bcp-10,
+        0x1.3fe202cfbc865p-10,
+        0x1.3f7e34ba9433dp-10,
+        0x1.3f1aa4d983a96p-10,
+        0x1.3eb752f275f66p-10,
+        0x1.3e543ecb9e633p-10,
+        0x1.3df1682b78014p-10,
+        0x1.3d8eced8c53bbp-10,
+        0x1.3d2c729a8f68ep-10,
+        0x1.3cca5338265c8p-10,
+        0x1.3c6870791ffb1p-10,
+        0x1.3c06ca2557cd6p-10,
+        0x1.3ba56004ee958p-10,
+        0x1.3b4431e049e4p-10,
+        0x1.3ae33f8013ae3p-10,
+        0x1.3a8288ad39e54p-10,
+        0x1.3a220d30ee0ddp-10,
+        0x1.39c1ccd4a4d85p-10,
+        0x1.3961c76215ba8p-10,
+        0x1.3901fca33a894p-10,
+        0x1.38a26c624f131p-10,
+        0x1.38431669d0bbep-10,
+        0x1.37e3fa847e18bp-10,
+        0x1.3785187d568cep-10,
+        0x1.3726701f99e76p-10,
+        0x1.36c80136c8013p-10,
+        0x1.3669cb8ea05c2p-10,
+        0x1.360bcef321c29p-10,
+        0x1.35ae0b3089e78p-10,
+        0x1.355080135508p-10,
+        0x1.34f32d683d8c7p-10,
+        0x1.349612fc3babp-10,
+        0x1.3439309c850abp-10,
+        0x1.33dc86168c66dp-10,
+        0x1.3380133801338p-10,
+        0x1.3323d7cecf427p-10,
+        0x1.32c7d3a91e689p-10,
+        0x1.326c069552243p-10,
+        0x1.321070620944p-10,
+        0x1.31b510de1d8e4p-10,
+        0x1.3159e7d8a3692p-10,
+        0x1.30fef520e9833p-10,
+        0x1.30a43886787cfp-10,
+        0x1.3049b1d912928p-10,
+        0x1.2fef60e8b3463p-10,
+        0x1.2f9545858f0bbp-10,
+        0x1.2f3b5f8012f3bp-10,
+        0x1.2ee1aea8e4582p-10,
+        0x1.2e8832d0e0891p-10,
+        0x1.2e2eebc91c7a3p-10,
+        0x1.2dd5d962e470ap-10,
+        0x1.2d7cfb6fbbb1bp-10,
+        0x1.2d2451c15c32p-10,
+        0x1.2ccbdc29b645p-10,
+        0x1.2c739a7af04d7p-10,
+        0x1.2c1b8c87666dep-10,
+        0x1.2bc3b221aa3a4p-10,
+        0x1.2b6c0b1c82699p-10,
+        0x1.2b14974aea886p-10,
+        0x1.2abd568012abdp-10,
+        0x1.2a66488f5f24ep-10,
+        0x1.2a0f6d4c68346p-10,
+        0x1.29b8c48af9bfcp-10,
+        0x1.29624e1f1305bp-10,
+        0x1.290c09dce653dp-10,
+        0x1.28b5f798d8bcfp-10,
+        0x1.2860172781cf1p-10,
+        0x1.280a685dab4bp-10,
+        0x1.27b4eb1050db8p-10,
+        0x1.275f9f149fcd4p-10,
+        0x1.270a843ff6c7bp-10,
+        0x1.26b59a67e585bp-10,
+        0x1.2660e1622c8f3p-10,
+        0x1.260c5904bcf2fp-10,
+        0x1.25b80125b8012p-10,
+        0x1.2563d99b6f063p-10,
+        0x1.250fe23c6305ep-10,
+        0x1.24bc1adf44778p-10,
+        0x1.2468835af301ep-10,
+        0x1.24151b867d381p-10,
+        0x1.23c1e3392056ap-10,
+        0x1.236eda4a48012p-10,
+        0x1.231c00918e005p-10,
+        0x1.22c955e6ba005p-10,
+        0x1.2276da21c14fep-10,
+        0x1.22248d1ac69f8p-10,
+        0x1.21d26eaa19c17p-10,
+        0x1.21807ea83769ap-10,
+        0x1.212ebcedc8ee6p-10,
+        0x1.20dd2953a4099p-10,
+        0x1.208bc3b2ca9a2p-10,
+        0x1.203a8be46a65ap-10,
+        0x1.1fe981c1dcdacp-10,
+        0x1.1f98a524a6d41p-10,
+        0x1.1f47f5e6785aep-10,
+        0x1.1ef773e12c6b1p-10,
+        0x1.1ea71eeec8b68p-10,
+        0x1.1e56f6e97d69dp-10,
+        0x1.1e06fbaba4f0cp-10,
+        0x1.1db72d0fc3bb6p-10,
+        0x1.1d678af088036p-10,
+        0x1.1d181528c992p-10,
+        0x1.1cc8cb9389867p-10,
+        0x1.1c79ae0bf21c1p-10,
+        0x1.1c2abc6d56718p-10,
+        0x1.1bdbf69332502p-10,
+        0x1.1b8d5c5929f39p-10,
+        0x1.1b3eed9b09d1dp-10,
+        0x1.1af0aa34c663cp-10,
+        0x1.1aa292027beddp-10,
+        0x1.1a54a4e06e491p-10,
+        0x1.1a06e2ab08acfp-10,
+        0x1.19b94b3edd78fp-10,
+        0x1.196bde78a5feap-10,
+        0x1.191e9c35424cap-10,
+        0x1.18d18451b8f9p-10,
+        0x1.188496ab36ecfp-10,
+        0x1.1837d31f0f3p-10,
+        0x1.17eb398abab42p-10,
+        0x1.179ec9cbd821ep-10,
+        0x1.175283c02ba4ep-10,
+        0x1.170667459eb9p-10,
+        0x1.16ba743a3ff75p-10,
+        0x1.166eaa7c42e39p-10,
+        0x1.162309e9ffba7p-10,
+        0x1.15d79261f33f6p-10,
+        0x1.158c43c2be8b1p-10,
+        0x1.15411deb26da8p-10,
+        0x1.14f620ba155ep-10,
+        0x1.14ab4c0e97088p-10,
+        0x1.14609fc7dc5f9p-10,
+        0x1.14161bc5394b1p-10,
+        0x1.13cbbfe624e6p-10,
+        0x1.13818c0a394ebp-10,
+        0x1.133780113378p-10,
+        0x1.12ed9bdaf2fa8p-10,
+        0x1.12a3df4779e6p-10,
+        0x1.125a4a36ec936p-10,
+        0x1.1210dc899176bp-10,
+        0x1.11c7961fd0f1bp-10,
+        0x1.117e76da35265p-10,
+        0x1.11357e9969c9dp-10,
+        0x1.10ecad3e3bf8p-10,
+        0x1.10a402a99a06bp-10,
+        0x1.105b7ebc93598p-10,
+        0x1.1013215858363p-10,
+        0x1.0fcaea5e3998cp-10,
+        0x1.0f82d9afa9081p-10,
+        0x1.0f3aef2e386bp-10,
+        0x1.0ef32abb99dd5p-10,
+        0x1.0eab8c399f856p-10,
+        0x1.0e64138a3b698p-10,
+        0x1.0e1cc08f7f465p-10,
+        0x1.0dd5932b9c64bp-10,
+        0x1.0d8e8b40e3704p-10,
+        0x1.0d47a8b1c44e6p-10,
+        0x1.0d00eb60cdf4bp-10,
+        0x1.0cba5330ae40dp-10,
+        0x1.0c73e00431cf8p-10,
+        0x1.0c2d91be43d48p-10,
+        0x1.0be76841edf2bp-10,
+        0x1.0ba163725813ep-10,
+        0x1.0b5b8332c841dp-10,
+        0x1.0b15c766a27e8p-10,
+        0x1.0ad02ff1689d6p-10,
+        0x1.0a8abcb6ba1c6p-10,
+        0x1.0a456d9a53fd6p-10,
+        0x1.0a00428010ap-10,
+        0x1.09bb3b4be79b5p-10,
+        0x1.097657e1ed981p-10,
+        0x1.09319826542bp-10,
+        0x1.08ecfbfd69af9p-10,
+        0x1.08a8834b99228p-10,
+        0x1.08642df569fd3p-10,
+        0x1.081ffbdf80108p-10,
+        0x1.07dbecee9b60cp-10,
+        0x1.079801079801p-10,
+        0x1.0754380f6def5p-10,
+        0x1.071091eb30f07p-10,
+        0x1.06cd0e80106cdp-10,
+        0x1.0689adb3574c8p-10,
+        0x1.06466f6a6bd47p-10,
+        0x1.0603538acf832p-10,
+        0x1.05c059fa1eeep-10,
+        0x1.057d829e119ebp-10,
+        0x1.053acd5c79f0fp-10,
+        0x1.04f83a1b44f01p-10,
+        0x1.04b5c8c07a353p-10,
+        0x1.047379323bc58p-10,
+        0x1.04314b56c5f08p-10,
+        0x1.03ef3f146f2edp-10,
+        0x1.03ad5451a801p-10,
+        0x1.036b8af4face8p-10,
+        0x1.0329e2e50bc4cp-10,
+        0x1.02e85c0898b71p-10,
+        0x1.02a6f64678fdap-10,
+        0x1.0265b1859d55bp-10,
+        0x1.02248dad0fc18p-10,
+        0x1.01e38aa3f3686p-10,
+        0x1.01a2a85184774p-10,
+        0x1.0161e69d1801p-10,
+        0x1.0121456e1bdf6p-10,
+        0x1.00e0c4ac1693cp-10,
+        0x1.00a0643ea7288p-10,
+        0x1.0060240d8511ep-10,
+        0x1.00200400801p-10,
+        0x1.ffc007ff002p-11,
+    };
+};
+
+template <>
+class cpp_gen_multiplier_table<jefferson> final
+{
+public:
+    static constexpr uint32_t MAX_NUM_REPS = 1024;
+    static constexpr double VALUES[MAX_NUM_REPS + 1] = {
+        0.0,
+        0x1p-1,
+        0x1.5555555555555p-2,
+        0x1p-2,
+        0x1.999999999999ap-3,
+        0x1.5555555555555p-3,
+        0x1.2492492492492p-3,
+        0x1p-3,
+        0x1.c71c71c71c71cp-4,
+        0x1.999999999999ap-4,
+        0x1.745d1745d1746p-4,
+        0x1.5555555555555p-4,
+        0x1.3b13b13b13b14p-4,
+        0x1.2492492492492p-4,
+        0x1.1111111111111p-4,
+        0x1p-4,
+        0x1.e1e1e1e1e1e1ep-5,
+        0x1.c71c71c71c71cp-5,
+        0x1.af286bca1af28p-5,
+        0x1.999999999999ap-5,
+        0x1.8618618618618p-5,
+        0x1.745d1745d1746p-5,
+        0x1.642c8590b2164p-5,
+        0x1.5555555555555p-5,
+        0x1.47ae147ae147bp-5,
+        0x1.3b13b13b13b14p-5,
+        0x1.2f684bda12f68p-5,
+        0x1.2492492492492p-5,
+        0x1.1a7b9611a7b96p-5,
+        0x1.1111111111111p-5,
+        0x1.0842108421084p-5,
+        0x1p-5,
+        0x1.f07c1f07c1f08p-6,
+        0x1.e1e1e1e1e1e1ep-6,
+        0x1.d41d41d41d41dp-6,
+        0x1.c71c71c71c71cp-6,
+        0x1.bacf914c1badp-6,
+        0x1.af286bca1af28p-6,
+        0x1.a41a41a41a41ap-6,
+        0x1.999999999999ap-6,
+        0x1.8f9c18f9c18fap-6,
+        0x1.8618618618618p-6,
+        0x1.7d05f417d05f4p-6,
+        0x1.745d1745d1746p-6,
+        0x1.6c16c16c16c17p-6,
+        0x1.642c8590b2164p-6,
+        0x1.5c9882b931057p-6,
+        0x1.5555555555555p-6,
+        0x1.4e5e0a72f0539p-6,
+        0x1.47ae147ae147bp-6,
+        0x1.4141414141414p-6,
+        0x1.3b13b13b13b14p-6,
+        0x1.3521cfb2b78c1p-6,
+        0x1.2f684bda12f68p-6,
+        0x1.29e4129e4129ep-6,
+        0x1.2492492492492p-6,
+        0x1.1f7047dc11f7p-6,
+        0x1.1a7b9611a7b96p-6,
+        0x1.15b1e5f75270dp-6,
+        0x1.1111111111111p-6,
+        0x1.0c9714fbcda3bp-6,
+        0x1.0842108421084p-6,
+        0x1.041041041041p-6,
+        0x1p-6,
+        0x1.f81f81f81f82p-7,
+        0x1.f07c1f07c1f08p-7,
+        0x1.e9131abf0b767p-7,
+        0x1.e1e1e1e1e1e1ep-7,
+        0x1.dae6076b981dbp-7,
+        0x1.d41d41d41d41dp-7,
+        0x1.cd85689039b0bp-7,
+        0x1.c71c71c71c71cp-7,
+        0x1.c0e070381c0ep-7,
+        0x1.bacf914c1badp-7,
+        0x1.b4e81b4e81b4fp-7,
+        0x1.af286bca1af28p-7,
+        0x1.a98ef606a63bep-7,
+        0x1.a41a41a41a41ap-7,
+        0x1.9ec8e951033d9p-7,
+        0x1.999999999999ap-7,
+        0x1.948b0fcd6e9ep-7,
+        0x1.8f9c18f9c18fap-7,
+        0x1.8acb90f6bf3aap-7,
+        0x1.8618618618618p-7,
+        0x1.8181818181818p-7,
+        0x1.7d05f417d05f4p-7,
+        0x1.78a4c8178a4c8p-7,
+        0x1.745d1745d1746p-7,
+        0x1.702e05c0b817p-7,
+        0x1.6c16c16c16c17p-7,
+        0x1.6816816816817p-7,
+        0x1.642c8590b2164p-7,
+        0x1.6058160581606p-7,
+        0x1.5c9882b931057p-7,
+        0x1.58ed2308158edp-7,
+        0x1.5555555555555p-7,
+        0x1.51d07eae2f815p-7,
+        0x1.4e5e0a72f0539p-7,
+        0x1.4afd6a052bf5bp-7,
+        0x1.47ae147ae147bp-7,
+        0x1.446f86562d9fbp-7,
+        0x1.4141414141414p-7,
+        0x1.3e22cbce4a902p-7,
+        0x1.3b13b13b13b14p-7,
+        0x1.3813813813814p-7,
+        0x1.3521cfb2b78c1p-7,
+        0x1.323e34a2b10bfp-7,
+        0x1.2f684bda12f68p-7,
+        0x1.2c9fb4d812cap-7,
+        0x1.29e4129e4129ep-7,
+        0x1.27350b8812735p-7,
+        0x1.2492492492492p-7,
+        0x1.21fb78121fb78p-7,
+        0x1.1f7047dc11f7p-7,
+        0x1.1cf06ada2811dp-7,
+        0x1.1a7b9611a7b96p-7,
+        0x1.1811811811812p-7,
+        0x1.15b1e5f75270dp-7,
+        0x1.135c81135c811p-7,
+        0x1.1111111111111p-7,
+        0x1.0ecf56be69c9p-7,
+        0x1.0c9714fbcda3bp-7,
+        0x1.0a6810a6810a7p-7,
+        0x1.0842108421084p-7,
+        0x1.0624dd2f1a9fcp-7,
+        0x1.041041041041p-7,
+        0x1.0204081020408p-7,
+        0x1p-7,
+        0x1.fc07f01fc07fp-8,
+        0x1.f81f81f81f82p-8,
+        0x1.f44659e4a4271p-8,
+        0x1.f07c1f07c1f08p-8,
+        0x1.ecc07b301eccp-8,
+        0x1.e9131abf0b767p-8,
+        0x1.e573ac901e574p-8,
+        0x1.e1e1e1e1e1e1ep-8,
+        0x1.de5d6e3f8868ap-8,
+        0x1.dae6076b981dbp-8,
+        0x1.d77b654b82c34p-8,
+        0x1.d41d41d41d41dp-8,
+        0x1.d0cb58f6ec074p-8,
+        0x1.cd85689039b0bp-8,
+        0x1.ca4b3055ee191p-8,
+        0x1.c71c71c71c71cp-8,
+        0x1.c3f8f01c3f8fp-8,
+        0x1.c0e070381c0ep-8,
+        0x1.bdd2b899406f7p-8,
+        0x1.bacf914c1badp-8,
+        0x1.b7d6c3dda338bp-8,
+        0x1.b4e81b4e81b4fp-8,
+        0x1.b2036406c80d9p-8,
+        0x1.af286bca1af28p-8,
+        0x1.ac5701ac5701bp-8,
+        0x1.a98ef606a63bep-8,
+        0x1.a6d01a6d01a6dp-8,
+        0x1.a41a41a41a41ap-8,
+        0x1.a16d3f97a4b02p-8,
+        0x1.9ec8e951033d9p-8,
+        0x1.9c2d14ee4a102p-8,
+        0x1.999999999999ap-8,
+        0x1.970e4f80cb872p-8,
+        0x1.948b0fcd6e9ep-8,
+        0x1.920fb49d0e229p-8,
+        0x1.8f9c18f9c18fap-8,
+        0x1.8d3018d3018d3p-8,
+        0x1.8acb90f6bf3aap-8,
+        0x1.886e5f0abb04ap-8,
+        0x1.8618618618618p-8,
+        0x1.83c977ab2beddp-8,
+        0x1.8181818181818p-8,
+        0x1.7f405fd017f4p-8,
+        0x1.7d05f417d05f4p-8,
+        0x1.7ad2208e0ecc3p-8,
+        0x1.78a4c8178a4c8p-8,
+        0x1.767dce434a9b1p-8,
+        0x1.745d1745d1746p-8,
+        0x1.724287f46debcp-8,
+        0x1.702e05c0b817p-8,
+        0x1.6e1f76b4337c7p-8,
+        0x1.6c16c16c16c17p-8,
+        0x1.6a13cd153729p-8,
+        0x1.6816816816817p-8,
+        0x1.661ec6a5122f9p-8,
+        0x1.642c8590b2164p-8,
+        0x1.623fa7701624p-8,
+        0x1.6058160581606p-8,
+        0x1.5e75bb8d015e7p-8,
+        0x1.5c9882b931057p-8,
+        0x1.5ac056b015acp-8,
+        0x1.58ed2308158edp-8,
+        0x1.571ed3c506b3ap-8,
+        0x1.5555555555555p-8,
+        0x1.5390948f40febp-8,
+        0x1.51d07eae2f815p-8,
+        0x1.5015015015015p-8,
+        0x1.4e5e0a72f0539p-8,
+        0x1.4cab88725af6ep-8,
+        0x1.4afd6a052bf5bp-8,
+        0x1.49539e3b2d067p-8,
+        0x1.47ae147ae147bp-8,
+        0x1.460cbc7f5cf9ap-8,
+        0x1.446f86562d9fbp-8,
+        0x1.42d6625d51f87p-8,
+        0x1.4141414141414p-8,
+        0x1.3fb013fb013fbp-8,
+        0x1.3e22cbce4a902p-8,
+        0x1.3c995a47babe7p-8,
+        0x1.3b13b13b13b14p-8,
+        0x1.3991c2c187f63p-8,
+        0x1.3813813813814p-8,
+        0x1.3698df3de0748p-8,
+        0x1.3521cfb2b78c1p-8,
+        0x1.33ae45b57bcb2p-8,
+        0x1.323e34a2b10bfp-8,
+        0x1.30d190130d19p-8,
+        0x1.2f684bda12f68p-8,
+        0x1.2e025c04b8097p-8,
+        0x1.2c9fb4d812cap-8,
+        0x1.2b404ad012b4p-8,
+        0x1.29e4129e4129ep-8,
+        0x1.288b01288b013p-8,
+        0x1.27350b8812735p-8,
+        0x1.25e22708092f1p-8,
+        0x1.2492492492492p-8,
+        0x1.23456789abcdfp-8,
+        0x1.21fb78121fb78p-8,
+        0x1.20b470c67c0d9p-8,
+        0x1.1f7047dc11f7p-8,
+        0x1.1e2ef3b3fb874p-8,
+        0x1.1cf06ada2811dp-8,
+        0x1.1bb4a4046ed29p-8,
+        0x1.1a7b9611a7b96p-8,
+        0x1.19453808ca29cp-8,
+        0x1.1811811811812p-8,
+        0x1.16e0689427379p-8,
+        0x1.15b1e5f75270dp-8,
+        0x1.1485f0e0acd3bp-8,
+        0x1.135c81135c811p-8,
+        0x1.12358e75d3033p-8,
+        0x1.1111111111111p-8,
+        0x1.0fef010fef011p-8,
+        0x1.0ecf56be69c9p-8,
+        0x1.0db20a88f4696p-8,
+        0x1.0c9714fbcda3bp-8,
+        0x1.0b7e6ec259dc8p-8,
+        0x1.0a6810a6810a7p-8,
+        0x1.0953f39010954p-8,
+        0x1.0842108421084p-8,
+        0x1.073260a47f7c6p-8,
+        0x1.0624dd2f1a9fcp-8,
+        0x1.05197f7d73404p-8,
+        0x1.041041041041p-8,
+        0x1.03091b51f5e1ap-8,
+        0x1.0204081020408p-8,
+        0x1.010101010101p-8,
+        0x1p-8,
+        0x1.fe01fe01fe02p-9,
+        0x1.fc07f01fc07fp-9,
+        0x1.fa11caa01fa12p-9,
+        0x1.f81f81f81f82p-9,
+        0x1.f6310aca0dbb5p-9,
+        0x1.f44659e4a4271p-9,
+        0x1.f25f644230ab5p-9,
+        0x1.f07c1f07c1f08p-9,
+        0x1.ee9c7f8458e02p-9,
+        0x1.ecc07b301eccp-9,
+        0x1.eae807aba01ebp-9,
+        0x1.e9131abf0b767p-9,
+        0x1.e741aa59750e4p-9,
+        0x1.e573ac901e574p-9,
+        0x1.e3a9179dc1a73p-9,
+        0x1.e1e1e1e1e1e1ep-9,
+        0x1.e01e01e01e01ep-9,
+        0x1.de5d6e3f8868ap-9,
+        0x1.dca01dca01dcap-9,
+        0x1.dae6076b981dbp-9,
+        0x1.d92f2231e7f8ap-9,
+        0x1.d77b654b82c34p-9,
+        0x1.d5cac807572b2p-9,
+        0x1.d41d41d41d41dp-9,
+        0x1.d272ca3fc5b1ap-9,
+        0x1.d0cb58f6ec074p-9,
+        0x1.cf26e5c44bfc6p-9,
+        0x1.cd85689039b0bp-9,
+        0x1.cbe6d9601cbe7p-9,
+        0x1.ca4b3055ee191p-9,
+        0x1.c8b265afb8a42p-9,
+        0x1.c71c71c71c71cp-9,
+        0x1.c5894d10d4986p-9,
+        0x1.c3f8f01c3f8fp-9,
+        0x1.c26b5392ea01cp-9,
+        0x1.c0e070381c0ep-9,
+        0x1.bf583ee868d8bp-9,
+        0x1.bdd2b899406f7p-9,
+        0x1.bc4fd65883e7bp-9,
+        0x1.bacf914c1badp-9,
+        0x1.b951e2b18ff23p-9,
+        0x1.b7d6c3dda338bp-9,
+        0x1.b65e2e3beee05p-9,
+        0x1.b4e81b4e81b4fp-9,
+        0x1.b37484ad806cep-9,
+        0x1.b2036406c80d9p-9,
+        0x1.b094b31d922a4p-9,
+        0x1.af286bca1af28p-9,
+        0x1.adbe87f94905ep-9,
+        0x1.ac5701ac5701bp-9,
+        0x1.aaf1d2f87ebfdp-9,
+        0x1.a98ef606a63bep-9,
+        0x1.a82e65130e159p-9,
+        0x1.a6d01a6d01a6dp-9,
+        0x1.a574107688a4ap-9,
+        0x1.a41a41a41a41ap-9,
+        0x1.a2c2a87c51cap-9,
+        0x1.a16d3f97a4b02p-9,
+        0x1.a01a01a01a01ap-9,
+        0x1.9ec8e951033d9p-9,
+        0x1.9d79f176b682dp-9,
+        0x1.9c2d14ee4a102p-9,
+        0x1.9ae24ea5510dap-9,
+        0x1.999999999999ap-9,
+        0x1.9852f0d8ec0ffp-9,
+        0x1.970e4f80cb872p-9,
+        0x1.95cbb0be377aep-9,
+        0x1.948b0fcd6e9ep-9,
+        0x1.934c67f9b2ce6p-9,
+        0x1.920fb49d0e229p-9,
+        0x1.90d4f120190d5p-9,
+        0x1.8f9c18f9c18fap-9,
+        0x1.8e6527af1373fp-9,
+        0x1.8d3018d3018d3p-9,
+        0x1.8bfce8062ff3ap-9,
+        0x1.8acb90f6bf3aap-9,
+        0x1.899c0f601899cp-9,
+        0x1.886e5f0abb04ap-9,
+        0x1.87427bcc092b9p-9,
+        0x1.8618618618618p-9,
+        0x1.84f00c2780614p-9,
+        0x1.83c977ab2beddp-9,
+        0x1.82a4a0182a4ap-9,
+        0x1.8181818181818p-9,
+        0x1.8060180601806p-9,
+        0x1.7f405fd017f4p-9,
+        0x1.7e225515a4f1dp-9,
+        0x1.7d05f417d05f4p-9,
+        0x1.7beb3922e017cp-9,
+        0x1.7ad2208e0ecc3p-9,
+        0x1.79baa6bb6398bp-9,
+        0x1.78a4c8178a4c8p-9,
+        0x1.77908119ac60dp-9,
+        0x1.767dce434a9b1p-9,
+        0x1.756cac201756dp-9,
+        0x1.745d1745d1746p-9,
+        0x1.734f0c541fe8dp-9,
+        0x1.724287f46debcp-9,
+        0x1.713786d9c7c09p-9,
+        0x1.702e05c0b817p-9,
+        0x1.6f26016f26017p-9,
+        0x1.6e1f76b4337c7p-9,
+        0x1.6d1a62681c861p-9,
+        0x1.6c16c16c16c17p-9,
+        0x1.6b1490aa31a3dp-9,
+        0x1.6a13cd153729p-9,
+        0x1.691473a88d0cp-9,
+        0x1.6816816816817p-9,
+        0x1.6719f3601671ap-9,
+        0x1.661ec6a5122f9p-9,
+        0x1.6524f853b4aa3p-9,
+        0x1.642c8590b2164p-9,
+        0x1.63356b88ac0dep-9,
+        0x1.623fa7701624p-9,
+        0x1.614b36831ae94p-9,
+        0x1.6058160581606p-9,
+        0x1.5f66434292dfcp-9,
+        0x1.5e75bb8d015e7p-9,
+        0x1.5d867c3ece2a5p-9,
+        0x1.5c9882b931057p-9,
+        0x1.5babcc647fa91p-9,
+        0x1.5ac056b015acp-9,
+        0x1.59d61f123ccaap-9,
+        0x1.58ed2308158edp-9,
+        0x1.580560158056p-9,
+        0x1.571ed3c506b3ap-9,
+        0x1.56397ba7c52e2p-9,
+        0x1.5555555555555p-9,
+        0x1.54725e6bb82fep-9,
+        0x1.5390948f40febp-9,
+        0x1.52aff56a8054bp-9,
+        0x1.51d07eae2f815p-9,
+        0x1.50f22e111c4c5p-9,
+        0x1.5015015015015p-9,
+        0x1.4f38f62dd4c9bp-9,
+        0x1.4e5e0a72f0539p-9,
+        0x1.4d843bedc2c4cp-9,
+        0x1.4cab88725af6ep-9,
+        0x1.4bd3edda68fe1p-9,
+        0x1.4afd6a052bf5bp-9,
+        0x1.4a27fad76014ap-9,
+        0x1.49539e3b2d067p-9,
+        0x1.488052201488p-9,
+        0x1.47ae147ae147bp-9,
+        0x1.46dce34596066p-9,
+        0x1.460cbc7f5cf9ap-9,
+        0x1.453d9e2c776cap-9,
+        0x1.446f86562d9fbp-9,
+        0x1.43a2730abee4dp-9,
+        0x1.42d6625d51f87p-9,
+        0x1.420b5265e5951p-9,
+        0x1.4141414141414p-9,
+        0x1.40782d10e6566p-9,
+        0x1.3fb013fb013fbp-9,
+        0x1.3ee8f42a5af07p-9,
+        0x1.3e22cbce4a902p-9,
+        0x1.3d5d991aa75c6p-9,
+        0x1.3c995a47babe7p-9,
+        0x1.3bd60d9232955p-9,
+        0x1.3b13b13b13b14p-9,
+        0x1.3a524387ac822p-9,
+        0x1.3991c2c187f63p-9,
+        0x1.38d22d366088ep-9,
+        0x1.3813813813814p-9,
+        0x1.3755bd1c945eep-9,
+        0x1.3698df3de0748p-9,
+        0x1.35dce5f9f2af8p-9,
+        0x1.3521cfb2b78c1p-9,
+        0x1.34679ace01346p-9,
+        0x1.33ae45b57bcb2p-9,
+        0x1.32f5ced6a1dfap-9,
+        0x1.323e34a2b10bfp-9,
+        0x1.3187758e9ebb6p-9,
+        0x1.30d190130d19p-9,
+        0x1.301c82ac4026p-9,
+        0x1.2f684bda12f68p-9,
+        0x1.2eb4ea1fed14bp-9,
+        0x1.2e025c04b8097p-9,
+        0x1.2d50a012d50ap-9,
+        0x1.2c9fb4d812cap-9,
+        0x1.2bef98e5a3711p-9,
+        0x1.2b404ad012b4p-9,
+        0x1.2a91c92f3c105p-9,
+        0x1.29e4129e4129ep-9,
+        0x1.293725bb804a5p-9,
+        0x1.288b01288b013p-9,
+        0x1.27dfa38a1ce4dp-9,
+        0x1.27350b8812735p-9,
+        0x1.268b37cd60127p-9,
+        0x1.25e22708092f1p-9,
+        0x1.2539d7e9177b2p-9,
+        0x1.2492492492492p-9,
+        0x1.23eb79717605bp-9,
+        0x1.23456789abcdfp-9,
+        0x1.22a0122a0122ap-9,
+        0x1.21fb78121fb78p-9,
+        0x1.21579804855e6p-9,
+        0x1.20b470c67c0d9p-9,
+        0x1.2012012012012p-9,
+        0x1.1f7047dc11f7p-9,
+        0x1.1ecf43c7fb84cp-9,
+        0x1.1e2ef3b3fb874p-9,
+        0x1.1d8f5672e4abdp-9,
+        0x1.1cf06ada2811dp-9,
+        0x1.1c522fc1ce059p-9,
+        0x1.1bb4a4046ed29p-9,
+        0x1.1b17c67f2bae3p-9,
+        0x1.1a7b9611a7b96p-9,
+        0x1.19e0119e0119ep-9,
+        0x1.19453808ca29cp-9,
+        0x1.18ab083902bdbp-9,
+        0x1.1811811811812p-9,
+        0x1.1778a191bd684p-9,
+        0x1.16e0689427379p-9,
+        0x1.1648d50fc3201p-9,
+        0x1.15b1e5f75270dp-9,
+        0x1.151b9a3fdd5c9p-9,
+        0x1.1485f0e0acd3bp-9,
+        0x1.13f0e8d344724p-9,
+        0x1.135c81135c811p-9,
+        0x1.12c8b89edc0acp-9,
+        0x1.12358e75d3033p-9,
+        0x1.11a3019a74826p-9,
+        0x1.1111111111111p-9,
+        0x1.107fbbe01108p-9,
+        0x1.0fef010fef011p-9,
+        0x1.0f5edfab325a2p-9,
+        0x1.0ecf56be69c9p-9,
+        0x1.0e40655826011p-9,
+        0x1.0db20a88f4696p-9,
+        0x1.0d24456359e3ap-9,
+        0x1.0c9714fbcda3bp-9,
+        0x1.0c0a7868b4171p-9,
+        0x1.0b7e6ec259dc8p-9,
+        0x1.0af2f722eecb5p-9,
+        0x1.0a6810a6810a7p-9,
+        0x1.09ddba6af836p-9,
+        0x1.0953f39010954p-9,
+        0x1.08cabb37565e2p-9,
+        0x1.0842108421084p-9,
+        0x1.07b9f29b8eae2p-9,
+        0x1.073260a47f7c6p-9,
+        0x1.06ab59c7912fbp-9,
+        0x1.0624dd2f1a9fcp-9,
+        0x1.059eea0727586p-9,
+        0x1.05197f7d73404p-9,
+        0x1.04949cc1664c5p-9,
+        0x1.041041041041p-9,
+        0x1.038c6b78247fcp-9,
+        0x1.03091b51f5e1ap-9,
+        0x1.02864fc7729e9p-9,
+        0x1.0204081020408p-9,
+        0x1.0182436517a37p-9,
+        0x1.010101010101p-9,
+        0x1.008040201008p-9,
+        0x1p-9,
+        0x1.ff007fc01ffp-10,
+        0x1.fe01fe01fe02p-10,
+        0x1.fd04794a10e6ap-10,
+        0x1.fc07f01fc07fp-10,
+        0x1.fb0c610d5e939p-10,
+        0x1.fa11caa01fa12p-10,
+        0x1.f9182b6813bafp-10,
+        0x1.f81f81f81f82p-10,
+        0x1.f727cce5f530ap-10,
+        0x1.f6310aca0dbb5p-10,
+        0x1.f53b3a3fa204ep-10,
+        0x1.f44659e4a4271p-10,
+        0x1.f3526859b8cecp-10,
+        0x1.f25f644230ab5p-10,
+        0x1.f16d4c4401f17p-10,
+        0x1.f07c1f07c1f08p-10,
+        0x1.ef8bdb389ebadp-10,
+        0x1.ee9c7f8458e02p-10,
+        0x1.edae0a9b3d3a5p-10,
+        0x1.ecc07b301eccp-10,
+        0x1.ebd3cff850b0cp-10,
+        0x1.eae807aba01ebp-10,
+        0x1.e9fd21044e799p-10,
+        0x1.e9131abf0b767p-10,
+        0x1.e829f39aef509p-10,
+        0x1.e741aa59750e4p-10,
+        0x1.e65a3dbe74d6bp-10,
+        0x1.e573ac901e574p-10,
+        0x1.e48df596f3394p-10,
+        0x1.e3a9179dc1a73p-10,
+        0x1.e2c511719ee16p-10,
+        0x1.e1e1e1e1e1e1ep-10,
+        0x1.e0ff87c01e1p-10,
+        0x1.e01e01e01e01ep-10,
+        0x1.df3d4f17de4dbp-10,
+        0x1.de5d6e3f8868ap-10,
+        0x1.dd7e5e316d94cp-10,
+        0x1.dca01dca01dcap-10,
+        0x1.dbc2abe7d71d4p-10,
+        0x1.dae6076b981dbp-10,
+        0x1.da0a2f3803b41p-10,
+        0x1.d92f2231e7f8ap-10,
+        0x1.d854df401d855p-10,
+        0x1.d77b654b82c34p-10,
+        0x1.d6a2b33ef7448p-10,
+        0x1.d5cac807572b2p-10,
+        0x1.d4f3a293769cap-10,
+        0x1.d41d41d41d41dp-10,
+        0x1.d347a4bc01d34p-10,
+        0x1.d272ca3fc5b1ap-10,
+        0x1.d19eb155f08a4p-10,
+        0x1.d0cb58f6ec074p-10,
+        0x1.cff8c01cff8cp-10,
+        0x1.cf26e5c44bfc6p-10,
+        0x1.ce55c8eac79p-10,
+        0x1.cd85689039b0bp-10,
+        0x1.ccb5c3b636e3ap-10,
+        0x1.cbe6d9601cbe7p-10,
+        0x1.cb18a8930de6p-10,
+        0x1.ca4b3055ee191p-10,
+        0x1.c97e6fb15e44dp-10,
+        0x1.c8b265afb8a42p-10,
+        0x1.c7e7115d0ce95p-10,
+        0x1.c71c71c71c71cp-10,
+        0x1.c65285fd56843p-10,
+        0x1.c5894d10d4986p-10,
+        0x1.c4c0c61456a8ep-10,
+        0x1.c3f8f01c3f8fp-10,
+        0x1.c331ca3e91679p-10,
+        0x1.c26b5392ea01cp-10,
+        0x1.c1a58b327f576p-10,
+        0x1.c0e070381c0ep-10,
+        0x1.c01c01c01c01cp-10,
+        0x1.bf583ee868d8bp-10,
+        0x1.be9526d0769fap-10,
+        0x1.bdd2b899406f7p-10,
+        0x1.bd10f365451b6p-10,
+        0x1.bc4fd65883e7bp-10,
+        0x1.bb8f609879493p-10,
+        0x1.bacf914c1badp-10,
+        0x1.ba10679bd8488p-10,
+        0x1.b951e2b18ff23p-10,
+        0x1.b89401b89401cp-10,
+        0x1.b7d6c3dda338bp-10,
+        0x1.b71a284ee6b34p-10,
+        0x1.b65e2e3beee05p-10,
+        0x1.b5a2d4d5b081fp-10,
+        0x1.b4e81b4e81b4fp-10,
+        0x1.b42e00da17007p-10,
+        0x1.b37484ad806cep-10,
+        0x1.b2bba5ff26a23p-10,
+        0x1.b2036406c80d9p-10,
+        0x1.b14bbdfd760e6p-10,
+        0x1.b094b31d922a4p-10,
+        0x1.afde42a2cb482p-10,
+        0x1.af286bca1af28p-10,
+        0x1.ae732dd1c2a09p-10,
+        0x1.adbe87f94905ep-10,
+        0x1.ad0a798177693p-10,
+        0x1.ac5701ac5701bp-10,
+        0x1.aba41fbd2e5b1p-10,
+        0x1.aaf1d2f87ebfdp-10,
+        0x1.aa401aa401aa4p-10,
+        0x1.a98ef606a63bep-10,
+        0x1.a8de64688ebabp-10,
+        0x1.a82e65130e159p-10,
+        0x1.a77ef750a56dap-10,
+        0x1.a6d01a6d01a6dp-10,
+        0x1.a621cdb4f8fdfp-10,
+        0x1.a574107688a4ap-10,
+        0x1.a4c6e200d2637p-10,
+        0x1.a41a41a41a41ap-10,
+        0x1.a36e2eb1c432dp-10,
+        0x1.a2c2a87c51cap-10,
+        0x1.a217ae575ff2fp-10,
+        0x1.a16d3f97a4b02p-10,
+        0x1.a0c35b92ecdf1p-10,
+        0x1.a01a01a01a01ap-10,
+        0x1.9f713117200dp-10,
+        0x1.9ec8e951033d9p-10,
+        0x1.9e2129a7d5f0ap-10,
+        0x1.9d79f176b682dp-10,
+        0x1.9cd34019cd34p-10,
+        0x1.9c2d14ee4a102p-10,
+        0x1.9b876f5262dd1p-10,
+        0x1.9ae24ea5510dap-10,
+        0x1.9a3db2474fb98p-10,
+        0x1.999999999999ap-10,
+        0x1.98f603fe670ap-10,
+        0x1.9852f0d8ec0ffp-10,
+        0x1.97b05f8d56652p-10,
+        0x1.970e4f80cb872p-10,
+        0x1.966cc01966ccp-10,
+        0x1.95cbb0be377aep-10,
+        0x1.952b20d73ee97p-10,
+        0x1.948b0fcd6e9ep-10,
+        0x1.93eb7d0aa6759p-10,
+        0x1.934c67f9b2ce6p-10,
+        0x1.92add0064ab74p-10,
+        0x1.920fb49d0e229p-10,
+        0x1.9172152b841ddp-10,
+        0x1.90d4f120190d5p-10,
+        0x1.903847ea1cec1p-10,
+        0x1.8f9c18f9c18fap-10,
+        0x1.8f0063c018fp-10,
+        0x1.8e6527af1373fp-10,
+        0x1.8dca64397e408p-10,
+        0x1.8d3018d3018d3p-10,
+        0x1.8c9644f01efbcp-10,
+        0x1.8bfce8062ff3ap-10,
+        0x1.8b64018b64019p-10,
+        0x1.8acb90f6bf3aap-10,
+        0x1.8a3395c018a34p-10,
+        0x1.899c0f601899cp-10,
+        0x1.8904fd503744bp-10,
+        0x1.886e5f0abb04ap-10,
+        0x1.87d8340ab6e97p-10,
+        0x1.87427bcc092b9p-10,
+        0x1.86ad35cb59a84p-10,
+        0x1.8618618618618p-10,
+        0x1.8583fe7a7c018p-10,
+        0x1.84f00c2780614p-10,
+        0x1.845c8a0ce5129p-10,
+        0x1.83c977ab2beddp-10,
+        0x1.8336d48397a24p-10,
+        0x1.82a4a0182a4ap-10,
+        0x1.8212d9eba4018p-10,
+        0x1.8181818181818p-10,
+        0x1.80f0965dfabcbp-10,
+        0x1.8060180601806p-10,
+        0x1.7fd005ff4018p-10,
+        0x1.7f405fd017f4p-10,
+        0x1.7eb124ffa053bp-10,
+        0x1.7e225515a4f1dp-10,
+        0x1.7d93ef9aa4b46p-10,
+        0x1.7d05f417d05f4p-10,
+        0x1.7c7862170949fp-10,
+        0x1.7beb3922e017cp-10,
+        0x1.7b5e78c693733p-10,
+        0x1.7ad2208e0ecc3p-10,
+        0x1.7a463005e918cp-10,
+        0x1.79baa6bb6398bp-10,
+        0x1.792f843c689c3p-10,
+        0x1.78a4c8178a4c8p-10,
+        0x1.781a71dc01782p-10,
+        0x1.77908119ac60dp-10,
+        0x1.7706f5610d8dp-10,
+        0x1.767dce434a9b1p-10,
+        0x1.75f50b522b17cp-10,
+        0x1.756cac201756dp-10,
+        0x1.74e4b040174e5p-10,
+        0x1.745d1745d1746p-10,
+        0x1.73d5e0c5899f7p-10,
+        0x1.734f0c541fe8dp-10,
+        0x1.72c899870f91fp-10,
+        0x1.724287f46debcp-10,
+        0x1.71bcd732e940ap-10,
+        0x1.713786d9c7c09p-10,
+        0x1.70b29680e66fap-10,
+        0x1.702e05c0b817p-10,
+        0x1.6fa9d4324438p-10,
+        0x1.6f26016f26017p-10,
+        0x1.6ea28d118b474p-10,
+        0x1.6e1f76b4337c7p-10,
+        0x1.6d9cbdf26eaefp-10,
+        0x1.6d1a62681c861p-10,
+        0x1.6c9863b1ab429p-10,
+        0x1.6c16c16c16c17p-10,
+        0x1.6b957b34e7803p-10,
+        0x1.6b1490aa31a3dp-10,
+        0x1.6a94016a94017p-10,
+        0x1.6a13cd153729p-10,
+        0x1.6993f349cc726p-10,
+        0x1.691473a88d0cp-10,
+        0x1.68954dd2390bap-10,
+        0x1.6816816816817p-10,
+        0x1.67980e0bf08c7p-10,
+        0x1.6719f3601671ap-10,
+        0x1.669c31075ab4p-10,
+        0x1.661ec6a5122f9p-10,
+        0x1.65a1b3dd13357p-10,
+        0x1.6524f853b4aa3p-10,
+        0x1.64a893adcd25fp-10,
+        0x1.642c8590b2164p-10,
+        0x1.63b0cda236e1cp-10,
+        0x1.63356b88ac0dep-10,
+        0x1.62ba5eeade65ep-10,
+        0x1.623fa7701624p-10,
+        0x1.61c544c0161c5p-10,
+        0x1.614b36831ae94p-10,
+        0x1.60d17c61da198p-10,
+        0x1.6058160581606p-10,
+        0x1.5fdf0317b5c6fp-10,
+        0x1.5f66434292dfcp-10,
+        0x1.5eedd630a9fb3p-10,
+        0x1.5e75bb8d015e7p-10,
+        0x1.5dfdf303137b6p-10,
+        0x1.5d867c3ece2a5p-10,
+        0x1.5d0f56ec91e57p-10,
+        0x1.5c9882b931057p-10,
+        0x1.5c21ff51ef005p-10,
+        0x1.5babcc647fa91p-10,
+        0x1.5b35e99f06714p-10,
+        0x1.5ac056b015acp-10,
+        0x1.5a4b1346add2bp-10,
+        0x1.59d61f123ccaap-10,
+        0x1.596179c29d2cep-10,
+        0x1.58ed2308158edp-10,
+        0x1.58791a9357ccep-10,
+        0x1.580560158056p-10,
+        0x1.5791f34015792p-10,
+        0x1.571ed3c506b3ap-10,
+        0x1.56ac0156ac015p-10,
+        0x1.56397ba7c52e2p-10,
+        0x1.55c7426b79286p-10,
+        0x1.5555555555555p-10,
+        0x1.54e3b4194ce66p-10,
+        0x1.54725e6bb82fep-10,
+        0x1.5401540154015p-10,
+        0x1.5390948f40febp-10,
+        0x1.53201fcb02fb1p-10,
+        0x1.52aff56a8054bp-10,
+        0x1.5240152401524p-10,
+        0x1.51d07eae2f815p-10,
+        0x1.516131c015161p-10,
+        0x1.50f22e111c4c5p-10,
+        0x1.508373590ec9cp-10,
+        0x1.5015015015015p-10,
+        0x1.4fa6d7aeb597cp-10,
+        0x1.4f38f62dd4c9bp-10,
+        0x1.4ecb5c86b3d24p-10,
+        0x1.4e5e0a72f0539p-10,
+        0x1.4df0ffac83c01p-10,
+        0x1.4d843bedc2c4cp-10,
+        0x1.4d17bef15cb4ep-10,
+        0x1.4cab88725af6ep-10,
+        0x1.4c3f982c20723p-10,
+        0x1.4bd3edda68fe1p-10,
+        0x1.4b68893948d1cp-10,
+        0x1.4afd6a052bf5bp-10,
+        0x1.4a928ffad5b5cp-10,
+        0x1.4a27fad76014ap-10,
+        0x1.49bdaa583b401p-10,
+        0x1.49539e3b2d067p-10,
+        0x1.48e9d63e504d1p-10,
+        0x1.488052201488p-10,
+        0x1.4817119f3d325p-10,
+        0x1.47ae147ae147bp-10,
+        0x1.47455a726abf2p-10,
+        0x1.46dce34596066p-10,
+        0x1.4674aeb4717e9p-10,
+        0x1.460cbc7f5cf9ap-10,
+        0x1.45a50c670938fp-10,
+        0x1.453d9e2c776cap-10,
+        0x1.44d67190f8b43p-10,
+        0x1.446f86562d9fbp-10,
+        0x1.4408dc3e05b22p-10,
+        0x1.43a2730abee4dp-10,
+        0x1.433c4a7ee52b4p-10,
+        0x1.42d6625d51f87p-10,
+        0x1.4270ba692bc4dp-10,
+        0x1.420b5265e5951p-10,
+        0x1.41a62a173e821p-10,
+        0x1.4141414141414p-10,
+        0x1.40dc97a843ae8p-10,
+        0x1.40782d10e6566p-10,
+        0x1.4014014014014p-10,
+        0x1.3fb013fb013fbp-10,
+        0x1.3f4c65072bf74p-10,
+        0x1.3ee8f42a5af07p-10,
+        0x1.3e85c12a9d651p-10,
+        0x1.3e22cbce4a902p-10,
+        0x1.3dc013dc013dcp-10,
+        0x1.3d5d991aa75c6p-10,
+        0x1.3cfb5b51698ebp-10,
+        0x1.3c995a47babe7p-10,
+        0x1.3c3795c553afbp-10,
+        0x1.3bd60d9232955p-10,
+        0x1.3b74c1769aa5cp-10,
+        0x1.3b13b13b13b14p-10,
+        0x1.3ab2dca869b81p-10,
+        0x1.3a524387ac822p-10,
+        0x1.39f1e5a22f36ep-10,
+        0x1.3991c2c187f63p-10,
+        0x1.3931daaf8f721p-10,
+        0x1.38d22d366088ep-10,
+        0x1.3872ba2057e04p-10,
+        0x1.3813813813814p-10,
+        0x1.37b4824872744p-10,
+        0x1.3755bd1c945eep-10,
+        0x1.36f7317fd9212p-10,
+        0x1.3698df3de0748p-10,
+        0x1.363ac622898b1p-10,
+        0x1.35dce5f9f2af8p-10,
+        0x1.357f3e9078e5bp-10,
+        0x1.3521cfb2b78c1p-10,
+        0x1.34c4992d87fd9p-10,
+        0x1.34679ace01346p-10,
+        0x1.340ad461776d3p-10,
+        0x1.33ae45b57bcb2p-10,
+        0x1.3351ee97dbfc6p-10,
+        0x1.32f5ced6a1dfap-10,
+        0x1.3299e6401329ap-10,
+        0x1.323e34a2b10bfp-10,
+        0x1.31e2b9cd37dc2p-10,
+        0x1.3187758e9ebb6p-10,
+        0x1.312c67b6173eep-10,
+        0x1.30d190130d19p-10,
+        0x1.3076ee7525c2cp-10,
+        0x1.301c82ac4026p-10,
+        0x1.2fc24c8874486p-10,
+        0x1.2f684bda12f68p-10,
+        0x1.2f0e8071a5703p-10,
+        0x1.2eb4ea1fed14bp-10,
+        0x1.2e5b88b5e3104p-10,
+        0x1.2e025c04b8097p-10,
+        0x1.2da963ddd3cfbp-10,
+        0x1.2d50a012d50ap-10,
+        0x1.2cf8107590e67p-10,
+        0x1.2c9fb4d812cap-10,
+        0x1.2c478d0c9c013p-10,
+        0x1.2bef98e5a3711p-10,
+        0x1.2b97d835d548ep-10,
+        0x1.2b404ad012b4p-10,
+        0x1.2ae8f087718dp-10,
+        0x1.2a91c92f3c105p-10,
+        0x1.2a3ad49af0907p-10,
+        0x1.29e4129e4129ep-10,
+        0x1.298d830d1378p-10,
+        0x1.293725bb804a5p-10,
+        0x1.28e0fa7dd35a3p-10,
+        0x1.288b01288b013p-10,
+        0x1.2835399057efdp-10,
+        0x1.27dfa38a1ce4dp-10,
+        0x1.278a3eeaee65p-10,
+        0x1.27350b8812735p-10,
+        0x1.26e009370049cp-10,
+        0x1.268b37cd60127p-10,
+        0x1.263697210aa18p-10,
+        0x1.25e22708092f1p-10,
+        0x1.258de75895121p-10,
+        0x1.2539d7e9177b2p-10,
+        0x1.24e5f89029305p-10,
+        0x1.2492492492492p-10,
+        0x1.243ec97d49eaep-10,
+        0x1.23eb79717605bp-10,
+        0x1.239858d86b11fp-10,
+        0x1.23456789abcdfp-10,
+        0x1.22f2a55ce8fc5p-10,
+        0x1.22a0122a0122ap-10,
+        0x1.224dadc900489p-10,
+        0x1.21fb78121fb78p-10,
+        0x1.21a970ddc5ba7p-10,
+        0x1.21579804855e6p-10,
+        0x1.2105ed5f1e336p-10,
+        0x1.20b470c67c0d9p-10,
+        0x1.20632213b6c6dp-10,
+        0x1.2012012012012p-10,
+        0x1.1fc10dc4fce8bp-10,
+        0x1.1f7047dc11f7p-10,
+        0x1.1f1faf3f16b64p-10,
+        0x1.1ecf43c7fb84cp-10,
+        0x1.1e7f0550db594p-10,
+        0x1.1e2ef3b3fb874p-10,
+        0x1.1ddf0ecbcb841p-10,
+        0x1.1d8f5672e4abdp-10,
+        0x1.1d3fca840a074p-10,
+        0x1.1cf06ada2811dp-10,
+        0x1.1ca13750547fep-10,
+        0x1.1c522fc1ce059p-10,
+        0x1.1c035409fc1dfp-10,
+        0x1.1bb4a4046ed29p-10,
+        0x1.1b661f8cde833p-10,
+        0x1.1b17c67f2bae3p-10,
+        0x1.1ac998b75eb9p-10,
+        0x1.1a7b9611a7b96p-10,
+        0x1.1a2dbe6a5e3e4p-10,
+        0x1.19e0119e0119ep-10,
+        0x1.19928f89362b7p-10,
+        0x1.19453808ca29cp-10,
+        0x1.18f80af9b06dcp-10,
+        0x1.18ab083902bdbp-10,
+        0x1.185e2fa401186p-10,
+        0x1.1811811811812p-10,
+        0x1.17c4fc72bfcb9p-10,
+        0x1.1778a191bd684p-10,
+        0x1.172c7052e1316p-10,
+        0x1.16e0689427379p-10,
+        0x1.16948a33b08fap-10,
+        0x1.1648d50fc3201p-10,
+        0x1.15fd4906c96f1p-10,
+        0x1.15b1e5f75270dp-10,
+        0x1.1566abc011567p-10,
+        0x1.151b9a3fdd5c9p-10,
+        0x1.14d0b155b19aep-10,
+        0x1.1485f0e0acd3bp-10,
+        0x1.143b58c01143bp-10,
+        0x1.13f0e8d344724p-10,
+        0x1.13a6a0f9cf01ep-10,
+        0x1.135c81135c811p-10,
+        0x1.131288ffbb3b6p-10,
+        0x1.12c8b89edc0acp-10,
+        0x1.127f0fd0d2295p-10,
+        0x1.12358e75d3033p-10,
+        0x1.11ec346e36092p-10,
+        0x1.11a3019a74826p-10,
+        0x1.1159f5db29606p-10,
+        0x1.1111111111111p-10,
+        0x1.10c8531d0952ep-10,
+        0x1.107fbbe01108p-10,
+        0x1.10374b3b480aap-10,
+        0x1.0fef010fef011p-10,
+        0x1.0fa6dd3f67322p-10,
+        0x1.0f5edfab325a2p-10,
+        0x1.0f170834f27fap-10,
+        0x1.0ecf56be69c9p-10,
+        0x1.0e87cb297a51ep-10,
+        0x1.0e40655826011p-10,
+        0x1.0df9252c8e5e6p-10,
+        0x1.0db20a88f4696p-10,
+        0x1.0d6b154fb86f9p-10,
+        0x1.0d24456359e3ap-10,
+        0x1.0cdd9aa677344p-10,
+        0x1.0c9714fbcda3bp-10,
+        0x1.0c50b446391f3p-10,
+        0x1.0c0a7868b4171p-10,
+        0x1.0bc4614657569p-10,
+        0x1.0b7e6ec259dc8p-10,
+        0x1.0b38a0c010b39p-10,
+        0x1.0af2f722eecb5p-10,
+        0x1.0aad71ce84d16p-10,
+        0x1.0a6810a6810a7p-10,
+        0x1.0a22d38eaf2bfp-10,
+        0x1.09ddba6af836p-10,
+        0x1.0998c51f624d5p-10,
+        0x1.0953f39010954p-10,
+        0x1.090f45a1430aap-10,
+        0x1.08cabb37565e2p-10,
+        0x1.08865436c3cf7p-10,
+        0x1.0842108421084p-10,
+        0x1.07fdf0041ff7cp-10,
+        0x1.07b9f29b8eae2p-10,
+        0x1.0776182f57386p-10,
+        0x1.073260a47f7c6p-10,
+        0x1.06eecbe029155p-10,
+        0x1.06ab59c7912fbp-10,
+        0x1.06680a4010668p-10,
+        0x1.0624dd2f1a9fcp-10,
+        0x1.05e1d27a3ee9cp-10,
+        0x1.059eea0727586p-10,
+        0x1.055c23bb98e2ap-10,
+        0x1.05197f7d73404p-10,
+        0x1.04d6fd32b0c7bp-10,
+        0x1.04949cc1664c5p-10,
+        0x1.04525e0fc2fcbp-10,
+        0x1.041041041041p-10,
+        0x1.03ce4584b19ap-10,
+        0x1.038c6b78247fcp-10,
+        0x1.034ab2c50040dp-10,
+        0x1.03091b51f5e1ap-10,
+        0x1.02c7a505cffbfp-10,
+        0x1.02864fc7729e9p-10,
+        0x1.02451b7ddb2d2p-10,
+        0x1.0204081020408p-10,
+        0x1.01c315657186bp-10,
+        0x1.0182436517a37p-10,
+        0x1.014191f674111p-10,
+        0x1.010101010101p-10,
+        0x1.00c0906c513cfp-10,
+        0x1.008040201008p-10,
+        0x1.0040100401004p-10,
+        0x1p-10,
+        0x1.ff801ff801ff8p-11,
+    };
+};
+
+template <>
+class cpp_gen_multiplier_table<adams> final
+{
+public:
+    static constexpr uint32_t MAX_NUM_REPS = 1024;
+    static constexpr double VALUES[MAX_NUM_REPS + 1] = {
+        0.0,
+        0x1p+0,
+        0x1p-1,
+        0x1.5555555555555p-2,
+        0x1p-2,
+        0x1.999999999999ap-3,
+        0x1.5555555555555p-3,
+        0x1.2492492492492p-3,
+        0x1p-3,
+        0x1.c71c71c71c71cp-4,
+        0x1.999999999999ap-4,
+        0x1.745d1745d1746p-4,
+        0x1.5555555555555p-4,
+        0x1.3b13b13b13b14p-4,
+        0x1.2492492492492p-4,
+        0x1.1111111111111p-4,
+        0x1p-4,
+        0x1.e1e1e1e1e1e1ep-5,
+        0x1.c71c71c71c71cp-5,
+        0x1.af286bca1af28p-5,
+        0x1.999999999999ap-5,
+        0x1.8618618618618p-5,
+        0x1.745d1745d1746p-5,
+        0x1.642c8590b2164p-5,
+        0x1.5555555555555p-5,
+        0x1.47ae147ae147bp-5,
+        0x1.3b13b13b13b14p-5,
+        0x1.2f684bda12f68p-5,
+        0x1.2492492492492p-5,
+        0x1.1a7b9611a7b96p-5,
+        0x1.1111111111111p-5,
+        0x1.0842108421084p-5,
+        0x1p-5,
+        0x1.f07c1f07c1f08p-6,
+        0x1.e1e1e1e1e1e1ep-6,
+        0x1.d41d41d41d41dp-6,
+        0x1.c71c71c71c71cp-6,
+        0x1.bacf914c1badp-6,
+        0x1.af286bca1af28p-6,
+        0x1.a41a41a41a41ap-6,
+        0x1.999999999999ap-6,
+        0x1.8f9c18f9c18fap-6,
+        0x1.8618618618618p-6,
+        0x1.7d05f417d05f4p-6,
+        0x1.745d1745d1746p-6,
+        0x1.6c16c16c16c17p-6,
+        0x1.642c8590b2164p-6,
+        0x1.5c9882b931057p-6,
+        0x1.5555555555555p-6,
+        0x1.4e5e0a72f0539p-6,
+        0x1.47ae147ae147bp-6,
+        0x1.4141414141414p-6,
+        0x1.3b13b13b13b14p-6,
+        0x1.3521cfb2b78c1p-6,
+        0x1.2f684bda12f68p-6,
+        0x1.29e4129e4129ep-6,
+        0x1.2492492492492p-6,
+        0x1.1f7047dc11f7p-6,
+        0x1.1a7b9611a7b96p-6,
+        0x1.15b1e5f75270dp-6,
+        0x1.1111111111111p-6,
+        0x1.0c9714fbcda3bp-6,
+        0x1.0842108421084p-6,
+        0x1.041041041041p-6,
+        0x1p-6,
+        0x1.f81f81f81f82p-7,
+        0x1.f07c1f07c1f08p-7,
+        0x1.e9131abf0b767p-7,
+        0x1.e1e1e1e1e1e1ep-7,
+        0x1.dae6076b981dbp-7,
+        0x1.d41d41d41d41dp-7,
+        0x1.cd85689039b0bp-7,
+        0x1.c71c71c71c71cp-7,
+        0x1.c0e070381c0ep-7,
+        0x1.bacf914c1badp-7,
+        0x1.b4e81b4e81b4fp-7,
+        0x1.af286bca1af28p-7,
+        0x1.a98ef606a63bep-7,
+        0x1.a41a41a41a41ap-7,
+        0x1.9ec8e951033d9p-7,
+        0x1.999999999999ap-7,
+        0x1.948b0fcd6e9ep-7,
+        0x1.8f9c18f9c18fap-7,
+        0x1.8acb90f6bf3aap-7,
+        0x1.8618618618618p-7,
+        0x1.8181818181818p-7,
+        0x1.7d05f417d05f4p-7,
+        0x1.78a4c8178a4c8p-7,
+        0x1.745d1745d1746p-7,
+        0x1.702e05c0b817p-7,
+        0x1.6c16c16c16c17p-7,
+        0x1.6816816816817p-7,
+        0x1.642c8590b2164p-7,
+        0x1.6058160581606p-7,
+        0x1.5c9882b931057p-7,
+        0x1.58ed2308158edp-7,
+        0x1.5555555555555p-7,
+        0x1.51d07eae2f815p-7,
+        0x1.4e5e0a72f0539p-7,
+        0x1.4afd6a052bf5bp-7,
+        0x1.47ae147ae147bp-7,
+        0x1.446f86562d9fbp-7,
+        0x1.4141414141414p-7,
+        0x1.3e22cbce4a902p-7,
+        0x1.3b13b13b13b14p-7,
+        0x1.3813813813814p-7,
+        0x1.3521cfb2b78c1p-7,
+        0x1.323e34a2b10bfp-7,
+        0x1.2f684bda12f68p-7,
+        0x1.2c9fb4d812cap-7,
+        0x1.29e4129e4129ep-7,
+        0x1.27350b8812735p-7,
+        0x1.2492492492492p-7,
+        0x1.21fb78121fb78p-7,
+        0x1.1f7047dc11f7p-7,
+        0x1.1cf06ada2811dp-7,
+        0x1.1a7b9611a7b96p-7,
+        0x1.1811811811812p-7,
+        0x1.15b1e5f75270dp-7,
+        0x1.135c81135c811p-7,
+        0x1.1111111111111p-7,
+        0x1.0ecf56be69c9p-7,
+        0x1.0c9714fbcda3bp-7,
+        0x1.0a6810a6810a7p-7,
+        0x1.0842108421084p-7,
+        0x1.0624dd2f1a9fcp-7,
+        0x1.041041041041p-7,
+        0x1.0204081020408p-7,
+        0x1p-7,
+        0x1.fc07f01fc07fp-8,
+        0x1.f81f81f81f82p-8,
+        0x1.f44659e4a4271p-8,
+        0x1.f07c1f07c1f08p-8,
+        0x1.ecc07b301eccp-8,
+        0x1.e9131abf0b767p-8,
+        0x1.e573ac901e574p-8,
+        0x1.e1e1e1e1e1e1ep-8,
+        0x1.de5d6e3f8868ap-8,
+        0x1.dae6076b981dbp-8,
+        0x1.d77b654b82c34p-8,
+        0x1.d41d41d41d41dp-8,
+        0x1.d0cb58f6ec074p-8,
+        0x1.cd85689039b0bp-8,
+        0x1.ca4b3055ee191p-8,
+        0x1.c71c71c71c71cp-8,
+        0x1.c3f8f01c3f8fp-8,
+        0x1.c0e070381c0ep-8,
+        0x1.bdd2b899406f7p-8,
+        0x1.bacf914c1badp-8,
+        0x1.b7d6c3dda338bp-8,
+        0x1.b4e81b4e81b4fp-8,
+        0x1.b2036406c80d9p-8,
+        0x1.af286bca1af28p-8,
+        0x1.ac5701ac5701bp-8,
+        0x1.a98ef606a63bep-8,
+        0x1.a6d01a6d01a6dp-8,
+        0x1.a41a41a41a41ap-8,
+        0x1.a16d3f97a4b02p-8,
+        0x1.9ec8e951033d9p-8,
+        0x1.9c2d14ee4a102p-8,
+        0x1.999999999999ap-8,
+        0x1.970e4f80cb872p-8,
+        0x1.948b0fcd6e9ep-8,
+        0x1.920fb49d0e229p-8,
+        0x1.8f9c18f9c18fap-8,
+        0x1.8d3018d3018d3p-8,
+        0x1.8acb90f6bf3aap-8,
+        0x1.886e5f0abb04ap-8,
+        0x1.8618618618618p-8,
+        0x1.83c977ab2beddp-8,
+        0x1.8181818181818p-8,
+        0x1.7f405fd017f4p-8,
+        0x1.7d05f417d05f4p-8,
+        0x1.7ad2208e0ecc3p-8,
+        0x1.78a4c8178a4c8p-8,
+        0x1.767dce434a9b1p-8,
+        0x1.745d1745d1746p-8,
+        0x1.724287f46debcp-8,
+        0x1.702e05c0b817p-8,
+        0x1.6e1f76b4337c7p-8,
+        0x1.6c16c16c16c17p-8,
+        0x1.6a13cd153729p-8,
+        0x1.6816816816817p-8,
+        0x1.661ec6a5122f9p-8,
+        0x1.642c8590b2164p-8,
+        0x1.623fa7701624p-8,
+        0x1.6058160581606p-8,
+        0x1.5e75bb8d015e7p-8,
+        0x1.5c9882b931057p-8,
+        0x1.5ac056b015acp-8,
+        0x1.58ed2308158edp-8,
+        0x1.571ed3c506b3ap-8,
+        0x1.5555555555555p-8,
+        0x1.5390948f40febp-8,
+        0x1.51d07eae2f815p-8,
+        0x1.5015015015015p-8,
+        0x1.4e5e0a72f0539p-8,
+        0x1.4cab88725af6ep-8,
+        0x1.4afd6a052bf5bp-8,
+        0x1.49539e3b2d067p-8,
+        0x1.47ae147ae147bp-8,
+        0x1.460cbc7f5cf9ap-8,
+        0x1.446f86562d9fbp-8,
+        0x1.42d6625d51f87p-8,
+        0x1.4141414141414p-8,
+        0x1.3fb013fb013fbp-8,
+        0x1.3e22cbce4a902p-8,
+        0x1.3c995a47babe7p-8,
+        0x1.3b13b13b13b14p-8,
+        0x1.3991c2c187f63p-8,
+        0x1.3813813813814p-8,
+        0x1.3698df3de0748p-8,
+        0x1.3521cfb2b78c1p-8,
+        0x1.33ae45b57bcb2p-8,
+        0x1.323e34a2b10bfp-8,
+        0x1.30d190130d19p-8,
+        0x1.2f684bda12f68p-8,
+        0x1.2e025c04b8097p-8,
+        0x1.2c9fb4d812cap-8,
+        0x1.2b404ad012b4p-8,
+        0x1.29e4129e4129ep-8,
+        0x1.288b01288b013p-8,
+        0x1.27350b8812735p-8,
+        0x1.25e22708092f1p-8,
+        0x1.2492492492492p-8,
+        0x1.23456789abcdfp-8,
+        0x1.21fb78121fb78p-8,
+        0x1.20b470c67c0d9p-8,
+        0x1.1f7047dc11f7p-8,
+        0x1.1e2ef3b3fb874p-8,
+        0x1.1cf06ada2811dp-8,
+        0x1.1bb4a4046ed29p-8,
+        0x1.1a7b9611a7b96p-8,
+        0x1.19453808ca29cp-8,
+        0x1.1811811811812p-8,
+        0x1.16e0689427379p-8,
+        0x1.15b1e5f75270dp-8,
+        0x1.1485f0e0acd3bp-8,
+        0x1.135c81135c811p-8,
+        0x1.12358e75d3033p-8,
+        0x1.1111111111111p-8,
+        0x1.0fef010fef011p-8,
+        0x1.0ecf56be69c9p-8,
+        0x1.0db20a88f4696p-8,
+        0x1.0c9714fbcda3bp-8,
+        0x1.0b7e6ec259dc8p-8,
+        0x1.0a6810a6810a7p-8,
+        0x1.0953f39010954p-8,
+        0x1.0842108421084p-8,
+        0x1.073260a47f7c6p-8,
+        0x1.0624dd2f1a9fcp-8,
+        0x1.05197f7d73404p-8,
+        0x1.041041041041p-8,
+        0x1.03091b51f5e1ap-8,
+        0x1.0204081020408p-8,
+        0x1.010101010101p-8,
+        0x1p-8,
+        0x1.fe01fe01fe02p-9,
+        0x1.fc07f01fc07fp-9,
+        0x1.fa11caa01fa12p-9,
+        0x1.f81f81f81f82p-9,
+        0x1.f6310aca0dbb5p-9,
+        0x1.f44659e4a4271p-9,
+        0x1.f25f644230ab5p-9,
+        0x1.f07c1f07c1f08p-9,
+        0x1.ee9c7f8458e02p-9,
+        0x1.ecc07b301eccp-9,
+        0x1.eae807aba01ebp-9,
+        0x1.e9131abf0b767p-9,
+        0x1.e741aa59750e4p-9,
+        0x1.e573ac901e574p-9,
+        0x1.e3a9179dc1a73p-9,
+        0x1.e1e1e1e1e1e1ep-9,
+        0x1.e01e01e01e01ep-9,
+        0x1.de5d6e3f8868ap-9,
+        0x1.dca01dca01dcap-9,
+        0x1.dae6076b981dbp-9,
+        0x1.d92f2231e7f8ap-9,
+        0x1.d77b654b82c34p-9,
+        0x1.d5cac807572b2p-9,
+        0x1.d41d41d41d41dp-9,
+        0x1.d272ca3fc5b1ap-9,
+        0x1.d0cb58f6ec074p-9,
+        0x1.cf26e5c44bfc6p-9,
+        0x1.cd85689039b0bp-9,
+        0x1.cbe6d9601cbe7p-9,
+        0x1.ca4b3055ee191p-9,
+        0x1.c8b265afb8a42p-9,
+        0x1.c71c71c71c71cp-9,
+        0x1.c5894d10d4986p-9,
+        0x1.c3f8f01c3f8fp-9,
+        0x1.c26b5392ea01cp-9,
+        0x1.c0e070381c0ep-9,
+        0x1.bf583ee868d8bp-9,
+        0x1.bdd2b899406f7p-9,
+        0x1.bc4fd65883e7bp-9,
+        0x1.bacf914c1badp-9,
+        0x1.b951e2b18ff23p-9,
+        0x1.b7d6c3dda338bp-9,
+        0x1.b65e2e3beee05p-9,
+        0x1.b4e81b4e81b4fp-9,
+        0x1.b37484ad806cep-9,
+        0x1.b2036406c80d9p-9,
+        0x1.b094b31d922a4p-9,
+        0x1.af286bca1af28p-9,
+        0x1.adbe87f94905ep-9,
+        0x1.ac5701ac5701bp-9,
+        0x1.aaf1d2f87ebfdp-9,
+        0x1.a98ef606a63bep-9,
+        0x1.a82e65130e159p-9,
+        0x1.a6d01a6d01a6dp-9,
+        0x1.a574107688a4ap-9,
+        0x1.a41a41a41a41ap-9,
+        0x1.a2c2a87c51cap-9,
+        0x1.a16d3f97a4b02p-9,
+        0x1.a01a01a01a01ap-9,
+        0x1.9ec8e951033d9p-9,
+        0x1.9d79f176b682dp-9,
+        0x1.9c2d14ee4a102p-9,
+        0x1.9ae24ea5510dap-9,
+        0x1.999999999999ap-9,
+        0x1.9852f0d8ec0ffp-9,
+        0x1.970e4f80cb872p-9,
+        0x1.95cbb0be377aep-9,
+        0x1.948b0fcd6e9ep-9,
+        0x1.934c67f9b2ce6p-9,
+        0x1.920fb49d0e229p-9,
+        0x1.90d4f120190d5p-9,
+        0x1.8f9c18f9c18fap-9,
+        0x1.8e6527af1373fp-9,
+        0x1.8d3018d3018d3p-9,
+        0x1.8bfce8062ff3ap-9,
+        0x1.8acb90f6bf3aap-9,
+        0x1.899c0f601899cp-9,
+        0x1.886e5f0abb04ap-9,
+        0x1.87427bcc092b9p-9,
+        0x1.8618618618618p-9,
+        0x1.84f00c2780614p-9,
+        0x1.83c977ab2beddp-9,
+        0x1.82a4a0182a4ap-9,
+        0x1.8181818181818p-9,
+        0x1.8060180601806p-9,
+        0x1.7f405fd017f4p-9,
+        0x1.7e225515a4f1dp-9,
+        0x1.7d05f417d05f4p-9,
+        0x1.7beb3922e017cp-9,
+        0x1.7ad2208e0ecc3p-9,
+        0x1.79baa6bb6398bp-9,
+        0x1.78a4c8178a4c8p-9,
+        0x1.77908119ac60dp-9,
+        0x1.767dce434a9b1p-9,
+        0x1.756cac201756dp-9,
+        0x1.745d1745d1746p-9,
+        0x1.734f0c541fe8dp-9,
+        0x1.724287f46debcp-9,
+        0x1.713786d9c7c09p-9,
+        0x1.702e05c0b817p-9,
+        0x1.6f26016f26017p-9,
+        0x1.6e1f76b4337c7p-9,
+        0x1.6d1a62681c861p-9,
+        0x1.6c16c16c16c17p-9,
+        0x1.6b1490aa31a3dp-9,
+        0x1.6a13cd153729p-9,
+        0x1.691473a88d0cp-9,
+        0x1.6816816816817p-9,
+        0x1.6719f3601671ap-9,
+        0x1.661ec6a5122f9p-9,
+        0x1.6524f853b4aa3p-9,
+        0x1.642c8590b2164p-9,
+        0x1.63356b88ac0dep-9,
+        0x1.623fa7701624p-9,
+        0x1.614b36831ae94p-9,
+        0x1.6058160581606p-9,
+        0x1.5f66434292dfcp-9,
+        0x1.5e75bb8d015e7p-9,
+        0x1.5d867c3ece2a5p-9,
+        0x1.5c9882b931057p-9,
+        0x1.5babcc647fa91p-9,
+        0x1.5ac056b015acp-9,
+        0x1.59d61f123ccaap-9,
+        0x1.58ed2308158edp-9,
+        0x1.580560158056p-9,
+        0x1.571ed3c506b3ap-9,
+        0x1.56397ba7c52e2p-9,
+        0x1.5555555555555p-9,
+        0x1.54725e6bb82fep-9,
+        0x1.5390948f40febp-9,
+        0x1.52aff56a8054bp-9,
+        0x1.51d07eae2f815p-9,
+        0x1.50f22e111c4c5p-9,
+        0x1.5015015015015p-9,
+        0x1.4f38f62dd4c9bp-9,
+        0x1.4e5e0a72f0539p-9,
+        0x1.4d843bedc2c4cp-9,
+        0x1.4cab88725af6ep-9,
+        0x1.4bd3edda68fe1p-9,
+        0x1.4afd6a052bf5bp-9,
+        0x1.4a27fad76014ap-9,
+        0x1.49539e3b2d067p-9,
+        0x1.488052201488p-9,
+        0x1.47ae147ae147bp-9,
+        0x1.46dce34596066p-9,
+        0x1.460cbc7f5cf9ap-9,
+        0x1.453d9e2c776cap-9,
+        0x1.446f86562d9fbp-9,
+        0x1.43a2730abee4dp-9,
+        0x1.42d6625d51f87p-9,
+        0x1.420b5265e5951p-9,
+        0x1.4141414141414p-9,
+        0x1.40782d10e6566p-9,
+        0x1.3fb013fb013fbp-9,
+        0x1.3ee8f42a5af07p-9,
+        0x1.3e22cbce4a902p-9,
+        0x1.3d5d991aa75c6p-9,
+        0x1.3c995a47babe7p-9,
+        0x1.3bd60d9232955p-9,
+        0x1.3b13b13b13b14p-9,
+        0x1.3a524387ac822p-9,
+        0x1.3991c2c187f63p-9,
+        0x1.38d22d366088ep-9,
+        0x1.3813813813814p-9,
+        0x1.3755bd1c945eep-9,
+        0x1.3698df3de0748p-9,
+        0x1.35dce5f9f2af8p-9,
+        0x1.3521cfb2b78c1p-9,
+        0x1.34679ace01346p-9,
+        0x1.33ae45b57bcb2p-9,
+        0x1.32f5ced6a1dfap-9,
+        0x1.323e34a2b10bfp-9,
+        0x1.3187758e9ebb6p-9,
+        0x1.30d190130d19p-9,
+        0x1.301c82ac4026p-9,
+        0x1.2f684bda12f68p-9,
+        0x1.2eb4ea1fed14bp-9,
+        0x1.2e025c04b8097p-9,
+        0x1.2d50a012d50ap-9,
+        0x1.2c9fb4d812cap-9,
+        0x1.2bef98e5a3711p-9,
+        0x1.2b404ad012b4p-9,
+        0x1.2a91c92f3c105p-9,
+        0x1.29e4129e4129ep-9,
+        0x1.293725bb804a5p-9,
+        0x1.288b01288b013p-9,
+        0x1.27dfa38a1ce4dp-9,
+        0x1.27350b8812735p-9,
+        0x1.268b37cd60127p-9,
+        0x1.25e22708092f1p-9,
+        0x1.2539d7e9177b2p-9,
+        0x1.2492492492492p-9,
+        0x1.23eb79717605bp-9,
+        0x1.23456789abcdfp-9,
+        0x1.22a0122a0122ap-9,
+        0x1.21fb78121fb78p-9,
+        0x1.21579804855e6p-9,
+        0x1.20b470c67c0d9p-9,
+        0x1.2012012012012p-9,
+        0x1.1f7047dc11f7p-9,
+        0x1.1ecf43c7fb84cp-9,
+        0x1.1e2ef3b3fb874p-9,
+        0x1.1d8f5672e4abdp-9,
+        0x1.1cf06ada2811dp-9,
+        0x1.1c522fc1ce059p-9,
+        0x1.1bb4a4046ed29p-9,
+        0x1.1b17c67f2bae3p-9,
+        0x1.1a7b9611a7b96p-9,
+        0x1.19e0119e0119ep-9,
+        0x1.19453808ca29cp-9,
+        0x1.18ab083902bdbp-9,
+        0x1.1811811811812p-9,
+        0x1.1778a191bd684p-9,
+        0x1.16e0689427379p-9,
+        0x1.1648d50fc3201p-9,
+        0x1.15b1e5f75270dp-9,
+        0x1.151b9a3fdd5c9p-9,
+        0x1.1485f0e0acd3bp-9,
+        0x1.13f0e8d344724p-9,
+        0x1.135c81135c811p-9,
+        0x1.12c8b89edc0acp-9,
+        0x1.12358e75d3033p-9,
+        0x1.11a3019a74826p-9,
+        0x1.1111111111111p-9,
+        0x1.107fbbe01108p-9,
+        0x1.0fef010fef011p-9,
+        0x1.0f5edfab325a2p-9,
+        0x1.0ecf56be69c9p-9,
+        0x1.0e40655826011p-9,
+        0x1.0db20a88f4696p-9,
+        0x1.0d24456359e3ap-9,
+        0x1.0c9714fbcda3bp-9,
+        0x1.0c0a7868b4171p-9,
+        0x1.0b7e6ec259dc8p-9,
+        0x1.0af2f722eecb5p-9,
+        0x1.0a6810a6810a7p-9,
+        0x1.09ddba6af836p-9,
+        0x1.0953f39010954p-9,
+        0x1.08cabb37565e2p-9,
+        0x1.0842108421084p-9,
+        0x1.07b9f29b8eae2p-9,
+        0x1.073260a47f7c6p-9,
+        0x1.06ab59c7912fbp-9,
+        0x1.0624dd2f1a9fcp-9,
+        0x1.059eea0727586p-9,
+        0x1.05197f7d73404p-9,
+        0x1.04949cc1664c5p-9,
+        0x1.041041041041p-9,
+        0x1.038c6b78247fcp-9,
+        0x1.03091b51f5e1ap-9,
+        0x1.02864fc7729e9p-9,
+        0x1.0204081020408p-9,
+        0x1.0182436517a37p-9,
+        0x1.010101010101p-9,
+        0x1.008040201008p-9,
+        0x1p-9,
+        0x1.ff007fc01ffp-10,
+        0x1.fe01fe01fe02p-10,
+        0x1.fd04794a10e6ap-10,
+        0x1.fc07f01fc07fp-10,
+        0x1.fb0c610d5e939p-10,
+        0x1.fa11caa01fa12p-10,
+        0x1.f9182b6813bafp-10,
+        0x1.f81f81f81f82p-10,
+        0x1.f727cce5f530ap-10,
+        0x1.f6310aca0dbb5p-10,
+        0x1.f53b3a3fa204ep-10,
+        0x1.f44659e4a4271p-10,
+        0x1.f3526859b8cecp-10,
+        0x1.f25f644230ab5p-10,
+        0x1.f16d4c4401f17p-10,
+        0x1.f07c1f07c1f08p-10,
+        0x1.ef8bdb389ebadp-10,
+        0x1.ee9c7f8458e02p-10,
+        0x1.edae0a9b3d3a5p-10,
+        0x1.ecc07b301eccp-10,
+        0x1.ebd3cff850b0cp-10,
+        0x1.eae807aba01ebp-10,
+        0x1.e9fd21044e799p-10,
+        0x1.e9131abf0b767p-10,
+        0x1.e829f39aef509p-10,
+        0x1.e741aa59750e4p-10,
+        0x1.e65a3dbe74d6bp-10,
+        0x1.e573ac901e574p-10,
+        0x1.e48df596f3394p-10,
+        0x1.e3a9179dc1a73p-10,
+        0x1.e2c511719ee16p-10,
+        0x1.e1e1e1e1e1e1ep-10,
+        0x1.e0ff87c01e1p-10,
+        0x1.e01e01e01e01ep-10,
+        0x1.df3d4f17de4dbp-10,
+        0x1.de5d6e3f8868ap-10,
+        0x1.dd7e5e316d94cp-10,
+        0x1.dca01dca01dcap-10,
+        0x1.dbc2abe7d71d4p-10,
+        0x1.dae6076b981dbp-10,
+        0x1.da0a2f3803b41p-10,
+        0x1.d92f2231e7f8ap-10,
+        0x1.d854df401d855p-10,
+        0x1.d77b654b82c34p-10,
+        0x1.d6a2b33ef7448p-10,
+        0x1.d5cac807572b2p-10,
+        0x1.d4f3a293769cap-10,
+        0x1.d41d41d41d41dp-10,
+        0x1.d347a4bc01d34p-10,
+        0x1.d272ca3fc5b1ap-10,
+        0x1.d19eb155f08a4p-10,
+        0x1.d0cb58f6ec074p-10,
+        0x1.cff8c01cff8cp-10,
+        0x1.cf26e5c44bfc6p-10,
+        0x1.ce55c8eac79p-10,
+        0x1.cd85689039b0bp-10,
+        0x1.ccb5c3b636e3ap-10,
+        0x1.cbe6d9601cbe7p-10,
+        0x1.cb18a8930de6p-10,
+        0x1.ca4b3055ee191p-10,
+        0x1.c97e6fb15e44dp-10,
+        0x1.c8b265afb8a42p-10,
+        0x1.c7e7115d0ce95p-10,
+        0x1.c71c71c71c71cp-10,
+        0x1.c65285fd56843p-10,
+        0x1.c5894d10d4986p-10,
+        0x1.c4c0c61456a8ep-10,
+        0x1.c3f8f01c3f8fp-10,
+        0x1.c331ca3e91679p-10,
+        0x1.c26b5392ea01cp-10,
+        0x1.c1a58b327f576p-10,
+        0x1.c0e070381c0ep-10,
+        0x1.c01c01c01c01cp-10,
+        0x1.bf583ee868d8bp-10,
+        0x1.be9526d0769fap-10,
+        0x1.bdd2b899406f7p-10,
+        0x1.bd10f365451b6p-10,
+        0x1.bc4fd65883e7bp-10,
+        0x1.bb8f609879493p-10,
+        0x1.bacf914c1badp-10,
+        0x1.ba10679bd8488p-10,
+        0x1.b951e2b18ff23p-10,
+        0x1.b89401b89401cp-10,
+        0x1.b7d6c3dda338bp-10,
+        0x1.b71a284ee6b34p-10,
+        0x1.b65e2e3beee05p-10,
+        0x1.b5a2d4d5b081fp-10,
+        0x1.b4e81b4e81b4fp-10,
+        0x1.b42e00da17007p-10,
+        0x1.b37484ad806cep-10,
+        0x1.b2bba5ff26a23p-10,
+        0x1.b2036406c80d9p-10,
+        0x1.b14bbdfd760e6p-10,
+        0x1.b094b31d922a4p-10,
+        0x1.afde42a2cb482p-10,
+        0x1.af286bca1af28p-10,
+        0x1.ae732dd1c2a09p-10,
+        0x1.adbe87f94905ep-10,
+        0x1.ad0a798177693p-10,
+        0x1.ac5701ac5701bp-10,
+        0x1.aba41fbd2e5b1p-10,
+        0x1.aaf1d2f87ebfdp-10,
+        0x1.aa401aa401aa4p-10,
+        0x1.a98ef606a63bep-10,
+        0x1.a8de64688ebabp-10,
+        0x1.a82e65130e159p-10,
+        0x1.a77ef750a56dap-10,
+        0x1.a6d01a6d01a6dp-10,
+        0x1.a621cdb4f8fdfp-10,
+        0x1.a574107688a4ap-10,
+        0x1.a4c6e200d2637p-10,
+        0x1.a41a41a41a41ap-10,
+        0x1.a36e2eb1c432dp-10,
+        0x1.a2c2a87c51cap-10,
+        0x1.a217ae575ff2fp-10,
+        0x1.a16d3f97a4b02p-10,
+        0x1.a0c35b92ecdf1p-10,
+        0x1.a01a01a01a01ap-10,
+        0x1.9f713117200dp-10,
+        0x1.9ec8e951033d9p-10,
+        0x1.9e2129a7d5f0ap-10,
+        0x1.9d79f176b682dp-10,
+        0x1.9cd34019cd34p-10,
+        0x1.9c2d14ee4a102p-10,
+        0x1.9b876f5262dd1p-10,
+        0x1.9ae24ea5510dap-10,
+        0x1.9a3db2474fb98p-10,
+        0x1.999999999999ap-10,
+        0x1.98f603fe670ap-10,
+        0x1.9852f0d8ec0ffp-10,
+        0x1.97b05f8d56652p-10,
+        0x1.970e4f80cb872p-10,
+        0x1.966cc01966ccp-10,
+        0x1.95cbb0be377aep-10,
+        0x1.952b20d73ee97p-10,
+        0x1.948b0fcd6e9ep-10,
+        0x1.93eb7d0aa6759p-10,
+        0x1.934c67f9b2ce6p-10,
+        0x1.92add0064ab74p-10,
+        0x1.920fb49d0e229p-10,
+        0x1.9172152b841ddp-10,
+        0x1.90d4f120190d5p-10,
+        0x1.903847ea1cec1p-10,
+        0x1.8f9c18f9c18fap-10,
+        0x1.8f0063c018fp-10,
+        0x1.8e6527af1373fp-10,
+        0x1.8dca64397e408p-10,
+        0x1.8d3018d3018d3p-10,
+        0x1.8c9644f01efbcp-10,
+        0x1.8bfce8062ff3ap-10,
+        0x1.8b64018b64019p-10,
+        0x1.8acb90f6bf3aap-10,
+        0x1.8a3395c018a34p-10,
+        0x1.899c0f601899cp-10,
+        0x1.8904fd503744bp-10,
+        0x1.886e5f0abb04ap-10,
+        0x1.87d8340ab6e97p-10,
+        0x1.87427bcc092b9p-10,
+        0x1.86ad35cb59a84p-10,
+        0x1.8618618618618p-10,
+        0x1.8583fe7a7c018p-10,
+        0x1.84f00c2780614p-10,
+        0x1.845c8a0ce5129p-10,
+        0x1.83c977ab2beddp-10,
+        0x1.8336d48397a24p-10,
+        0x1.82a4a0182a4ap-10,
+        0x1.8212d9eba4018p-10,
+        0x1.8181818181818p-10,
+        0x1.80f0965dfabcbp-10,
+        0x1.8060180601806p-10,
+        0x1.7fd005ff4018p-10,
+        0x1.7f405fd017f4p-10,
+        0x1.7eb124ffa053bp-10,
+        0x1.7e225515a4f1dp-10,
+        0x1.7d93ef9aa4b46p-10,
+        0x1.7d05f417d05f4p-10,
+        0x1.7c7862170949fp-10,
+        0x1.7beb3922e017cp-10,
+        0x1.7b5e78c693733p-10,
+        0x1.7ad2208e0ecc3p-10,
+        0x1.7a463005e918cp-10,
+        0x1.79baa6bb6398bp-10,
+        0x1.792f843c689c3p-10,
+        0x1.78a4c8178a4c8p-10,
+        0x1.781a71dc01782p-10,
+        0x1.77908119ac60dp-10,
+        0x1.7706f5610d8dp-10,
+        0x1.767dce434a9b1p-10,
+        0x1.75f50b522b17cp-10,
+        0x1.756cac201756dp-10,
+        0x1.74e4b040174e5p-10,
+        0x1.745d1745d1746p-10,
+        0x1.73d5e0c5899f7p-10,
+        0x1.734f0c541fe8dp-10,
+        0x1.72c899870f91fp-10,
+        0x1.724287f46debcp-10,
+        0x1.71bcd732e940ap-10,
+        0x1.713786d9c7c09p-10,
+        0x1.70b29680e66fap-10,
+        0x1.702e05c0b817p-10,
+        0x1.6fa9d4324438p-10,
+        0x1.6f26016f26017p-10,
+        0x1.6ea28d118b474p-10,
+        0x1.6e1f76b4337c7p-10,
+        0x1.6d9cbdf26eaefp-10,
+        0x1.6d1a62681c861p-10,
+        0x1.6c9863b1ab429p-10,
+        0x1.6c16c16c16c17p-10,
+        0x1.6b957b34e7803p-10,
+        0x1.6b1490aa31a3dp-10,
+        0x1.6a94016a94017p-10,
+        0x1.6a13cd153729p-10,
+        0x1.6993f349cc726p-10,
+        0x1.691473a88d0cp-10,
+        0x1.68954dd2390bap-10,
+        0x1.6816816816817p-10,
+        0x1.67980e0bf08c7p-10,
+        0x1.6719f3601671ap-10,
+        0x1.669c31075ab4p-10,
+        0x1.661ec6a5122f9p-10,
+        0x1.65a1b3dd13357p-10,
+        0x1.6524f853b4aa3p-10,
+        0x1.64a893adcd25fp-10,
+        0x1.642c8590b2164p-10,
+        0x1.63b0cda236e1cp-10,
+        0x1.63356b88ac0dep-10,
+        0x1.62ba5eeade65ep-10,
+        0x1.623fa7701624p-10,
+        0x1.61c544c0161c5p-10,
+        0x1.614b36831ae94p-10,
+        0x1.60d17c61da198p-10,
+        0x1.6058160581606p-10,
+        0x1.5fdf0317b5c6fp-10,
+        0x1.5f66434292dfcp-10,
+        0x1.5eedd630a9fb3p-10,
+        0x1.5e75bb8d015e7p-10,
+        0x1.5dfdf303137b6p-10,
+        0x1.5d867c3ece2a5p-10,
+        0x1.5d0f56ec91e57p-10,
+        0x1.5c9882b931057p-10,
+        0x1.5c21ff51ef005p-10,
+        0x1.5babcc647fa91p-10,
+        0x1.5b35e99f06714p-10,
+        0x1.5ac056b015acp-10,
+        0x1.5a4b1346add2bp-10,
+        0x1.59d61f123ccaap-10,
+        0x1.596179c29d2cep-10,
+        0x1.58ed2308158edp-10,
+        0x1.58791a9357ccep-10,
+        0x1.580560158056p-10,
+        0x1.5791f34015792p-10,
+        0x1.571ed3c506b3ap-10,
+        0x1.56ac0156ac015p-10,
+        0x1.56397ba7c52e2p-10,
+        0x1.55c7426b79286p-10,
+        0x1.5555555555555p-10,
+        0x1.54e3b4194ce66p-10,
+        0x1.54725e6bb82fep-10,
+        0x1.5401540154015p-10,
+        0x1.5390948f40febp-10,
+        0x1.53201fcb02fb1p-10,
+        0x1.52aff56a8054bp-10,
+        0x1.5240152401524p-10,
+        0x1.51d07eae2f815p-10,
+        0x1.516131c015161p-10,
+        0x1.50f22e111c4c5p-10,
+        0x1.508373590ec9cp-10,
+        0x1.5015015015015p-10,
+        0x1.4fa6d7aeb597cp-10,
+        0x1.4f38f62dd4c9bp-10,
+        0x1.4ecb5c86b3d24p-10,
+        0x1.4e5e0a72f0539p-10,
+        0x1.4df0ffac83c01p-10,
+        0x1.4d843bedc2c4cp-10,
+        0x1.4d17bef15cb4ep-10,
+        0x1.4cab88725af6ep-10,
+        0x1.4c3f982c20723p-10,
+        0x1.4bd3edda68fe1p-10,
+        0x1.4b68893948d1cp-10,
+        0x1.4afd6a052bf5bp-10,
+        0x1.4a928ffad5b5cp-10,
+        0x1.4a27fad76014ap-10,
+        0x1.49bdaa583b401p-10,
+        0x1.49539e3b2d067p-10,
+        0x1.48e9d63e504d1p-10,
+        0x1.488052201488p-10,
+        0x1.4817119f3d325p-10,
+        0x1.47ae147ae147bp-10,
+        0x1.47455a726abf2p-10,
+        0x1.46dce34596066p-10,
+        0x1.4674aeb4717e9p-10,
+        0x1.460cbc7f5cf9ap-10,
+        0x1.45a50c670938fp-10,
+        0x1.453d9e2c776cap-10,
+        0x1.44d67190f8b43p-10,
+        0x1.446f86562d9fbp-10,
+        0x1.4408dc3e05b22p-10,
+        0x1.43a2730abee4dp-10,
+        0x1.433c4a7ee52b4p-10,
+        0x1.42d6625d51f87p-10,
+        0x1.4270ba692bc4dp-10,
+        0x1.420b5265e5951p-10,
+        0x1.41a62a173e821p-10,
+        0x1.4141414141414p-10,
+        0x1.40dc97a843ae8p-10,
+        0x1.40782d10e6566p-10,
+        0x1.4014014014014p-10,
+        0x1.3fb013fb013fbp-10,
+        0x1.3f4c65072bf74p-10,
+        0x1.3ee8f42a5af07p-10,
+        0x1.3e85c12a9d651p-10,
+        0x1.3e22cbce4a902p-10,
+        0x1.3dc013dc013dcp-10,
+        0x1.3d5d991aa75c6p-10,
+        0x1.3cfb5b51698ebp-10,
+        0x1.3c995a47babe7p-10,
+        0x1.3c3795c553afbp-10,
+        0x1.3bd60d9232955p-10,
+        0x1.3b74c1769aa5cp-10,
+        0x1.3b13b13b13b14p-10,
+        0x1.3ab2dca869b81p-10,
+        0x1.3a524387ac822p-10,
+        0x1.39f1e5a22f36ep-10,
+        0x1.3991c2c187f63p-10,
+        0x1.3931daaf8f721p-10,
+        0x1.38d22d366088ep-10,
+        0x1.3872ba2057e04p-10,
+        0x1.3813813813814p-10,
+        0x1.37b4824872744p-10,
+        0x1.3755bd1c945eep-10,
+        0x1.36f7317fd9212p-10,
+        0x1.3698df3de0748p-10,
+        0x1.363ac622898b1p-10,
+        0x1.35dce5f9f2af8p-10,
+        0x1.357f3e9078e5bp-10,
+        0x1.3521cfb2b78c1p-10,
+        0x1.34c4992d87fd9p-10,
+        0x1.34679ace01346p-10,
+        0x1.340ad461776d3p-10,
+        0x1.33ae45b57bcb2p-10,
+        0x1.3351ee97dbfc6p-10,
+        0x1.32f5ced6a1dfap-10,
+        0x1.3299e6401329ap-10,
+        0x1.323e34a2b10bfp-10,
+        0x1.31e2b9cd37dc2p-10,
+        0x1.3187758e9ebb6p-10,
+        0x1.312c67b6173eep-10,
+        0x1.30d190130d19p-10,
+        0x1.3076ee7525c2cp-10,
+        0x1.301c82ac4026p-10,
+        0x1.2fc24c8874486p-10,
+        0x1.2f684bda12f68p-10,
+        0x1.2f0e8071a5703p-10,
+        0x1.2eb4ea1fed14bp-10,
+        0x1.2e5b88b5e3104p-10,
+        0x1.2e025c04b8097p-10,
+        0x1.2da963ddd3cfbp-10,
+        0x1.2d50a012d50ap-10,
+        0x1.2cf8107590e67p-10,
+        0x1.2c9fb4d812cap-10,
+        0x1.2c478d0c9c013p-10,
+        0x1.2bef98e5a3711p-10,
+        0x1.2b97d835d548ep-10,
+        0x1.2b404ad012b4p-10,
+        0x1.2ae8f087718dp-10,
+        0x1.2a91c92f3c105p-10,
+        0x1.2a3ad49af0907p-10,
+        0x1.29e4129e4129ep-10,
+        0x1.298d830d1378p-10,
+        0x1.293725bb804a5p-10,
+        0x1.28e0fa7dd35a3p-10,
+        0x1.288b01288b013p-10,
+        0x1.2835399057efdp-10,
+        0x1.27dfa38a1ce4dp-10,
+        0x1.278a3eeaee65p-10,
+        0x1.27350b8812735p-10,
+        0x1.26e009370049cp-10,
+        0x1.268b37cd60127p-10,
+        0x1.263697210aa18p-10,
+        0x1.25e22708092f1p-10,
+        0x1.258de75895121p-10,
+        0x1.2539d7e9177b2p-10,
+        0x1.24e5f89029305p-10,
+        0x1.2492492492492p-10,
+        0x1.243ec97d49eaep-10,
+        0x1.23eb79717605bp-10,
+        0x1.239858d86b11fp-10,
+        0x1.23456789abcdfp-10,
+        0x1.22f2a55ce8fc5p-10,
+        0x1.22a0122a0122ap-10,
+        0x1.224dadc900489p-10,
+        0x1.21fb78121fb78p-10,
+        0x1.21a970ddc5ba7p-10,
+        0x1.21579804855e6p-10,
+        0x1.2105ed5f1e336p-10,
+        0x1.20b470c67c0d9p-10,
+        0x1.20632213b6c6dp-10,
+        0x1.2012012012012p-10,
+        0x1.1fc10dc4fce8bp-10,
+        0x1.1f7047dc11f7p-10,
+        0x1.1f1faf3f16b64p-10,
+        0x1.1ecf43c7fb84cp-10,
+        0x1.1e7f0550db594p-10,
+        0x1.1e2ef3b3fb874p-10,
+        0x1.1ddf0ecbcb841p-10,
+        0x1.1d8f5672e4abdp-10,
+        0x1.1d3fca840a074p-10,
+        0x1.1cf06ada2811dp-10,
+        0x1.1ca13750547fep-10,
+        0x1.1c522fc1ce059p-10,
+        0x1.1c035409fc1dfp-10,
+        0x1.1bb4a4046ed29p-10,
+        0x1.1b661f8cde833p-10,
+        0x1.1b17c67f2bae3p-10,
+        0x1.1ac998b75eb9p-10,
+        0x1.1a7b9611a7b96p-10,
+        0x1.1a2dbe6a5e3e4p-10,
+        0x1.19e0119e0119ep-10,
+        0x1.19928f89362b7p-10,
+        0x1.19453808ca29cp-10,
+        0x1.18f80af9b06dcp-10,
+        0x1.18ab083902bdbp-10,
+        0x1.185e2fa401186p-10,
+        0x1.1811811811812p-10,
+        0x1.17c4fc72bfcb9p-10,
+        0x1.1778a191bd684p-10,
+        0x1.172c7052e1316p-10,
+        0x1.16e0689427379p-10,
+        0x1.16948a33b08fap-10,
+        0x1.1648d50fc3201p-10,
+        0x1.15fd4906c96f1p-10,
+        0x1.15b1e5f75270dp-10,
+        0x1.1566abc011567p-10,
+        0x1.151b9a3fdd5c9p-10,
+        0x1.14d0b155b19aep-10,
+        0x1.1485f0e0acd3bp-10,
+        0x1.143b58c01143bp-10,
+        0x1.13f0e8d344724p-10,
+        0x1.13a6a0f9cf01ep-10,
+        0x1.135c81135c811p-10,
+        0x1.131288ffbb3b6p-10,
+        0x1.12c8b89edc0acp-10,
+        0x1.127f0fd0d2295p-10,
+        0x1.12358e75d3033p-10,
+        0x1.11ec346e36092p-10,
+        0x1.11a3019a74826p-10,
+        0x1.1159f5db29606p-10,
+        0x1.1111111111111p-10,
+        0x1.10c8531d0952ep-10,
+        0x1.107fbbe01108p-10,
+        0x1.10374b3b480aap-10,
+        0x1.0fef010fef011p-10,
+        0x1.0fa6dd3f67322p-10,
+        0x1.0f5edfab325a2p-10,
+        0x1.0f170834f27fap-10,
+        0x1.0ecf56be69c9p-10,
+        0x1.0e87cb297a51ep-10,
+        0x1.0e40655826011p-10,
+        0x1.0df9252c8e5e6p-10,
+        0x1.0db20a88f4696p-10,
+        0x1.0d6b154fb86f9p-10,
+        0x1.0d24456359e3ap-10,
+        0x1.0cdd9aa677344p-10,
+        0x1.0c9714fbcda3bp-10,
+        0x1.0c50b446391f3p-10,
+        0x1.0c0a7868b4171p-10,
+        0x1.0bc4614657569p-10,
+        0x1.0b7e6ec259dc8p-10,
+        0x1.0b38a0c010b39p-10,
+        0x1.0af2f722eecb5p-10,
+        0x1.0aad71ce84d16p-10,
+        0x1.0a6810a6810a7p-10,
+        0x1.0a22d38eaf2bfp-10,
+        0x1.09ddba6af836p-10,
+        0x1.0998c51f624d5p-10,
+        0x1.0953f39010954p-10,
+        0x1.090f45a1430aap-10,
+        0x1.08cabb37565e2p-10,
+        0x1.08865436c3cf7p-10,
+        0x1.0842108421084p-10,
+        0x1.07fdf0041ff7cp-10,
+        0x1.07b9f29b8eae2p-10,
+        0x1.0776182f57386p-10,
+        0x1.073260a47f7c6p-10,
+        0x1.06eecbe029155p-10,
+        0x1.06ab59c7912fbp-10,
+        0x1.06680a4010668p-10,
+        0x1.0624dd2f1a9fcp-10,
+        0x1.05e1d27a3ee9cp-10,
+        0x1.059eea0727586p-10,
+        0x1.055c23bb98e2ap-10,
+        0x1.05197f7d73404p-10,
+        0x1.04d6fd32b0c7bp-10,
+        0x1.04949cc1664c5p-10,
+        0x1.04525e0fc2fcbp-10,
+        0x1.041041041041p-10,
+        0x1.03ce4584b19ap-10,
+        0x1.038c6b78247fcp-10,
+        0x1.034ab2c50040dp-10,
+        0x1.03091b51f5e1ap-10,
+        0x1.02c7a505cffbfp-10,
+        0x1.02864fc7729e9p-10,
+        0x1.02451b7ddb2d2p-10,
+        0x1.0204081020408p-10,
+        0x1.01c315657186bp-10,
+        0x1.0182436517a37p-10,
+        0x1.014191f674111p-10,
+        0x1.010101010101p-10,
+        0x1.00c0906c513cfp-10,
+        0x1.008040201008p-10,
+        0x1.0040100401004p-10,
+        0x1p-10,
+    };
+};
+
+template <>
+class cpp_gen_multiplier_table<dean> final
+{
+public:
+    static constexpr uint32_t MAX_NUM_REPS = 1024;
+    static constexpr double VALUES[MAX_NUM_REPS + 1] = {
+        0.0,
+        0x1.8p-1,
+        0x1.aaaaaaaaaaaabp-2,
+        0x1.2aaaaaaaaaaabp-2,
+        0x1.ccccccccccccdp-3,
+        0x1.7777777777777p-3,
+        0x1.3cf3cf3cf3cf4p-3,
+        0x1.1249249249249p-3,
+        0x1.e38e38e38e38ep-4,
+        0x1.b05b05b05b05bp-4,
+        0x1.86fb586fb587p-4,
+        0x1.64d9364d9364ep-4,
+        0x1.4834834834835p-4,
+        0x1.2fd2fd2fd2fd3p-4,
+        0x1.1ad1ad1ad1ad2p-4,
+        0x1.0888888888889p-4,
+        0x1.f0f0f0f0f0f0fp-5,
+        0x1.d47f29d47f29dp-5,
+        0x1.bb226ec89bb22p-5,
+        0x1.a46102b1da461p-5,
+        0x1.8fd8fd8fd8fd9p-5,
+        0x1.7d3abc65f4eafp-5,
+        0x1.6c44ce6b41c55p-5,
+        0x1.5cc0ed7303b5dp-5,
+        0x1.4e81b4e81b4e8p-5,
+        0x1.4160e2dafa7c7p-5,
+        0x1.353dfe8a9353ep-5,
+        0x1.29fd4a7f529fdp-5,
+        0x1.1f86ef9b1d014p-5,
+        0x1.15c653915c654p-5,
+        0x1.0ca990ca990cbp-5,
+        0x1.0421084210842p-5,
+        0x1.f83e0f83e0f84p-6,
+        0x1.e92f0074d1e93p-6,
+        0x1.daff91daff91ep-6,
+        0x1.cd9cd9cd9cd9dp-6,
+        0x1.c0f601899c0f6p-6,
+        0x1.b4fbfe8b1b4fcp-6,
+        0x1.a9a156b71a9a1p-6,
+        0x1.9ed9ed9ed9edap-6,
+        0x1.949ad949ad94ap-6,
+        0x1.8ada3d3fecf89p-6,
+        0x1.818f2acef4606p-6,
+        0x1.78b185aed0e9dp-6,
+        0x1.7039ec58f41aep-6,
+        0x1.6821a37e646bdp-6,
+        0x1.60628424f18dep-6,
+        0x1.58f6ec07432d6p-6,
+        0x1.51d9afe422d47p-6,
+        0x1.4b060f76e8cdap-6,
+        0x1.4477aade11447p-6,
+        0x1.3e2a793e2a794p-6,
+        0x1.381ac076e59eap-6,
+        0x1.32450dc665415p-6,
+        0x1.2ca62f3c2a103p-6,
+        0x1.273b2de169b98p-6,
+        0x1.2201488052201p-6,
+        0x1.1cf5eef6dcd83p-6,
+        0x1.1816be047d152p-6,
+        0x1.13617b8431c0fp-6,
+        0x1.0ed413066f5a6p-6,
+        0x1.0a6c92bff755fp-6,
+        0x1.062928c418a4ap-6,
+        0x1.0208208208208p-6,
+        0x1.fc0fc0fc0fc1p-7,
+        0x1.f44dd07ff0b94p-7,
+        0x1.ecc79ce366b37p-7,
+        0x1.e57a7e5076ac3p-7,
+        0x1.de63f4a6bcffdp-7,
+        0x1.d781a49fdaafcp-7,
+        0x1.d0d155322b794p-7,
+        0x1.ca50ed2bab114p-7,
+        0x1.c3fe70ff9c3fep-7,
+        0x1.bdd800c21bdd8p-7,
+        0x1.b7dbd64d4eb0fp-7,
+        0x1.b208438c4e53bp-7,
+        0x1.ac5bb0e860973p-7,
+        0x1.a6d49bd5603ecp-7,
+        0x1.a171957a8ebfap-7,
+        0x1.9c3141754e6b9p-7,
+        0x1.971254b3841bdp-7,
+        0x1.921394639816dp-7,
+        0x1.8d33d4f840652p-7,
+        0x1.8871f93e6bce1p-7,
+        0x1.83ccf183ccf18p-7,
+        0x1.7f43bacca8f06p-7,
+        0x1.7ad55e17ad55ep-7,
+        0x1.7680efaeade07p-7,
+        0x1.72458e8344c5bp-7,
+        0x1.6e226396676c3p-7,
+        0x1.6a16a16a16a17p-7,
+        0x1.6621837c644bdp-7,
+        0x1.62424dcb19bb5p-7,
+        0x1.5e784c5f5932ep-7,
+        0x1.5ac2d2e0a34a2p-7,
+        0x1.57213c2eb5721p-7,
+        0x1.5392ea01c26b5p-7,
+        0x1.501744908fea7p-7,
+        0x1.4cadba3c0e24ap-7,
+        0x1.4955bf40069ebp-7,
+        0x1.460ecd688773bp-7,
+        0x1.42d863cbb7708p-7,
+        0x1.3fb20687c5e8bp-7,
+        0x1.3c9b3e84af20bp-7,
+        0x1.3993993993994p-7,
+        0x1.369aa8756586ap-7,
+        0x1.33b0022ab44cp-7,
+        0x1.30d3403e62014p-7,
+        0x1.2e04005912e04p-7,
+        0x1.2b41e3bb29f9fp-7,
+        0x1.288c8f1329ceap-7,
+        0x1.25e3aa56525e4p-7,
+        0x1.2346e09b59005p-7,
+        0x1.20b5dff718d74p-7,
+        0x1.1e30595b1d047p-7,
+        0x1.1bb60075e7e5ap-7,
+        0x1.19468b94dc9d4p-7,
+        0x1.16e1b387b1f8fp-7,
+        0x1.148733855778fp-7,
+        0x1.1236c91236c91p-7,
+        0x1.0ff033e7bd6dp-7,
+        0x1.0db335dd1bb65p-7,
+        0x1.0b7f92d127571p-7,
+        0x1.0955109551095p-7,
+        0x1.073376d99dd4p-7,
+        0x1.051a8f1995706p-7,
+        0x1.030a248a1840cp-7,
+        0x1.0102040810204p-7,
+        0x1.fe03f80fe03f8p-8,
+        0x1.fa13b90bf0008p-8,
+        0x1.f632edee61d48p-8,
+        0x1.f2613c76330bdp-8,
+        0x1.ee9e4d1bf05e4p-8,
+        0x1.eae9caf795214p-8,
+        0x1.e74363a794e6dp-8,
+        0x1.e3aac739001c9p-8,
+        0x1.e01fa810b5254p-8,
+        0x1.dca1bad590433p-8,
+        0x1.d930b65b8d707p-8,
+        0x1.d5cc538fd0028p-8,
+        0x1.d2744d6584a49p-8,
+        0x1.cf2860c392dcp-8,
+        0x1.cbe84c7313e4ep-8,
+        0x1.c8b3d10e85457p-8,
+        0x1.c58ab0f1ae006p-8,
+        0x1.c26cb02a2dce8p-8,
+        0x1.bf599468ae3ecp-8,
+        0x1.bc5124f2ae0e3p-8,
+        0x1.b9532a94df72dp-8,
+        0x1.b65f6f961276dp-8,
+        0x1.b375bfaaa4e14p-8,
+        0x1.b095e7e871801p-8,
+        0x1.adbfb6bb38fa2p-8,
+        0x1.aaf2fbd97e9ecp-8,
+        0x1.a82f8839d3f15p-8,
+        0x1.a5752e088df44p-8,
+        0x1.a2c3c09ddf78ep-8,
+        0x1.a01b147453f6dp-8,
+        0x1.9d7aff1fa6a6dp-8,
+        0x1.9ae35743f1d4ep-8,
+        0x1.9853f48d32906p-8,
+        0x1.95ccafa71d129p-8,
+        0x1.934d62353e605p-8,
+        0x1.90d5e6cb67d91p-8,
+        0x1.8e6618e6618e6p-8,
+        0x1.8bfdd4e4e063ep-8,
+        0x1.899cf800bd1fap-8,
+        0x1.8743604869b31p-8,
+        0x1.84f0ec98a227bp-8,
+        0x1.82a57c9656b7bp-8,
+        0x1.8060f0a8ccbacp-8,
+        0x1.7e2329f3f429ap-8,
+        0x1.7bec0a52ef95cp-8,
+        0x1.79bb7452cc8c6p-8,
+        0x1.77914b2d6a73dp-8,
+        0x1.756d72c48e07bp-8,
+        0x1.734fcf9d1fb01p-8,
+        0x1.713846da93016p-8,
+        0x1.6f26be3a75c9bp-8,
+        0x1.6d1b1c10251efp-8,
+        0x1.6b154740a6f54p-8,
+        0x1.6915273ea6d53p-8,
+        0x1.671aa40694588p-8,
+        0x1.6525a61ae222fp-8,
+        0x1.63361680641d2p-8,
+        0x1.614bdebacbc23p-8,
+        0x1.5f66e8c9415f6p-8,
+        0x1.5d871f231931fp-8,
+        0x1.5bac6cb4a358cp-8,
+        0x1.59d6bcdc159d7p-8,
+        0x1.5805fb668e213p-8,
+        0x1.563a148d2e047p-8,
+        0x1.5472f4f24b2ap-8,
+        0x1.52b0899eb84p-8,
+        0x1.50f2bfff22415p-8,
+        0x1.4f3985e182aa7p-8,
+        0x1.4d84c972a5a54p-8,
+        0x1.4bd4793bc3764p-8,
+        0x1.4a2884202c7e1p-8,
+        0x1.4880d95b07271p-8,
+        0x1.46dd687d1f20ap-8,
+        0x1.453e216ac54cbp-8,
+        0x1.43a2f459bfcc1p-8,
+        0x1.420bd1cf499cep-8,
+        0x1.4078aa9e21408p-8,
+        0x1.3ee96fe4a5e7fp-8,
+        0x1.3d5e130b02a75p-8,
+        0x1.3bd685c16737dp-8,
+        0x1.3a52b9fe4dd3bp-8,
+        0x1.38d2a1fccdbbbp-8,
+        0x1.3756303af9faep-8,
+        0x1.35dd57784c004p-8,
+        0x1.34680ab419abap-8,
+        0x1.32f63d2c166b9p-8,
+        0x1.3187e25adf128p-8,
+        0x1.301cedf69007cp-8,
+        0x1.2eb553ef658p-8,
+        0x1.2d51086e6569bp-8,
+        0x1.2befffd412bfp-8,
+        0x1.2a922eb729eefp-8,
+        0x1.293789e366158p-8,
+        0x1.27e006584eba4p-8,
+        0x1.268b99480dd13p-8,
+        0x1.253a38164dbc2p-8,
+        0x1.23ebd8571f0b9p-8,
+        0x1.22a06fcde5c2cp-8,
+        0x1.2157f46c4de28p-8,
+        0x1.20125c5147024p-8,
+        0x1.1ecf9dc806bf2p-8,
+        0x1.1d8faf4711cc9p-8,
+        0x1.1c52876f4b723p-8,
+        0x1.1b181d0b0b46p-8,
+        0x1.19e0670d38f19p-8,
+        0x1.18ab5c906dd57p-8,
+        0x1.1778f4d61c5c5p-8,
+        0x1.16492745bcd43p-8,
+        0x1.151beb6bffa24p-8,
+        0x1.13f138fa04aa6p-8,
+        0x1.12c907c497c22p-8,
+        0x1.11a34fc3720a2p-8,
+        0x1.1080091080091p-8,
+        0x1.0f5f2be72c65p-8,
+        0x1.0e40b0a3af193p-8,
+        0x1.0d248fc261068p-8,
+        0x1.0c0ac1df13c01p-8,
+        0x1.0af33fb46d737p-8,
+        0x1.09de021b48cfdp-8,
+        0x1.08cb020a18cecp-8,
+        0x1.07ba389450425p-8,
+        0x1.06ab9ee9cd0e1p-8,
+        0x1.059f2e5646fp-8,
+        0x1.0494e040c1c0ap-8,
+        0x1.038cae2b03115p-8,
+        0x1.028691b10b111p-8,
+        0x1.0182848890a0cp-8,
+        0x1.0080808080808p-8,
+        0x1.ff00ff00ff01p-9,
+        0x1.fd04f710df408p-9,
+        0x1.fb0cdd5ff0101p-9,
+        0x1.f918a64c1f919p-9,
+        0x1.f7284661169eap-9,
+        0x1.f53bb25758f13p-9,
+        0x1.f352df136a693p-9,
+        0x1.f16dc1a4f94dep-9,
+        0x1.ef8c4f460d685p-9,
+        0x1.edae7d5a3bd61p-9,
+        0x1.ebd4416ddf756p-9,
+        0x1.e9fd913555ca9p-9,
+        0x1.e82a628c40426p-9,
+        0x1.e65aab74c9b2cp-9,
+        0x1.e48e6216efff3p-9,
+        0x1.e2c57cbfd1c49p-9,
+        0x1.e0fff1e0fff1ep-9,
+        0x1.df3db80fd3354p-9,
+        0x1.dd7ec604c522ap-9,
+        0x1.dbc3129accfd2p-9,
+        0x1.da0a94cec00b2p-9,
+        0x1.d85543beb55dfp-9,
+        0x1.d6a316a96cf73p-9,
+        0x1.d4f404edba368p-9,
+        0x1.d3480609f179cp-9,
+        0x1.d19f119b58dc7p-9,
+        0x1.cff91f5d9c01dp-9,
+        0x1.ce56272a42d68p-9,
+        0x1.ccb620f82b379p-9,
+        0x1.cb1904db056bcp-9,
+        0x1.c97ecb02d35eap-9,
+        0x1.c7e76bbb6a8afp-9,
+        0x1.c652df6bf8851p-9,
+        0x1.c4c11e968a13bp-9,
+        0x1.c33221d794c86p-9,
+        0x1.c1a5e1e58307ep-9,
+        0x1.c01c579042736p-9,
+        0x1.be957bc0d4a41p-9,
+        0x1.bd114778e22b9p-9,
+        0x1.bb8fb3d24fca5p-9,
+        0x1.ba10b9fed5cf9p-9,
+        0x1.b894534799957p-9,
+        0x1.b71a790cc90c8p-9,
+        0x1.b5a324c5384aap-9,
+        0x1.b42e4ffe0110ep-9,
+        0x1.b2bbf45a243d3p-9,
+        0x1.b14c0b922d1bep-9,
+        0x1.afde8f73d68e6p-9,
+        0x1.ae7379e1b1fc3p-9,
+        0x1.ad0ac4d2d003cp-9,
+        0x1.aba46a526ae0cp-9,
+        0x1.aa40647f927ddp-9,
+        0x1.a8dead8cda28bp-9,
+        0x1.a77f3fc007de3p-9,
+        0x1.a6221571c525cp-9,
+        0x1.a4c7290d51732p-9,
+        0x1.a36e75103605dp-9,
+        0x1.a217f409fb3d1p-9,
+        0x1.a0c3a09bdf58ep-9,
+        0x1.9f7175788e9fap-9,
+        0x1.9e216d63dce03p-9,
+        0x1.9cd3833280497p-9,
+        0x1.9b87b1c9cd8eep-9,
+        0x1.9a3df41f7553ap-9,
+        0x1.98f6453942d4cp-9,
+        0x1.97b0a02cdbcb9p-9,
+        0x1.966d001f8181p-9,
+        0x1.952b6045d30c7p-9,
+        0x1.93ebbbe390b63p-9,
+        0x1.92ae0e4b60787p-9,
+        0x1.917252de9397fp-9,
+        0x1.9038850ced4e7p-9,
+        0x1.8f00a0546a81cp-9,
+        0x1.8dcaa0410a809p-9,
+        0x1.8c96806c98c07p-9,
+        0x1.8b643c7e77972p-9,
+        0x1.8a33d02b6bea3p-9,
+        0x1.8905373569cf3p-9,
+        0x1.87d86d6b62181p-9,
+        0x1.86ad6ea910c69p-9,
+        0x1.858436d6cc616p-9,
+        0x1.845cc1e956278p-9,
+        0x1.83370be1ab1bfp-9,
+        0x1.821310ccd5e5cp-9,
+        0x1.80f0ccc3c180fp-9,
+        0x1.7fd03beb0cba3p-9,
+        0x1.7eb15a72de72fp-9,
+        0x1.7d942496baa89p-9,
+        0x1.7c78969d583b8p-9,
+        0x1.7b5eacd87772p-9,
+        0x1.7a4663a4b9327p-9,
+        0x1.792fb76976f2ap-9,
+        0x1.781aa4989b56bp-9,
+        0x1.770727ae7b7dfp-9,
+        0x1.75f53d31b0f8fp-9,
+        0x1.74e4e1b2f4659p-9,
+        0x1.73d611ccf8ae9p-9,
+        0x1.72c8ca2446ea4p-9,
+        0x1.71bd07671ad62p-9,
+        0x1.70b2c64d3febcp-9,
+        0x1.6faa0397ef0c4p-9,
+        0x1.6ea2bc11acbefp-9,
+        0x1.6d9cec8e28014p-9,
+        0x1.6c9891ea19a3cp-9,
+        0x1.6b95a90b2432ap-9,
+        0x1.6a942edfb4667p-9,
+        0x1.6994205ee21a8p-9,
+        0x1.68957a8851c6bp-9,
+        0x1.67983a6416798p-9,
+        0x1.669c5d0294509p-9,
+        0x1.65a1df7c636cep-9,
+        0x1.64a8bef233604p-9,
+        0x1.63b0f88caf121p-9,
+        0x1.62ba897c6118fp-9,
+        0x1.61c56ef99886ap-9,
+        0x1.60d1a6444e24dp-9,
+        0x1.5fdf2ca40a201p-9,
+        0x1.5eedff67ca1f2p-9,
+        0x1.5dfe1be5e7c46p-9,
+        0x1.5d0f7f7bff97ep-9,
+        0x1.5c22278ed8574p-9,
+        0x1.5b36118a4aaa9p-9,
+        0x1.5a4b3ae1293b5p-9,
+        0x1.5961a10d292ccp-9,
+        0x1.5879418ecaf27p-9,
+        0x1.579219ed4384dp-9,
+        0x1.56ac27b665f0ep-9,
+        0x1.55c7687e8d41cp-9,
+        0x1.54e3d9e086c2ap-9,
+        0x1.5401797d7c974p-9,
+        0x1.532044fce0a9bp-9,
+        0x1.52403a0c57ebp-9,
+        0x1.5161565fa5e6dp-9,
+        0x1.508397b098a6dp-9,
+        0x1.4fa6fbbef4e58p-9,
+        0x1.4ecb8050628eap-9,
+        0x1.4df12330598c3p-9,
+        0x1.4d17e2300edddp-9,
+        0x1.4c3fbb2661fa8p-9,
+        0x1.4b68abefca79ep-9,
+        0x1.4a92b26e46052p-9,
+        0x1.49bdcc89468d9p-9,
+        0x1.48e9f82da0c74p-9,
+        0x1.4817334d7ae7ep-9,
+        0x1.47457be03ba71p-9,
+        0x1.4674cfe2798p-9,
+        0x1.45a52d55ea332p-9,
+        0x1.44d6924152862p-9,
+        0x1.4408fcb076424p-9,
+        0x1.433c6ab4086eap-9,
+        0x1.4270da619bc6cp-9,
+        0x1.41a649d3936b3p-9,
+        0x1.40dcb72913cbdp-9,
+        0x1.40142085f3cb1p-9,
+        0x1.3f4c8412ae181p-9,
+        0x1.3e85dffc52c05p-9,
+        0x1.3dc0327478f64p-9,
+        0x1.3cfb79b1310d6p-9,
+        0x1.3c37b3ecf6a9ep-9,
+        0x1.3b74df66a3234p-9,
+        0x1.3ab2fa616019bp-9,
+        0x1.39f203249a3c3p-9,
+        0x1.3931f7fbf43f8p-9,
+        0x1.3872d7373a051p-9,
+        0x1.37b49f2a53f01p-9,
+        0x1.36f74e2d3a69bp-9,
+        0x1.363ae29be992p-9,
+        0x1.357f5ad6551ddp-9,
+        0x1.34c4b5405c604p-9,
+        0x1.340af041be7fcp-9,
+        0x1.33520a460ed56p-9,
+        0x1.329a01bca975dp-9,
+        0x1.31e2d518a7e3bp-9,
+        0x1.312c82d0d5ea3p-9,
+        0x1.3077095fa69f8p-9,
+        0x1.2fc26743298e4p-9,
+        0x1.2f0e9afd0005ap-9,
+        0x1.2e5ba312528f1p-9,
+        0x1.2da97e0bc689cp-9,
+        0x1.2cf82a7573eap-9,
+        0x1.2c47a6dedb1d8p-9,
+        0x1.2b97f1dadb129p-9,
+        0x1.2ae909ffa7623p-9,
+        0x1.2a3aede6be9d2p-9,
+        0x1.298d9c2ce0ba2p-9,
+        0x1.28e1137205a5cp-9,
+        0x1.2835525953f3p-9,
+        0x1.278a578917ac1p-9,
+        0x1.26e021aab942ep-9,
+        0x1.2636af6ab4a0cp-9,
+        0x1.258dff7890552p-9,
+        0x1.24e61086d4e22p-9,
+        0x1.243ee14b04277p-9,
+        0x1.2398707d90e9dp-9,
+        0x1.22f2bcd9d6785p-9,
+        0x1.224dc51e106d1p-9,
+        0x1.21a9880b528afp-9,
+        0x1.2106046580b5fp-9,
+        0x1.206338f347075p-9,
+        0x1.1fc1247e11fc1p-9,
+        0x1.1f1fc5d206bdep-9,
+        0x1.1e7f1bbdfb86p-9,
+        0x1.1ddf251370198p-9,
+        0x1.1d3fe0a6865edp-9,
+        0x1.1ca14d4dfb0bbp-9,
+        0x1.1c0369e31e6c1p-9,
+        0x1.1b663541cd406p-9,
+        0x1.1ac9ae4869b3cp-9,
+        0x1.1a2dd3d7d469ap-9,
+        0x1.1992a4d365a1dp-9,
+        0x1.18f82020e673bp-9,
+        0x1.185e44a88a1f6p-9,
+        0x1.17c51154e774bp-9,
+        0x1.172c8512f24ffp-9,
+        0x1.16949ed1f52bdp-9,
+        0x1.15fd5d838ac87p-9,
+        0x1.1566c01b97e6bp-9,
+        0x1.14d0c59045182p-9,
+        0x1.143b6cd9f8a3p-9,
+        0x1.13a6b4f35079bp-9,
+        0x1.13129cd91c45ep-9,
+        0x1.127f238a5787p-9,
+        0x1.11ec480823c2dp-9,
+        0x1.115a0955c2c9cp-9,
+        0x1.10c86678910c8p-9,
+        0x1.10375e7800048p-9,
+        0x1.0fa6f05d90ad9p-9,
+        0x1.0f171b34ce119p-9,
+        0x1.0e87de0b47e5p-9,
+        0x1.0df937f08d353p-9,
+        0x1.0d6b27f627268p-9,
+        0x1.0cddad2f93c3ap-9,
+        0x1.0c50c6b240dd6p-9,
+        0x1.0bc4739586f9cp-9,
+        0x1.0b38b2f2a453fp-9,
+        0x1.0aad83e4b7eaep-9,
+        0x1.0a22e588bca03p-9,
+        0x1.0998d6fd8465ap-9,
+        0x1.090f5763b379bp-9,
+        0x1.088665ddbbb33p-9,
+        0x1.07fe018fd7db3p-9,
+        0x1.077629a007154p-9,
+        0x1.06eedd3608561p-9,
+        0x1.06681b7b55e7cp-9,
+        0x1.05e1e39b20fc1p-9,
+        0x1.055c34c24d4c5p-9,
+        0x1.04d70e1f6cc65p-9,
+        0x1.04526ee2bb46bp-9,
+        0x1.03ce563e1a606p-9,
+        0x1.034ac3650d30bp-9,
+        0x1.02c7b58cb4402p-9,
+        0x1.02452bebc96f8p-9,
+        0x1.01c325ba9bf2p-9,
+        0x1.0141a2330c524p-9,
+        0x1.00c0a09088848p-9,
+        0x1.004020100804p-9,
+        0x1.ff803fe00ff8p-10,
+        0x1.fe813ee10ef9p-10,
+        0x1.fd833ba607745p-10,
+        0x1.fc8634b4e8b2dp-10,
+        0x1.fb8a28968f895p-10,
+        0x1.fa8f15d6bf1a5p-10,
+        0x1.f994fb0419aep-10,
+        0x1.f89bd6b0199e7p-10,
+        0x1.f7a3a76f0a595p-10,
+        0x1.f6ac6bd80176p-10,
+        0x1.f5b62284d7e02p-10,
+        0x1.f4c0ca122316p-10,
+        0x1.f3cc611f2e7afp-10,
+        0x1.f2d8e64df4bd1p-10,
+        0x1.f1e65843194e6p-10,
+        0x1.f0f4b5a5e1f0fp-10,
+        0x1.f003fd203055ap-10,
+        0x1.ef142d5e7bcd7p-10,
+        0x1.ee25450fcb0d4p-10,
+        0x1.ed3742e5ae033p-10,
+        0x1.ec4a259437be6p-10,
+        0x1.eb5debd1f867bp-10,
+        0x1.ea729457f74c2p-10,
+        0x1.e9881de1acf8p-10,
+        0x1.e89e872cfd638p-10,
+        0x1.e7b5cefa322f7p-10,
+        0x1.e6cdf40bf4f28p-10,
+        0x1.e5e6f5274996fp-10,
+        0x1.e500d11388c84p-10,
+        0x1.e41b869a5a704p-10,
+        0x1.e3371487b0444p-10,
+        0x1.e25379a9c061ap-10,
+        0x1.e170b4d0fff8fp-10,
+        0x1.e08ec4d01e08fp-10,
+        0x1.dfada87bfe27dp-10,
+        0x1.decd5eabb35b3p-10,
+        0x1.ddede6387afebp-10,
+        0x1.dd0f3dfdb7b8bp-10,
+        0x1.dc3164d8ec7cfp-10,
+        0x1.db5459a9b79d8p-10,
+        0x1.da781b51cde8ep-10,
+        0x1.d99ca8b4f5d65p-10,
+        0x1.d8c200b902befp-10,
+        0x1.d7e82245d0244p-10,
+        0x1.d70f0c453d03ep-10,
+        0x1.d636bda32737dp-10,
+        0x1.d55f354d66e3ep-10,
+        0x1.d4887233c9ef4p-10,
+        0x1.d3b273480f8a9p-10,
+        0x1.d2dd377de3c27p-10,
+        0x1.d208bdcadb1dfp-10,
+        0x1.d13505266e48cp-10,
+        0x1.d0620c89f5c9ap-10,
+        0x1.cf8fd2f0a5c43p-10,
+        0x1.cebe575789c63p-10,
+        0x1.cded98bd80a06p-10,
+        0x1.cd1d9623384a3p-10,
+        0x1.cc4e4e8b29d11p-10,
+        0x1.cb7fc0f995523p-10,
+        0x1.cab1ec747dff8p-10,
+        0x1.c9e4d003a62efp-10,
+        0x1.c9186ab08b747p-10,
+        0x1.c84cbb8662c6bp-10,
+        0x1.c781c19214ad9p-10,
+        0x1.c6b77be2397bp-10,
+        0x1.c5ede987158e5p-10,
+        0x1.c525099295a0ap-10,
+        0x1.c45cdb184b1bfp-10,
+        0x1.c3955d2d687b4p-10,
+        0x1.c2ce8ee8bdb4ap-10,
+        0x1.c2086f62b4ac9p-10,
+        0x1.c142fdb54db2bp-10,
+        0x1.c07e38fc1c07ep-10,
+        0x1.bfba2054426d3p-10,
+        0x1.bef6b2dc6fbc2p-10,
+        0x1.be33efb4db879p-10,
+        0x1.bd71d5ff42c57p-10,
+        0x1.bcb064dee4819p-10,
+        0x1.bbef9b787e987p-10,
+        0x1.bb2f78f24a7b1p-10,
+        0x1.ba6ffc73f9facp-10,
+        0x1.b9b12526b41d6p-10,
+        0x1.b8f2f23511f9fp-10,
+        0x1.b83562cb1b9d3p-10,
+        0x1.b778761644f6p-10,
+        0x1.b6bc2b456ac9dp-10,
+        0x1.b6008188cfb12p-10,
+        0x1.b5457812191b7p-10,
+        0x1.b48b0e144c5abp-10,
+        0x1.b3d142c3cbb6ap-10,
+        0x1.b318155653878p-10,
+        0x1.b25f8502f757ep-10,
+        0x1.b1a791021f0ep-10,
+        0x1.b0f0388d841c5p-10,
+        0x1.b0397ae02eb93p-10,
+        0x1.af835736731d5p-10,
+        0x1.aecdcccdeec99p-10,
+        0x1.ae18dae585d34p-10,
+        0x1.ad6480bd60378p-10,
+        0x1.acb0bd96e7357p-10,
+        0x1.abfd90b4c2ae6p-10,
+        0x1.ab4af95ad68d7p-10,
+        0x1.aa98f6ce4035p-10,
+        0x1.a9e7885553f31p-10,
+        0x1.a936ad379a7b4p-10,
+        0x1.a88664bdce682p-10,
+        0x1.a7d6ae31d9c19p-10,
+        0x1.a72788ded38a3p-10,
+        0x1.a678f410fd526p-10,
+        0x1.a5caef15c0d15p-10,
+        0x1.a51d793bad841p-10,
+        0x1.a47091d276529p-10,
+        0x1.a3c4382aef3a3p-10,
+        0x1.a3186b970afe6p-10,
+        0x1.a26d2b69d8de8p-10,
+        0x1.a1c276f782518p-10,
+        0x1.a1184d9548c79p-10,
+        0x1.a06eae9983705p-10,
+        0x1.9fc5995b9d075p-10,
+        0x1.9f1d0d3411a54p-10,
+        0x1.9e75097c6c972p-10,
+        0x1.9dcd8d8f4639cp-10,
+        0x1.9d2698c841db7p-10,
+        0x1.9c802a840ba21p-10,
+        0x1.9bda422056769p-10,
+        0x1.9b34defbd9f55p-10,
+        0x1.9a90007650639p-10,
+        0x1.99eba5f074a99p-10,
+        0x1.9947cecc0051dp-10,
+        0x1.98a47a6ba98cfp-10,
+        0x1.9801a833213a9p-10,
+        0x1.975f578710f62p-10,
+        0x1.96bd87cd19299p-10,
+        0x1.961c386bcf237p-10,
+        0x1.957b68cabb322p-10,
+        0x1.94db185256c3cp-10,
+        0x1.943b466c0a89dp-10,
+        0x1.939bf2822ca1fp-10,
+        0x1.92fd1bfffec2dp-10,
+        0x1.925ec251ac6cep-10,
+        0x1.91c0e4e449203p-10,
+        0x1.91238325ce959p-10,
+        0x1.90869c851afcbp-10,
+        0x1.8fea3071ef3ddp-10,
+        0x1.8f4e3e5ced3fdp-10,
+        0x1.8eb2c5b79632p-10,
+        0x1.8e17c5f448da3p-10,
+        0x1.8d7d3e863fe6dp-10,
+        0x1.8ce32ee190447p-10,
+        0x1.8c49967b2777bp-10,
+        0x1.8bb074c8c9fa9p-10,
+        0x1.8b17c941119e1p-10,
+        0x1.8a7f935b6beefp-10,
+        0x1.89e7d290189e8p-10,
+        0x1.8950865827ef4p-10,
+        0x1.88b9ae2d7924ap-10,
+        0x1.8823498ab8f7p-10,
+        0x1.878d57eb600a8p-10,
+        0x1.86f7d8cbb169ep-10,
+        0x1.8662cba8b904ep-10,
+        0x1.85ce30004a318p-10,
+        0x1.853a0550fe316p-10,
+        0x1.84a64b1a32b9fp-10,
+        0x1.841300dc08803p-10,
+        0x1.8380261761c8p-10,
+        0x1.82edba4de0f62p-10,
+        0x1.825bbd01e725cp-10,
+        0x1.81ca2db692c18p-10,
+        0x1.81390befbe1f2p-10,
+        0x1.80a85731fe1e9p-10,
+        0x1.80180f02a0cc3p-10,
+        0x1.7f8832e7ac06p-10,
+        0x1.7ef8c267dc23ep-10,
+        0x1.7e69bd0aa2a2cp-10,
+        0x1.7ddb225824d31p-10,
+        0x1.7d4cf1d93a89dp-10,
+        0x1.7cbf2b176cd4ap-10,
+        0x1.7c31cd9cf4b0dp-10,
+        0x1.7ba4d8f4b9c58p-10,
+        0x1.7b184caa511fbp-10,
+        0x1.7a8c2849fbf28p-10,
+        0x1.7a006b60a658cp-10,
+        0x1.7975157be61a7p-10,
+        0x1.78ea2629f9745p-10,
+        0x1.785f9cf9c5e25p-10,
+        0x1.77d5797ad6ec7p-10,
+        0x1.774bbb3d5cf6fp-10,
+        0x1.76c261d22c141p-10,
+        0x1.76396ccabad96p-10,
+        0x1.75b0dbb921374p-10,
+        0x1.7528ae3017529p-10,
+        0x1.74a0e3c2f4615p-10,
+        0x1.74197c05ad89ep-10,
+        0x1.7392768cd4c42p-10,
+        0x1.730bd2ed97bd6p-10,
+        0x1.728590bdbebedp-10,
+        0x1.71ffaf93ab963p-10,
+        0x1.717a2f0658809p-10,
+        0x1.70f50ead57181p-10,
+        0x1.70704e20cf435p-10,
+        0x1.6febecf97e278p-10,
+        0x1.6f67ead0b51ccp-10,
+        0x1.6ee4474058a45p-10,
+        0x1.6e6101e2df61dp-10,
+        0x1.6dde1a535115bp-10,
+        0x1.6d5b902d459a8p-10,
+        0x1.6cd9630ce3e45p-10,
+        0x1.6c57928ee102p-10,
+        0x1.6bd61e507f20dp-10,
+        0x1.6b5505ef8c92p-10,
+        0x1.6ad4490a62d2ap-10,
+        0x1.6a53e73fe5953p-10,
+        0x1.69d3e02f81cdbp-10,
+        0x1.695433792cbf3p-10,
+        0x1.68d4e0bd630bdp-10,
+        0x1.6855e79d27c68p-10,
+        0x1.67d747ba0386fp-10,
+        0x1.675900b6037f1p-10,
+        0x1.66db1233b892dp-10,
+        0x1.665d7bd63671dp-10,
+        0x1.65e03d4112b28p-10,
+        0x1.6563561863efdp-10,
+        0x1.64e6c600c0e81p-10,
+        0x1.646a8c9f3f9e2p-10,
+        0x1.63eea999747cp-10,
+        0x1.63731c957177dp-10,
+        0x1.62f7e539c539ep-10,
+        0x1.627d032d7a44fp-10,
+        0x1.6202761816202p-10,
+        0x1.61883da19882cp-10,
+        0x1.610e59727a816p-10,
+        0x1.6094c933adbcfp-10,
+        0x1.601b8c8e9b93ap-10,
+        0x1.5fa2a32d24536p-10,
+        0x1.5f2a0cb99e6d8p-10,
+        0x1.5eb1c8ded5acdp-10,
+        0x1.5e39d7480a6cfp-10,
+        0x1.5dc237a0f0d2ep-10,
+        0x1.5d4ae995b007ep-10,
+        0x1.5cd3ecd2e1757p-10,
+        0x1.5c5d41059002ep-10,
+        0x1.5be6e5db3754bp-10,
+        0x1.5b70db01c30d3p-10,
+        0x1.5afb20278e0eap-10,
+        0x1.5a85b4fb61bf6p-10,
+        0x1.5a10992c754ebp-10,
+        0x1.599bcc6a6cfbcp-10,
+        0x1.59274e65595ddp-10,
+        0x1.58b31ecdb6adep-10,
+        0x1.583f3d546c117p-10,
+        0x1.57cba9aacae79p-10,
+        0x1.575863828e166p-10,
+        0x1.56e56a8dd95a8p-10,
+        0x1.5672be7f3897cp-10,
+        0x1.56005f099f2b4p-10,
+        0x1.558e4be0673eep-10,
+        0x1.551c84b7511dep-10,
+        0x1.54ab0942828b2p-10,
+        0x1.5439d9368618ap-10,
+        0x1.53c8f4484a8p-10,
+        0x1.53585a2d21fcep-10,
+        0x1.52e80a9ac1a7ep-10,
+        0x1.5278054740d37p-10,
+        0x1.520849e91869dp-10,
+        0x1.5198d837224bbp-10,
+        0x1.5129afe898b13p-10,
+        0x1.50bad0b5158b1p-10,
+        0x1.504c3a5491e59p-10,
+        0x1.4fddec7f654c9p-10,
+        0x1.4f6fe6ee4530bp-10,
+        0x1.4f02295a444dfp-10,
+        0x1.4e94b37cd212fp-10,
+        0x1.4e27850fba09dp-10,
+        0x1.4dba9dcd23426p-10,
+        0x1.4d4dfd6f8fbcdp-10,
+        0x1.4ce1a3b1dbd5ep-10,
+        0x1.4c75904f3db49p-10,
+        0x1.4c09c30344b82p-10,
+        0x1.4b9e3b89d8e7ep-10,
+        0x1.4b32f99f3a63bp-10,
+        0x1.4ac7fd0000d5bp-10,
+        0x1.4a5d45691ae53p-10,
+        0x1.49f2d297cdaa6p-10,
+        0x1.4988a449b4234p-10,
+        0x1.491eba3cbea9cp-10,
+        0x1.48b5142f326a9p-10,
+        0x1.484bb1dfa8dd3p-10,
+        0x1.47e2930d0f3dp-10,
+        0x1.4779b776a6036p-10,
+        0x1.47111edc0062cp-10,
+        0x1.46a8c8fd03c28p-10,
+        0x1.4640b599e73c2p-10,
+        0x1.45d8e47333194p-10,
+        0x1.45715549c052cp-10,
+        0x1.450a07deb8106p-10,
+        0x1.44a2fbf39329fp-10,
+        0x1.443c314a19a8fp-10,
+        0x1.43d5a7a4624b8p-10,
+        0x1.436f5ec4d2081p-10,
+        0x1.4309566e1b91dp-10,
+        0x1.42a38e633edeap-10,
+        0x1.423e066788acfp-10,
+        0x1.41d8be3e920b9p-10,
+        0x1.4173b5ac3fe1ap-10,
+        0x1.410eec74c277ep-10,
+        0x1.40aa625c95027p-10,
+        0x1.404617287d2bdp-10,
+        0x1.3fe20a9d8aa08p-10,
+        0x1.3f7e3c81169b8p-10,
+        0x1.3f1aac98c373ep-10,
+        0x1.3eb75aaa7c2acp-10,
+        0x1.3e54467c73faap-10,
+        0x1.3df16fd525e6fp-10,
+        0x1.3d8ed67b544d1p-10,
+        0x1.3d2c7a3608758p-10,
+        0x1.3cca5acc92269p-10,
+        0x1.3c68780687371p-10,
+        0x1.3c06d1abc3228p-10,
+        0x1.3ba56784669d8p-10,
+        0x1.3b443958d72b8p-10,
+        0x1.3ae346f1beb4bp-10,
+        0x1.3a8290180b1d2p-10,
+        0x1.3a221494eddc8p-10,
+        0x1.39c1d431db969p-10,
+        0x1.3961ceb88bb42p-10,
+        0x1.390203f2f7fd8p-10,
+        0x1.38a273ab5c349p-10,
+        0x1.38431dac35b0cp-10,
+        0x1.37e401c042facp-10,
+        0x1.37851fb283699p-10,
+        0x1.3726774e36cp-10,
+        0x1.36c8085edccadp-10,
+        0x1.3669d2b034ffcp-10,
+        0x1.360bd60e3e1d5p-10,
+        0x1.35ae124535caap-10,
+        0x1.355087219838ep-10,
+        0x1.34f334701fc4dp-10,
+        0x1.349619fdc499p-10,
+        0x1.34393797bc50dp-10,
+        0x1.33dc8d0b799c3p-10,
+        0x1.33801a26abe3cp-10,
+        0x1.3323deb73eeep-10,
+        0x1.32c7da8b5a84ap-10,
+        0x1.326c0d71621adp-10,
+        0x1.32107737f4741p-10,
+        0x1.31b517adeb4bcp-10,
+        0x1.3159eea25afd2p-10,
+        0x1.30fefbe4922bfp-10,
+        0x1.30a43f44196dep-10,
+        0x1.3049b890b2f46p-10,
+        0x1.2fef679a5a373p-10,
+        0x1.2f954c31439f7p-10,
+        0x1.2f3b6625dc335p-10,
+        0x1.2ee1b548c9427p-10,
+        0x1.2e88396ae8127p-10,
+        0x1.2e2ef25d4d8cdp-10,
+        0x1.2dd5dff145ec9p-10,
+        0x1.2d7d01f8546cep-10,
+        0x1.2d24584432f83p-10,
+        0x1.2ccbe2a6d1d83p-10,
+        0x1.2c73a0f257659p-10,
+        0x1.2c1b92f91fb92p-10,
+        0x1.2bc3b88dbc5cfp-10,
+        0x1.2b6c1182f3fe7p-10,
+        0x1.2b149dabc2208p-10,
+        0x1.2abd5cdb56cebp-10,
+        0x1.2a664ee516506p-10,
+        0x1.2a0f739c98dd3p-10,
+        0x1.29b8cad5aa50fp-10,
+        0x1.2962546449e13p-10,
+        0x1.290c101ca9d24p-10,
+        0x1.28b5fdd32f2dbp-10,
+        0x1.28601d5c71788p-10,
+        0x1.280a6e8d3a6a5p-10,
+        0x1.27b4f13a85a4fp-10,
+        0x1.275fa539806c3p-10,
+        0x1.270a8a5f895e8p-10,
+        0x1.26b5a082302e1p-10,
+        0x1.2660e7773559fp-10,
+        0x1.260c5f1489e84p-10,
+        0x1.25b807304f209p-10,
+        0x1.2563dfa0d646ap-10,
+        0x1.250fe83ca055cp-10,
+        0x1.24bc20da5dbccp-10,
+        0x1.24688950ee1ap-10,
+        0x1.241521775ff85p-10,
+        0x1.23c1e924f08bdp-10,
+        0x1.236ee0310b6ffp-10,
+        0x1.231c06734a652p-10,
+        0x1.22c95bc3750f7p-10,
+        0x1.2276dff980b5ap-10,
+        0x1.222492ed90001p-10,
+        0x1.21d27477f2b8fp-10,
+        0x1.21808471258c6p-10,
+        0x1.212ec2b1d1c8ep-10,
+        0x1.20dd2f12cd207p-10,
+        0x1.208bc96d196a3p-10,
+        0x1.203a9199e464p-10,
+        0x1.1fe987728774ep-10,
+        0x1.1f98aad0876fep-10,
+        0x1.1f47fb8d9456ap-10,
+        0x1.1ef77983891d8p-10,
+        0x1.1ea7248c6b6fp-10,
+        0x1.1e56fc826b704p-10,
+        0x1.1e07013fe385bp-10,
+        0x1.1db7329f5817fp-10,
+        0x1.1d67907b77598p-10,
+        0x1.1d181aaf190c8p-10,
+        0x1.1cc8d1153e48dp-10,
+        0x1.1c79b3891142bp-10,
+        0x1.1c2ac1e5e511cp-10,
+        0x1.1bdbfc0735784p-10,
+        0x1.1b8d61c8a6aaep-10,
+        0x1.1b3ef3060518bp-10,
+        0x1.1af0af9b4533ap-10,
+        0x1.1aa2976483393p-10,
+        0x1.1a54aa3e02fbdp-10,
+        0x1.1a06e8042fac1p-10,
+        0x1.19b950939ba2bp-10,
+        0x1.196be3c9002aap-10,
+        0x1.191ea1813d4bcp-10,
+        0x1.18d189995995bp-10,
+        0x1.18849bee81ebp-10,
+        0x1.1837d85e094ccp-10,
+        0x1.17eb3ec568a65p-10,
+        0x1.179ecf023e99ep-10,
+        0x1.175288f24f4cdp-10,
+        0x1.17066c7384347p-10,
+        0x1.16ba7963ebe3ap-10,
+        0x1.166eafa1b9d7ep-10,
+        0x1.16230f0b46479p-10,
+        0x1.15d7977f0deffp-10,
+        0x1.158c48dbb1e3ap-10,
+        0x1.154122fff7598p-10,
+        0x1.14f625cac77bcp-10,
+        0x1.14ab511b2f375p-10,
+        0x1.1460a4d05f0bbp-10,
+        0x1.141620c9aadbp-10,
+        0x1.13cbc4e689ba1p-10,
+        0x1.1381910695c18p-10,
+        0x1.133785098bde4p-10,
+        0x1.12eda0cf4ba31p-10,
+        0x1.12a3e437d71ap-10,
+        0x1.125a4f2352964p-10,
+        0x1.1210e17204862p-10,
+        0x1.11c79b045545cp-10,
+        0x1.117e7bbacef16p-10,
+        0x1.113583761d38bp-10,
+        0x1.10ecb2170d31fp-10,
+        0x1.10a4077e8d2d7p-10,
+        0x1.105b838dac895p-10,
+        0x1.101326259b85ep-10,
+        0x1.0fcaef27ab19ap-10,
+        0x1.0f82de754cc62p-10,
+        0x1.0f3af3f0126cep-10,
+        0x1.0ef32f79ae245p-10,
+        0x1.0eab90f3f20d7p-10,
+        0x1.0e641840d0298p-10,
+        0x1.0e1cc5425a2fcp-10,
+        0x1.0dd597dac163ep-10,
+        0x1.0d8e8fec566c7p-10,
+        0x1.0d47ad5989299p-10,
+        0x1.0d00f004e88bfp-10,
+        0x1.0cba57d1226bfp-10,
+        0x1.0c73e4a103617p-10,
+        0x1.0c2d9657769b2p-10,
+        0x1.0be76cd785b6dp-10,
+        0x1.0ba1680458998p-10,
+        0x1.0b5b87c13548p-10,
+        0x1.0b15cbf17fbf7p-10,
+        0x1.0ad03478b9ce6p-10,
+        0x1.0a8ac13a82edep-10,
+        0x1.0a45721a981b3p-10,
+        0x1.0a0046fcd3b0fp-10,
+        0x1.09bb3fc52d41ap-10,
+        0x1.09765c57b9714p-10,
+        0x1.09319c98a9cffp-10,
+        0x1.08ed006c4cb46p-10,
+        0x1.08a887b70d16cp-10,
+        0x1.0864325d726bep-10,
+        0x1.08200044208p-10,
+        0x1.07dbf14fd752fp-10,
+        0x1.0798056572f34p-10,
+        0x1.07543c69eb5a6p-10,
+        0x1.071096425448ep-10,
+        0x1.06cd12d3dd228p-10,
+        0x1.0689b203d0cb2p-10,
+        0x1.064673b795832p-10,
+        0x1.060357d4acc4cp-10,
+        0x1.05c05e40b3211p-10,
+        0x1.057d86e1601d8p-10,
+        0x1.053ad19c86117p-10,
+        0x1.04f83e581204p-10,
+        0x1.04b5ccfa0b8ap-10,
+        0x1.04737d6894a48p-10,
+        0x1.04314f89e99eep-10,
+        0x1.03ef434460ed8p-10,
+        0x1.03ad587e6b0cep-10,
+        0x1.036b8f1e92605p-10,
+        0x1.0329e70b7b114p-10,
+        0x1.02e8602be2eedp-10,
+        0x1.02a6fa66a14d4p-10,
+        0x1.0265b5a2a6e5ep-10,
+        0x1.022491c6fdb6dp-10,
+        0x1.01e38ebac8e39p-10,
+        0x1.01a2ac6544951p-10,
+        0x1.0161eaadc5da4p-10,
+        0x1.0121497bba891p-10,
+        0x1.00e0c8b6a91efp-10,
+        0x1.00a0684630a28p-10,
+        0x1.0060281208842p-10,
+        0x1.0020080200802p-10,
+        0x1.ffc00ffc00ffcp-11,
+    };
+};
+
+#endif // SANDBOX_GEN_MULTIPLIERS
@@ -0,0 +1,143 @@
+#ifndef SANDBOX_GEN_TRIE
+#define SANDBOX_GEN_TRIE
+
+// This file was generated from one or more other files.
+// Hence, changes made to this file will be destroyed if
+// the generation program for this file is run again.
+
+#ifndef CHAR_TO_STRING_LITERAL
+// https://en.cppreference.com/w/cpp/language/string_literal
+// https://en.cppreference.com/w/cpp/language/escape
+#define CHAR_TO_STRING_LITERAL(c) \
+((c == '\0') ? "'\\0'" : \
+((c == '\x01') ? "'\\x01'" : \
+((c == '\x02') ? "'\\x02'" : \
+((c == '\x03') ? "'\\x03'" : \
+((c == '\x04') ? "'\\x04'" : \
+((c == '\x05') ? "'\\x05'" : \
+((c == '\x06') ? "'\\x06'" : \
+((c == '\a') ? "'\\a'" : \
+((c == '\b') ? "'\\b'" : \
+((c == '\t') ? "'\\t'" : \
+((c == '\n') ? "'\\n'" : \
+((c == '\v') ? "'\\v'" : \
+((c == '\f') ? "'\\f'" : \
+((c == '\r') ? "'\\r'" : \
+((c == '\x0e') ? "'\\x0e'" : \
+((c == '\x0f') ? "'\\x0f'" : \
+((c == '\x10') ? "'\\x10'" : \
+((c == '\x11') ? "'\\x11'" : \
+((c == '\x12') ? "'\\x12'" : \
+((c == '\x13') ? "'\\x13'" : \
+((c == '\x14') ? "'\\x14'" : \
+((c == '\x15') ? "'\\x15'" : \
+((c == '\x16') ? "'\\x16'" : \
+((c == '\x17') ? "'\\x17'" : \
+((c == '\x18') ? "'\\x18'" : \
+((c == '\x19') ? "'\\x19'" : \
+((c == '\x1a') ? "'\\x1a'" : \
+((c == '\x1b') ? "'\\x1b'" : \
+((c == '\x1c') ? "'\\x1c'" : \
+((c == '\x1d') ? "'\\x1d'" : \
+((c == '\x1e') ? "'\\x1e'" : \
+((c == '\x1f') ? "'\\x1f'" : \
+((c == ' ') ? "' '" : \
+((c == '!') ? "'!'" : \
+((c == '\"') ? "'\\\"'" : \
+((c == '#') ? "'#'" : \
+((c == '$') ? "'$'" : \
+((c == '%') ? "'%'" : \
+((c == '&') ? "'&'" : \
+((c == '\'') ? "'\\\''" : \
+((c == '(') ? "'('" : \
+((c == ')') ? "')'" : \
+((c == '*') ? "'*'" : \
+((c == '+') ? "'+'" : \
+((c == ',') ? "','" : \
+((c == '-') ? "'-'" : \
+((c == '.') ? "'.'" : \
+((c == '/') ? "'/'" : \
+((c == '0') ? "'0'" : \
+((c == '1') ? "'1'" : \
+((c == '2') ? "'2'" : \
+((c == '3') ? "'3'" : \
+((c == '4') ? "'4'" : \
+((c == '5') ? "'5'" : \
+((c == '6') ? "'6'" : \
+((c == '7') ? "'7'" : \
+((c == '8') ? "'8'" : \
+((c == '9') ? "'9'" : \
+((c == ':') ? "':'" : \
+((c == ';') ? "';'" : \
+((c == '<') ? "'<'" : \
+((c == '=') ? "'='" : \
+((c == '>') ? "'>'" : \
+((c == '\?') ? "'\\\?'" : \
+((c == '@') ? "'@'" : \
+((c == 'A') ? "'A'" : \
+((c == 'B') ? "'B'" : \
+((c == 'C') ? "'C'" : \
+((c == 'D') ? "'D'" : \
+((c == 'E') ? "'E'" : \
+((c == 'F') ? "'F'" : \
+((c == 'G') ? "'G'" : \
+((c == 'H') ? "'H'" : \
+((c == 'I') ? "'I'" : \
+((c == 'J') ? "'J'" : \
+((c == 'K') ? "'K'" : \
+((c == 'L') ? "'L'" : \
+((c == 'M') ? "'M'" : \
+((c == 'N') ? "'N'" : \
+((c == 'O') ? "'O'" : \
+((c == 'P') ? "'P'" : \
+((c == 'Q') ? "'Q'" : \
+((c == 'R') ? "'R'" : \
+((c == 'S') ? "'S'" : \
+((c == 'T') ? "'T'" : \
+((c == 'U') ? "'U'" : \
+((c == 'V') ? "'V'" : \
+((c == 'W') ? "'W'" : \
+((c == 'X') ? "'X'" : \
+((c == 'Y') ? "'Y'" : \
+((c == 'Z') ? "'Z'" : \
+((c == '[') ? "'['" : \
+((c == '\\') ? "'\\\\'" : \
+((c == ']') ? "']'" : \
+((c == '^') ? "'^'" : \
+((c == '_') ? "'_'" : \
+((c == '`') ? "'`'" : \
+((c == 'a') ? "'a'" : \
+((c == 'b') ? "'b'" : \
+((c == 'c') ? "'c'" : \
+((c == 'd') ? "'d'" : \
+((c == 'e') ? "'e'" : \
+((c == 'f') ? "'f'" : \
+((c == 'g') ? "'g'" : \
+((c == 'h') ? "'h'" : \
+((c == 'i') ? "'i'" : \
+((c == 'j') ? "'j'" : \
+((c == 'k') ? "'k'" : \
+((c == 'l') ? "'l'" : \
+((c == 'm') ? "'m'" : \
+((c == 'n') ? "'n'" : \
+((c == 'o') ? "'o'" : \
+((c == 'p') ? "'p'" : \
+((c == 'q') ? "'q'" : \
+((c == 'r') ? "'r'" : \
+((c == 's') ? "'s'" : \
+((c == 't') ? "'t'" : \
+((c == 'u') ? "'u'" : \
+((c == 'v') ? "'v'" : \
+((c == 'w') ? "'w'" : \
+((c == 'x') ? "'x'" : \
+((c == 'y') ? "'y'" : \
+((c == 'z') ? "'z'" : \
+((c == '{') ? "'{'" : \
+((c == '|') ? "'|'" : \
+((c == '}') ? "'}'" : \
+((c == '~') ? "'~'" : \
+((c == '\x7f') ? "'\\x7f'" : \
+"Could not convert this value because this value is not an integer from 0 to 127."))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
+#endif // CHAR_TO_STRING_LITERAL
+
+#endif // SANDBOX_GEN_TRIE
@@ -1,9 +1,14 @@
 #ifndef SANDBOX_CPP_APPORTIONMENT
 #define SANDBOX_CPP_APPORTIONMENT
 
+#include "cpp_apportionment_core.hpp"
+#include "cpp_apportionment_sweep.hpp"
+#include "cpp_apportionment_sensitivity.hpp"
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <map>
+#include <vector>
 #include <string>
 #include <stdexcept>
 #include <cassert>
@@ -84,8 +89,11 @@ private:
     // https://en.cppreference.com/w/cpp/container/map/find
     // https://en.cppreference.com/w/cpp/container/map/end
     // https://en.cppreference.com/w/cpp/container/map/insert
+    // https://en.cppreference.com/w/cpp/container/map/emplace_hint
     // https://en.cppreference.com/w/cpp/container/map/size
     // https://en.cppreference.com/w/cpp/container/map/clear
+    // https://en.cppreference.com/w/cpp/container/vector
+    // https://en.cppreference.com/w/cpp/container/vector/push_back
     // https://en.cppreference.com/w/cpp/utility/pair
     // https://en.cppreference.com/w/cpp/utility/pair/make_pair
     // https://en.cppreference.com/w/cpp/string/basic_string
@@ -120,14 +128,46 @@ private:
     // population of that state. There should be at least one key.
     const std::map<N, P> population_for_each_state;
 
-    // Each key is a potential size of the U.S. House of Representatives. Each key should
-    // be at least the number of states. Also, each key present in `population_for_each_state`
-    // must be present in `num_reps_for_each_size_and_state`, and vice versa.
-    std::map<R, M> num_reps_for_each_size_and_state;
+    // Element `i` is the name of the state whose index in `core` is `i`. The names are in
+    // the same order as the keys of `population_for_each_state`, so ties in priority value
+    // still go to the state whose name comes first.
+    const std::vector<N> name_for_each_index;
+
+    // The seat sequence and the seat counts, with each state identified by its index in
+    // `name_for_each_index`. A string-keyed `M` is only built when it is returned.
+    apportionment_core core;
 
 public:
     apportionment() : apportionment(us_2020_populations()) {}
-    apportionment(const std::map<N, P> &the_population_for_each_state) : population_for_each_state(the_population_for_each_state) {}
+
+    // May throw std::invalid_argument
+    apportionment(const std::map<N, P> &the_population_for_each_state)
+        : population_for_each_state(the_population_for_each_state),
+          name_for_each_index(names_of(the_population_for_each_state)),
+          core(populations_of(the_population_for_each_state)) {}
+
+private:
+    static std::vector<N> names_of(const std::map<N, P> &the_population_for_each_state)
+    {
+        std::vector<N> names;
+        names.reserve(the_population_for_each_state.size());
+        for (auto &&pair : the_population_for_each_state)
+        {
+            names.push_back(pair.first);
+        }
+        return names;
+    }
+
+    static std::vector<P> populations_of(const std::map<N, P> &the_population_for_each_state)
+    {
+        std::vector<P> populations;
+        populations.reserve(the_population_for_each_state.size());
+        for (auto &&pair : the_population_for_each_state)
+        {
+            populations.push_back(pair.second);
+        }
+        return populations;
+    }
 
 private:
     // https://www2.census.gov/programs-surveys/decennial/2020/data/apportionment/apportionment-2020-tableA.xlsx
@@ -252,71 +292,6 @@ private:
         return population_for_each_state.size();
     }
 
-    void add_next_rep(M &state_nums_reps, const N &name_of_state_with_next_rep) const
-    {
-        state_nums_reps.at(name_of_state_with_next_rep)++;
-    }
-
-    void fill_with_ones(M &state_nums_reps) const
-    {
-        state_nums_reps.clear();
-        for (auto &&pair : population_for_each_state)
-        {
-            state_nums_reps.insert(std::make_pair(pair.first, 1));
-        }
-    }
-
-    // The return value for this function must be positive.
-    static long double multiplier(R current_state_num_reps)
-    {
-        long double m = current_state_num_reps;
-        m *= (m + 1.0L);
-        m = sqrtl(m);
-        m = 1.0L / m;
-        assert(m > 0.0L);
-        return m;
-    }
-
-    // The return value for this function must be positive.
-    long double priority_value(R current_state_num_reps, const N &state_name) const
-    {
-        long double pv = multiplier(current_state_num_reps) * population_for_each_state.at(state_name);
-        assert(pv > 0.0L);
-        return pv;
-    }
-
-    N get_name_of_state_with_next_rep(const M &state_nums_reps) const
-    {
-        assert(!population_for_each_state.empty());
-
-        N name_of_state_with_next_rep;
-
-        long double max_priority_value_so_far = -1.0L;
-
-        bool first_state = true;
-
-        for (auto &&pair : population_for_each_state)
-        {
-            const R current_state_num_reps = state_nums_reps.at(pair.first);
-
-            const long double priority_value_for_this_state = priority_value(current_state_num_reps, pair.first);
-
-            assert(priority_value_for_this_state > 0.0L);
-
-            if (first_state || max_priority_value_so_far < priority_value_for_this_state)
-            {
-                max_priority_value_so_far = priority_value_for_this_state;
-                name_of_state_with_next_rep = pair.first;
-            }
-
-            first_state = false;
-        }
-
-        assert(max_priority_value_so_far > 0.0L);
-
-        return name_of_state_with_next_rep;
-    }
-
     // https://en.cppreference.com/w/cpp/language/operators
     // "Stream extraction and insertion" section
     static std::ostream &operator_os(std::ostream &os, const M &m)
@@ -443,42 +418,32 @@ private:
     }
 
 public:
+    // May throw std::invalid_argument
     M num_reps_for_each_state(R total_num_reps)
     {
-        if (num_reps_for_each_size_and_state.find(total_num_reps) == num_reps_for_each_size_and_state.end())
-        {
-            M state_nums_reps;
-
-            const std::size_t num_states = get_num_states();
+        const std::size_t num_states = get_num_states();
 
-            assert(num_states > 0);
-
-            if (total_num_reps < num_states)
-            {
-                std::string s(__PRETTY_FUNCTION__);
-                s += " -- total_num_reps must be at least ";
-                s += std::to_string(num_states);
-                throw std::invalid_argument(s);
-            }
-            else if (total_num_reps == num_states)
-            {
-                fill_with_ones(state_nums_reps);
-            }
-            else
-            {
-                state_nums_reps = num_reps_for_each_state(total_num_reps - 1);
+        assert(num_states > 0);
 
-                const N name_of_state_with_next_rep = get_name_of_state_with_next_rep(state_nums_reps);
+        if (total_num_reps < num_states)
+        {
+            std::string s(__PRETTY_FUNCTION__);
+            s += " -- total_num_reps must be at least ";
+            s += std::to_string(num_states);
+            throw std::invalid_argument(s);
+        }
 
-                add_next_rep(state_nums_reps, name_of_state_with_next_rep);
-            }
+        std::vector<R> num_reps_for_each_index;
+        core.num_reps_for_each_state(total_num_reps, num_reps_for_each_index);
 
-            if (!num_reps_for_each_size_and_state.insert(std::make_pair(total_num_reps, state_nums_reps)).second)
-            {
-                assert(num_reps_for_each_size_and_state.at(total_num_reps) == state_nums_reps);
-            }
+        M state_nums_reps;
+        for (std::size_t i = 0; i < num_states; i++)
+        {
+            state_nums_reps.emplace_hint(state_nums_reps.end(), name_for_each_index[i], num_reps_for_each_index[i]);
         }
-        return num_reps_for_each_size_and_state.at(total_num_reps);
+
+        assert(num_reps_of_all_states(state_nums_reps) == total_num_reps);
+        return state_nums_reps;
     }
 
     static void test_this_class_part_1()
@@ -551,20 +516,26 @@ public:
 
         std::cout << "total_num_reps\tmax_over_min\tmax_over_avg\tavg_over_min\n";
 
-        for (R total_num_reps = min_total_num_reps; total_num_reps <= max_total_num_reps; total_num_reps++)
-        {
+        // One incremental pass over every house size, checked against the full rescans.
+        apportionment_sweep<huntington_hill>::sweep(a.core.get_population_for_each_state(), min_total_num_reps, max_total_num_reps, [&](const apportionment_fairness_row &row)
+                                                    {
+            const R total_num_reps = row.total_num_reps;
+
             M m(a.num_reps_for_each_state(total_num_reps));
 
-            const long double max = a.max_persons_per_rep(m);
-            const long double min = a.min_persons_per_rep(m);
-            const long double avg = a.avg_persons_per_rep(total_num_reps);
+            const long double max = row.max_persons_per_rep;
+            const long double min = row.min_persons_per_rep;
+            const long double avg = row.avg_persons_per_rep;
+
+            assert(max == a.max_persons_per_rep(m));
+            assert(min == a.min_persons_per_rep(m));
+            assert(avg == a.avg_persons_per_rep(total_num_reps));
 
             const long double max_over_min = max / min;
             const long double max_over_avg = max / avg;
             const long double avg_over_min = avg / min;
 
-            std::cout << total_num_reps << '\t' << max_over_min << '\t' << max_over_avg << '\t' << avg_over_min << '\n';
-        }
+            std::cout << total_num_reps << '\t' << max_over_min << '\t' << max_over_avg << '\t' << avg_over_min << '\n'; });
     }
 
     static void test_this_class_part_5()
@@ -581,6 +552,66 @@ public:
         operator_os(std::cout << '\n', m2) << '\n';
         assert(m1 == m2);
     }
+
+    static void test_this_class_part_6()
+    {
+        // Query the house sizes out of order, so that some sizes are rebuilt from the
+        // seat sequence instead of being computed directly.
+        apportionment a;
+        M m871(a.num_reps_for_each_state(871));
+        M m435(a.num_reps_for_each_state(435));
+        M m700(a.num_reps_for_each_state(700));
+        M m50(a.num_reps_for_each_state(50));
+
+        assert(m435 == us_2020_reps());
+        assert(num_reps_of_all_states(m871) == 871);
+        assert(num_reps_of_all_states(m700) == 700);
+        assert(num_reps_of_all_states(m50) == 50);
+
+        apportionment b;
+        assert(b.num_reps_for_each_state(700) == m700);
+        assert(b.num_reps_for_each_state(871) == m871);
+
+        // A large house would have overflowed the stack when each seat needed one more
+        // level of recursion.
+        apportionment c;
+        M m(c.num_reps_for_each_state(100000));
+        assert(num_reps_of_all_states(m) == 100000);
+    }
+
+    static void test_this_class_part_7()
+    {
+        // The last seats given and the first seats missed in 2020, and how many people
+        // each state was from a seat more or a seat less.
+        apportionment a;
+        const auto analysis = apportionment_sensitivity<huntington_hill>::analyze(a.core.get_population_for_each_state(), 435);
+
+        for (auto &&seat : analysis.last_seats_given)
+        {
+            std::cout << "Seat given:  " << a.name_for_each_index[seat.index] << " " << (seat.num_reps + 1) << "\n";
+        }
+        for (auto &&seat : analysis.first_seats_missed)
+        {
+            std::cout << "Seat missed: " << a.name_for_each_index[seat.index] << " " << (seat.num_reps + 1) << "\n";
+        }
+
+        const M m435 = us_2020_reps();
+        for (std::size_t i = 0; i < a.name_for_each_index.size(); i++)
+        {
+            const auto &s = analysis.sensitivity_for_each_state[i];
+            assert(s.num_reps == m435.at(a.name_for_each_index[i]));
+            std::cout << a.name_for_each_index[i] << "\t" << s.num_reps << "\t+" << s.population_to_gain_rep << "\t-" << s.population_to_lose_rep << "\n";
+        }
+
+        // New York famously missed its 27th seat by 89 people, and Minnesota kept its 8th
+        // seat by 26.
+        const std::size_t new_york = std::find(a.name_for_each_index.begin(), a.name_for_each_index.end(), "New York") - a.name_for_each_index.begin();
+        const std::size_t minnesota = std::find(a.name_for_each_index.begin(), a.name_for_each_index.end(), "Minnesota") - a.name_for_each_index.begin();
+        assert(analysis.first_seats_missed[0].index == new_york);
+        assert(analysis.last_seats_given[0].index == minnesota);
+        assert(analysis.sensitivity_for_each_state[new_york].population_to_gain_rep == 89);
+        assert(analysis.sensitivity_for_each_state[minnesota].population_to_lose_rep == 26);
+    }
 };
 
 #endif // SANDBOX_CPP_APPORTIONMENT
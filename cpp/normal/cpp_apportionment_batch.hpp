@@ -0,0 +1,277 @@
+#ifndef SANDBOX_CPP_APPORTIONMENT_BATCH
+#define SANDBOX_CPP_APPORTIONMENT_BATCH
+
+#include "cpp_apportionment_core.hpp"
+#include "cpp_join_guard.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <thread>
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <cassert>
+
+//
+//
+//
+//
+//
+//
+// batch_apportionment
+//
+//
+// Many population scenarios over the same states, apportioned in lockstep. Each block of
+// `BLOCK_SIZE` scenarios is stored state by state, so that for every state the priority
+// values of all the scenarios in the block are next to each other. Choosing the next seat
+// of every scenario in the block is then one pass over the states that finds the highest
+// and second-highest priority values of every lane at once with SIMD compares and blends,
+// and a short scan per lane for the state that has the highest. Blocks are spread across
+// threads.
+//
+// The priority values are doubles, compared exactly when they are close, as in
+// divisor_apportionment_core. So the results are the same, and ties go to the lowest
+// index.
+template <typename D>
+class batch_apportionment final
+{
+private:
+    // https://en.cppreference.com/w/cpp/thread/thread
+    // https://en.cppreference.com/w/cpp/atomic/atomic
+    // https://gcc.gnu.org/onlinedocs/gcc/Vector-Extensions.html
+
+public:
+    typedef typename divisor_apportionment_core<D>::R R;
+    typedef typename divisor_apportionment_core<D>::P P;
+    typedef typename divisor_apportionment_core<D>::I I;
+
+    static const std::size_t BLOCK_SIZE = 8;
+
+private:
+    static constexpr double TOLERANCE = divisor_apportionment_core<D>::PRIORITY_VALUE_TOLERANCE;
+
+    // A GCC vector type: arithmetic, comparisons and `?:` act on every lane at once. 16
+    // bytes is the SIMD width that every x86-64 and AArch64 target has; a wider vector
+    // would be split into scalar operations on targets without it.
+    typedef double lanes __attribute__((vector_size(16)));
+
+    static const std::size_t LANES_PER_VECTOR = sizeof(lanes) / sizeof(double);
+    static const std::size_t NUM_VECTORS = BLOCK_SIZE / LANES_PER_VECTOR;
+
+private:
+    const std::size_t num_states;
+
+    // Element `k * num_states + i` is the population of state `i` in scenario `k`.
+    const std::vector<P> population_matrix;
+
+public:
+    // May throw std::invalid_argument
+    // `the_population_matrix` holds one row of `the_num_states` populations per scenario.
+    batch_apportionment(std::size_t the_num_states, const std::vector<P> &the_population_matrix)
+        : num_states(the_num_states), population_matrix(the_population_matrix)
+    {
+        if (num_states == 0 || population_matrix.size() % num_states)
+        {
+            std::string s(__PRETTY_FUNCTION__);
+            s += " -- there must be at least one state, and every scenario must have a population for each state";
+            throw std::invalid_argument(s);
+        }
+
+        for (auto &&population : population_matrix)
+        {
+            if (population == 0)
+            {
+                std::string s(__PRETTY_FUNCTION__);
+                s += " -- each population must be positive";
+                throw std::invalid_argument(s);
+            }
+        }
+    }
+
+public:
+    std::size_t get_num_states() const
+    {
+        return num_states;
+    }
+
+    std::size_t get_num_scenarios() const
+    {
+        return population_matrix.size() / num_states;
+    }
+
+private:
+    // Apportion scenarios `first` to `first + BLOCK_SIZE - 1` (or fewer, at the end) into
+    // `state_nums_reps_matrix`, which is laid out like `population_matrix`.
+    // `multipliers[n]` is `divisor_apportionment_core<D>::multiplier(n)`.
+    void apportion_block(std::size_t first, R total_num_reps, const std::vector<double> &multipliers, std::vector<R> &state_nums_reps_matrix) const
+    {
+        const std::size_t num_scenarios = get_num_scenarios();
+        const std::size_t num_lanes = (num_scenarios - first < BLOCK_SIZE) ? (num_scenarios - first) : BLOCK_SIZE;
+
+        // Element `i * BLOCK_SIZE + b` belongs to state `i` in lane `b`. Unused lanes
+        // repeat the first lane, and their results are thrown away.
+        std::vector<double> populations(num_states * BLOCK_SIZE);
+        std::vector<double> priority_values(num_states * BLOCK_SIZE);
+        std::vector<R> num_reps(num_states * BLOCK_SIZE, 1);
+
+        for (std::size_t i = 0; i < num_states; i++)
+        {
+            for (std::size_t b = 0; b < BLOCK_SIZE; b++)
+            {
+                const std::size_t k = first + ((b < num_lanes) ? b : 0);
+                populations[i * BLOCK_SIZE + b] = static_cast<double>(population_matrix[k * num_states + i]);
+                priority_values[i * BLOCK_SIZE + b] = multipliers[1] * populations[i * BLOCK_SIZE + b];
+            }
+        }
+
+        const double *const pv = priority_values.data();
+
+        for (R num_reps_so_far = static_cast<R>(num_states); num_reps_so_far < total_num_reps; num_reps_so_far++)
+        {
+            // The hot loop: the highest and second-highest priority values of every lane,
+            // with compares and blends and no branches.
+            lanes max_priority_values[NUM_VECTORS];
+            lanes second_priority_values[NUM_VECTORS] = {};
+            memcpy(max_priority_values, pv, sizeof(max_priority_values));
+            for (std::size_t i = 1; i < num_states; i++)
+            {
+                lanes row[NUM_VECTORS];
+                memcpy(row, pv + i * BLOCK_SIZE, sizeof(row));
+                for (std::size_t v = 0; v < NUM_VECTORS; v++)
+                {
+                    const lanes lower = (max_priority_values[v] < row[v]) ? max_priority_values[v] : row[v];
+                    second_priority_values[v] = (second_priority_values[v] < lower) ? lower : second_priority_values[v];
+                    max_priority_values[v] = (max_priority_values[v] < row[v]) ? row[v] : max_priority_values[v];
+                }
+            }
+
+            // The first state with the highest priority value wins, so ties go to the
+            // lowest index. Unless the second-highest priority value of a lane is within
+            // rounding error of the highest, the state with the highest one wins outright;
+            // otherwise every state that close needs an exact comparison.
+            for (std::size_t b = 0; b < BLOCK_SIZE; b++)
+            {
+                const double max_priority_value = max_priority_values[b / LANES_PER_VECTOR][b % LANES_PER_VECTOR];
+                const double lower_bound = max_priority_value * (1.0 - TOLERANCE);
+
+                std::size_t j = b;
+                if (second_priority_values[b / LANES_PER_VECTOR][b % LANES_PER_VECTOR] < lower_bound)
+                {
+                    while (pv[j] != max_priority_value)
+                    {
+                        j += BLOCK_SIZE;
+                    }
+                }
+                else
+                {
+                    const P *const lane_populations = population_matrix.data() + (first + ((b < num_lanes) ? b : 0)) * num_states;
+
+                    while (pv[j] < lower_bound)
+                    {
+                        j += BLOCK_SIZE;
+                    }
+                    for (std::size_t k = j + BLOCK_SIZE; k < num_states * BLOCK_SIZE; k += BLOCK_SIZE)
+                    {
+                        if (pv[k] >= lower_bound && exact_fraction::compare(D::exact_priority(num_reps[k], lane_populations[k / BLOCK_SIZE]), D::exact_priority(num_reps[j], lane_populations[j / BLOCK_SIZE])) > 0)
+                        {
+                            j = k;
+                        }
+                    }
+                }
+
+                priority_values[j] = multipliers[++num_reps[j]] * populations[j];
+            }
+        }
+
+        for (std::size_t b = 0; b < num_lanes; b++)
+        {
+            for (std::size_t i = 0; i < num_states; i++)
+            {
+                state_nums_reps_matrix[(first + b) * num_states + i] = num_reps[i * BLOCK_SIZE + b];
+            }
+        }
+    }
+
+public:
+    // May throw std::invalid_argument
+    // The number of seats of each state in each scenario, laid out like the population
+    // matrix. `num_threads` of zero means one thread per core.
+    std::vector<R> num_reps_for_each_scenario_and_state(R total_num_reps, unsigned num_threads = 0) const
+    {
+        if (total_num_reps < num_states)
+        {
+            std::string s(__PRETTY_FUNCTION__);
+            s += " -- total_num_reps must be at least ";
+            s += std::to_string(num_states);
+            throw std::invalid_argument(s);
+        }
+
+        if (num_threads == 0)
+        {
+            num_threads = std::thread::hardware_concurrency();
+            if (num_threads == 0)
+            {
+                num_threads = 1;
+            }
+        }
+
+        const std::size_t num_scenarios = get_num_scenarios();
+        const std::size_t num_blocks = (num_scenarios + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+        std::vector<R> state_nums_reps_matrix(population_matrix.size());
+
+        // No state can have more than `total_num_reps - num_states + 1` seats.
+        std::vector<double> multipliers(total_num_reps - num_states + 3);
+        for (std::size_t n = 1; n < multipliers.size(); n++)
+        {
+            multipliers[n] = divisor_apportionment_core<D>::multiplier(static_cast<R>(n));
+        }
+
+        // Each block writes to its own rows, so the threads share nothing but the counter.
+        std::atomic<std::size_t> next_block(0);
+        auto work = [&]()
+        {
+            for (std::size_t block = next_block++; block < num_blocks; block = next_block++)
+            {
+                apportion_block(block * BLOCK_SIZE, total_num_reps, multipliers, state_nums_reps_matrix);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        cpp_join_guard join_guard(threads);
+        for (unsigned t = 1; t < num_threads && t < num_blocks; t++)
+        {
+            threads.emplace_back(work);
+        }
+        work();
+        join_guard.join();
+
+        return state_nums_reps_matrix;
+    }
+
+    // May throw std::invalid_argument
+    // Element `i` of the return value is the seat distribution of state `i`: element `n`
+    // of that is the number of scenarios in which state `i` has `n` seats.
+    std::vector<std::vector<uint64_t>> seat_distribution_for_each_state(R total_num_reps, unsigned num_threads = 0) const
+    {
+        const std::vector<R> state_nums_reps_matrix = num_reps_for_each_scenario_and_state(total_num_reps, num_threads);
+
+        std::vector<std::vector<uint64_t>> distributions(num_states);
+        for (std::size_t k = 0; k < get_num_scenarios(); k++)
+        {
+            for (std::size_t i = 0; i < num_states; i++)
+            {
+                const R n = state_nums_reps_matrix[k * num_states + i];
+                if (distributions[i].size() <= n)
+                {
+                    distributions[i].resize(n + 1, 0);
+                }
+                distributions[i][n]++;
+            }
+        }
+        return distributions;
+    }
+};
+
+#endif // SANDBOX_CPP_APPORTIONMENT_BATCH
@@ -0,0 +1,336 @@
+#ifndef SANDBOX_CPP_APPORTIONMENT_BENCHMARK
+#define SANDBOX_CPP_APPORTIONMENT_BENCHMARK
+
+#include "cpp_apportionment.hpp"
+#include "cpp_apportionment_core.hpp"
+#include "cpp_apportionment_reference.hpp"
+#include "cpp_apportionment_hamilton.hpp"
+#include "cpp_apportionment_divisor_search.hpp"
+#include "cpp_apportionment_batch.hpp"
+#include "cpp_apportionment_loader.hpp"
+#include "cpp_apportionment_hierarchy.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+class cpp_apportionment_benchmark
+{
+private:
+    // https://en.cppreference.com/w/cpp/chrono/steady_clock
+    // https://en.cppreference.com/w/cpp/chrono/duration/duration_cast
+    template <typename F>
+    static double seconds_taken(F f)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count();
+    }
+
+    static void write_result(const std::string &name, std::size_t num_states, apportionment::R total_num_reps, double seconds)
+    {
+        std::cout << name << '\t' << num_states << '\t' << total_num_reps << '\t' << seconds << '\n';
+    }
+
+    // A made-up set of states whose populations are spread out like real ones.
+    static std::map<apportionment::N, apportionment::P> synthetic_populations(std::size_t num_states)
+    {
+        std::map<apportionment::N, apportionment::P> m;
+        apportionment::P population = 40000000;
+        for (std::size_t i = 0; i < num_states; i++)
+        {
+            m.insert(std::make_pair("State " + std::to_string(i), population));
+            population = population * 97 / 100 + 1;
+        }
+        return m;
+    }
+
+    static std::vector<apportionment::P> synthetic_dense_populations(std::size_t num_states)
+    {
+        std::vector<apportionment::P> v;
+        for (auto &&pair : synthetic_populations(num_states))
+        {
+            v.push_back(pair.second);
+        }
+        return v;
+    }
+
+    template <typename D>
+    static void benchmark_divisor_method(const std::vector<apportionment::P> &populations, apportionment::R total_num_reps)
+    {
+        std::vector<apportionment::R> v;
+        const double seconds = seconds_taken([&]()
+                                             { v = divisor_apportionment_core<D>(populations).num_reps_for_each_state(total_num_reps); });
+        write_result(D::name(), populations.size(), total_num_reps, seconds);
+    }
+
+public:
+    // Compare the string-keyed reference engine, the `apportionment` class and the dense
+    // `apportionment_core` on the same populations.
+    static void benchmark_dense_core()
+    {
+        std::cout << "engine\tnum_states\ttotal_num_reps\tseconds\n";
+
+        for (std::size_t num_states : {50, 500})
+        {
+            const auto populations = synthetic_populations(num_states);
+            const apportionment::R total_num_reps = static_cast<apportionment::R>(num_states * 10);
+
+            const auto dense_populations = synthetic_dense_populations(num_states);
+
+            apportionment::M m1, m2;
+            std::vector<apportionment::R> v;
+
+            const double reference_seconds = seconds_taken([&]()
+                                                           { m1 = apportionment_reference::num_reps_for_each_state(populations, total_num_reps); });
+            const double apportionment_seconds = seconds_taken([&]()
+                                                               { m2 = apportionment(populations).num_reps_for_each_state(total_num_reps); });
+            const double core_seconds = seconds_taken([&]()
+                                                      { v = apportionment_core(dense_populations).num_reps_for_each_state(total_num_reps); });
+
+            write_result("reference", num_states, total_num_reps, reference_seconds);
+            write_result("apportionment", num_states, total_num_reps, apportionment_seconds);
+            write_result("apportionment_core", num_states, total_num_reps, core_seconds);
+
+            assert(m1 == m2);
+        }
+    }
+
+    // Apportion the same populations with every method.
+    static void benchmark_methods()
+    {
+        std::cout << "method\tnum_states\ttotal_num_reps\tseconds\n";
+
+        for (std::size_t num_states : {50, 500})
+        {
+            const auto populations = synthetic_dense_populations(num_states);
+            const apportionment::R total_num_reps = static_cast<apportionment::R>(num_states * 10);
+
+            benchmark_divisor_method<huntington_hill>(populations, total_num_reps);
+            benchmark_divisor_method<webster>(populations, total_num_reps);
+            benchmark_divisor_method<jefferson>(populations, total_num_reps);
+            benchmark_divisor_method<adams>(populations, total_num_reps);
+            benchmark_divisor_method<dean>(populations, total_num_reps);
+
+            std::vector<apportionment::R> v;
+            const double seconds = seconds_taken([&]()
+                                                 { v = hamilton_apportionment::num_reps_for_each_state(populations, total_num_reps); });
+            write_result("hamilton", num_states, total_num_reps, seconds);
+        }
+    }
+
+    // Compare computing every huntington_hill priority value from `sqrtl()` with looking its
+    // multiplier up in the generated table.
+    static void benchmark_multiplier_table()
+    {
+        std::cout << "multiplier\tnum_priority_values\tseconds\n";
+
+        const apportionment::R max_num_reps = cpp_gen_multiplier_table<huntington_hill>::MAX_NUM_REPS;
+        const int num_rounds = 10000;
+        const apportionment::P population = 40000000;
+        volatile double sink = 0.0;
+
+        const double computed_seconds = seconds_taken([&]()
+                                                      {
+            for (int k = 0; k < num_rounds; k++)
+            {
+                double sum = 0.0;
+                for (apportionment::R n = 1; n <= max_num_reps; n++)
+                {
+                    sum += static_cast<double>(huntington_hill::multiplier(n)) * static_cast<double>(population + k);
+                }
+                sink = sink + sum;
+            } });
+        std::cout << "computed\t" << static_cast<uint64_t>(num_rounds) * max_num_reps << '\t' << computed_seconds << '\n';
+
+        const double table_seconds = seconds_taken([&]()
+                                                   {
+            for (int k = 0; k < num_rounds; k++)
+            {
+                double sum = 0.0;
+                for (apportionment::R n = 1; n <= max_num_reps; n++)
+                {
+                    sum += apportionment_core::priority_value(n, population + k);
+                }
+                sink = sink + sum;
+            } });
+        std::cout << "table\t" << static_cast<uint64_t>(num_rounds) * max_num_reps << '\t' << table_seconds << '\n';
+    }
+
+    // Compare seat-by-seat apportionment with the divisor search as the house grows.
+    static void benchmark_divisor_search()
+    {
+        std::cout << "engine\tnum_states\ttotal_num_reps\tseconds\n";
+
+        const std::size_t num_states = 1000;
+        const auto populations = synthetic_dense_populations(num_states);
+
+        for (apportionment::R total_num_reps : {10000, 100000, 1000000, 10000000})
+        {
+            std::vector<apportionment::R> v1, v2;
+
+            if (total_num_reps <= 100000)
+            {
+                const double core_seconds = seconds_taken([&]()
+                                                          { v1 = apportionment_core(populations).num_reps_for_each_state(total_num_reps); });
+                write_result("apportionment_core", num_states, total_num_reps, core_seconds);
+            }
+
+            const double search_seconds = seconds_taken([&]()
+                                                        { v2 = divisor_search_apportionment<huntington_hill>::num_reps_for_each_state(populations, total_num_reps); });
+            write_result("divisor_search_apportionment", num_states, total_num_reps, search_seconds);
+
+            assert(v1.empty() || v1 == v2);
+        }
+    }
+
+    // Monte Carlo scenarios: each state's population is jittered by up to 1%. Compare
+    // apportioning the scenarios one at a time with the batch, on one thread and on all.
+    static void benchmark_batch()
+    {
+        std::cout << "engine\tnum_states\ttotal_num_reps\tseconds\n";
+
+        const std::size_t num_states = 50;
+        const std::size_t num_scenarios = 20000;
+        const apportionment::R total_num_reps = 435;
+        const auto populations = synthetic_dense_populations(num_states);
+
+        std::mt19937 generator(20250131);
+        std::uniform_real_distribution<double> jitter(0.99, 1.01);
+        std::vector<apportionment::P> population_matrix;
+        for (std::size_t k = 0; k < num_scenarios; k++)
+        {
+            for (auto &&population : populations)
+            {
+                population_matrix.push_back(static_cast<apportionment::P>(population * jitter(generator)));
+            }
+        }
+
+        std::vector<apportionment::R> v1, v2, v3;
+
+        const double core_seconds = seconds_taken([&]()
+                                                  {
+            for (std::size_t k = 0; k < num_scenarios; k++)
+            {
+                const std::vector<apportionment::P> scenario(population_matrix.begin() + k * num_states, population_matrix.begin() + (k + 1) * num_states);
+                const auto v = apportionment_core(scenario).num_reps_for_each_state(total_num_reps);
+                v1.insert(v1.end(), v.begin(), v.end());
+            } });
+        write_result("apportionment_core x " + std::to_string(num_scenarios), num_states, total_num_reps, core_seconds);
+
+        const batch_apportionment<huntington_hill> batch(num_states, population_matrix);
+
+        const double batch_1_seconds = seconds_taken([&]()
+                                                     { v2 = batch.num_reps_for_each_scenario_and_state(total_num_reps, 1); });
+        write_result("batch_apportionment x " + std::to_string(num_scenarios) + ", 1 thread", num_states, total_num_reps, batch_1_seconds);
+
+        const double batch_all_seconds = seconds_taken([&]()
+                                                       { v3 = batch.num_reps_for_each_scenario_and_state(total_num_reps); });
+        write_result("batch_apportionment x " + std::to_string(num_scenarios) + ", all threads", num_states, total_num_reps, batch_all_seconds);
+
+        assert(v1 == v2 && v2 == v3);
+    }
+
+    // Load a district-level TSV file with a million rows, first with std::getline and a
+    // std::string per field, then by mapping the file and parsing views into it.
+    static void benchmark_loader()
+    {
+        std::cout << "loader\tnum_rows\tmegabytes\tseconds\tmegabytes_per_second\n";
+
+        const std::size_t num_rows = 1000000;
+        char path[] = "/tmp/cpp_apportionment_benchmark_XXXXXX";
+        const int fd = mkstemp(path);
+        assert(fd != -1);
+        close(fd);
+        {
+            std::ofstream ofs(path);
+            ofs << "district\tpopulation\n";
+            for (std::size_t i = 0; i < num_rows; i++)
+            {
+                ofs << "District " << i << '\t' << (700000 + (i * 7919) % 100000) << '\n';
+            }
+        }
+
+        population_table::format f;
+        f.delimiter = '\t';
+
+        std::vector<std::string> names;
+        std::vector<population_table::P> populations;
+        std::size_t num_bytes = 0;
+        const double getline_seconds = seconds_taken([&]()
+                                                     {
+            std::ifstream ifs(path);
+            std::string line;
+            std::getline(ifs, line);
+            num_bytes += line.size() + 1;
+            while (std::getline(ifs, line))
+            {
+                num_bytes += line.size() + 1;
+                const std::size_t tab = line.find('\t');
+                names.push_back(line.substr(0, tab));
+                populations.push_back(std::stoull(line.substr(tab + 1)));
+            } });
+        const double megabytes = num_bytes / 1e6;
+        std::cout << "getline\t" << num_rows << '\t' << megabytes << '\t' << getline_seconds << '\t' << megabytes / getline_seconds << '\n';
+
+        std::unique_ptr<mapped_file> file;
+        population_table t;
+        const double mapped_seconds = seconds_taken([&]()
+                                                    {
+            file.reset(new mapped_file(path));
+            t.parse(file->contents(), f); });
+        std::cout << "mapped_file + population_table\t" << num_rows << '\t' << megabytes << '\t' << mapped_seconds << '\t' << megabytes / mapped_seconds << '\n';
+
+        // Again, now that the pages are mapped and read.
+        population_table u;
+        const double parse_seconds = seconds_taken([&]()
+                                                   { u.parse(file->contents(), f); });
+        std::cout << "population_table\t" << num_rows << '\t' << megabytes << '\t' << parse_seconds << '\t' << megabytes / parse_seconds << '\n';
+
+        assert(t.population_for_each_state == populations);
+        unlink(path);
+    }
+
+    // Apportion 50 states, then 2000 districts in each of them, on one thread and on all.
+    // About 50 seats per state, so most districts get none, which needs a method defined
+    // from zero seats, such as Webster.
+    static void benchmark_hierarchy()
+    {
+        std::cout << "engine\tnum_districts\ttotal_num_reps\tseconds\n";
+
+        const std::size_t num_states = 50;
+        const std::size_t num_districts = 2000;
+        const apportionment::R total_num_reps = 2500;
+
+        std::vector<std::vector<apportionment::P>> district_populations;
+        for (std::size_t i = 0; i < num_states; i++)
+        {
+            std::vector<apportionment::P> populations;
+            for (std::size_t j = 0; j < num_districts; j++)
+            {
+                populations.push_back(10000 + (i * 7919 + j * 104729) % 50000);
+            }
+            district_populations.push_back(populations);
+        }
+
+        hierarchical_apportionment<webster>::result r1, r2;
+        const double one_seconds = seconds_taken([&]()
+                                                 { r1 = hierarchical_apportionment<webster>::apportion(district_populations, total_num_reps, 1); });
+        write_result("hierarchical_apportionment, 1 thread", num_states * num_districts, total_num_reps, one_seconds);
+
+        const double all_seconds = seconds_taken([&]()
+                                                 { r2 = hierarchical_apportionment<webster>::apportion(district_populations, total_num_reps); });
+        write_result("hierarchical_apportionment, all threads", num_states * num_districts, total_num_reps, all_seconds);
+
+        assert(r1.num_reps_for_each_district == r2.num_reps_for_each_district);
+    }
+};
+
+#endif // SANDBOX_CPP_APPORTIONMENT_BENCHMARK
@@ -0,0 +1,13 @@
+#include "cpp_apportionment_benchmark.hpp"
+
+int main()
+{
+    cpp_apportionment_benchmark::benchmark_dense_core();
+    cpp_apportionment_benchmark::benchmark_methods();
+    cpp_apportionment_benchmark::benchmark_multiplier_table();
+    cpp_apportionment_benchmark::benchmark_divisor_search();
+    cpp_apportionment_benchmark::benchmark_batch();
+    cpp_apportionment_benchmark::benchmark_loader();
+    cpp_apportionment_benchmark::benchmark_hierarchy();
+    return 0;
+}
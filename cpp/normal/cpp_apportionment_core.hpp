@@ -0,0 +1,277 @@
+#ifndef SANDBOX_CPP_APPORTIONMENT_CORE
+#define SANDBOX_CPP_APPORTIONMENT_CORE
+
+#include "cpp_apportionment_methods.hpp"
+#include "../gen/output/cpp_gen_multipliers.hpp"
+#include <cstdint>
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <cassert>
+
+//
+//
+//
+//
+//
+//
+// divisor_apportionment_core
+//
+//
+// A divisor method (see cpp_apportionment_methods.hpp), with each state identified by a
+// dense index instead of by its name. Populations, seat counts and the priority value of
+// each state's next seat are kept in parallel arrays, so choosing the next seat is a
+// single scan over one contiguous array. `D` is the divisor method. Its multipliers come
+// from a table generated at build time (see cpp/gen/input/cpp_gen_main.cpp), so giving a
+// seat costs a table load and a multiply; only a state with more seats than the table
+// covers calls `D::multiplier()`.
+//
+// Priority values are doubles. Two doubles that are further apart than their rounding
+// errors are compared as they are; closer ones are compared exactly with
+// `D::exact_priority()`, so the order of the seats is exact, and exact ties go to the
+// lowest index.
+template <typename D>
+class divisor_apportionment_core final
+{
+private:
+    // https://en.cppreference.com/w/cpp/container/vector
+    // https://en.cppreference.com/w/cpp/container/vector/reserve
+    // https://en.cppreference.com/w/cpp/container/vector/assign
+    // https://en.cppreference.com/w/cpp/container/vector/push_back
+    // https://en.cppreference.com/w/cpp/types/integer
+    // https://en.cppreference.com/w/cpp/language/templates
+    // https://en.cppreference.com/w/cpp/error/invalid_argument
+    // https://en.cppreference.com/w/cpp/error/assert
+
+public:
+    // A state's number of U.S. Representatives.
+    // These numbers should be less than UINT32_MAX.
+    typedef uint32_t R;
+
+    // A state's population.
+    // These numbers should be positive.
+    typedef uint64_t P;
+
+    // A state's index. The states are numbered from 0 to `get_num_states() - 1`.
+    typedef uint32_t I;
+
+private:
+    // Element `i` is the population of state `i`. There should be at least one element.
+    const std::vector<P> population_for_each_state;
+
+    // Element `i` is the number of seats of state `i`, given a house size of
+    // `largest_total_num_reps()`.
+    std::vector<R> num_reps_for_each_state_at_largest_size;
+
+    // Element `i` is the priority value of the next seat of state `i`, given a house size
+    // of `largest_total_num_reps()`.
+    std::vector<double> priority_value_for_each_state;
+
+    // Element `k` is the index of the state that won seat number `get_num_states() + 1 + k`.
+    std::vector<I> seat_sequence;
+
+public:
+    // May throw std::invalid_argument
+    divisor_apportionment_core(const std::vector<P> &the_population_for_each_state)
+        : population_for_each_state(the_population_for_each_state)
+    {
+        if (population_for_each_state.empty())
+        {
+            std::string s(__PRETTY_FUNCTION__);
+            s += " -- there must be at least one state";
+            throw std::invalid_argument(s);
+        }
+
+        for (auto &&population : population_for_each_state)
+        {
+            if (population == 0)
+            {
+                std::string s(__PRETTY_FUNCTION__);
+                s += " -- each population must be positive";
+                throw std::invalid_argument(s);
+            }
+        }
+
+        const std::size_t num_states = get_num_states();
+
+        num_reps_for_each_state_at_largest_size.assign(num_states, 1);
+
+        priority_value_for_each_state.resize(num_states);
+        for (std::size_t i = 0; i < num_states; i++)
+        {
+            priority_value_for_each_state[i] = priority_value(1, population_for_each_state[i]);
+        }
+    }
+
+public:
+    std::size_t get_num_states() const
+    {
+        return population_for_each_state.size();
+    }
+
+    // The largest house size computed so far.
+    R largest_total_num_reps() const
+    {
+        return static_cast<R>(get_num_states() + seat_sequence.size());
+    }
+
+    const std::vector<P> &get_population_for_each_state() const
+    {
+        return population_for_each_state;
+    }
+
+    // Element `k` is the index of the state that won seat number `get_num_states() + 1 + k`.
+    const std::vector<I> &get_seat_sequence() const
+    {
+        return seat_sequence;
+    }
+
+public:
+    // Each priority value below is within a relative error of 3 * 2^-53 of the true value:
+    // one rounding each for the multiplier, the population and the product. So if two of
+    // them differ by more than this factor, the larger one is larger exactly.
+    static constexpr double PRIORITY_VALUE_TOLERANCE = 0x1p-50;
+
+    // `D::multiplier()`, rounded to a double.
+    static double multiplier(R current_state_num_reps)
+    {
+        typedef cpp_gen_multiplier_table<D> T;
+        // Element 0 of the table is unused, and zero wraps around to fail this test.
+        if (current_state_num_reps - 1 < T::MAX_NUM_REPS)
+        {
+            return T::VALUES[current_state_num_reps];
+        }
+        return static_cast<double>(D::multiplier(current_state_num_reps));
+    }
+
+    // The return value for this function must be positive.
+    static double priority_value(R current_state_num_reps, P population)
+    {
+        double pv = multiplier(current_state_num_reps) * static_cast<double>(population);
+        assert(pv > 0.0);
+        return pv;
+    }
+
+    // Negative if the next seat of state `a` comes after the next seat of state `b`, zero
+    // if they tie exactly, and positive if it comes before. `pv_a` and `pv_b` are their
+    // `priority_value()`s.
+    static int compare_priority_values(double pv_a, R a_num_reps, P a_population, double pv_b, R b_num_reps, P b_population)
+    {
+        if (pv_a > pv_b * (1.0 + PRIORITY_VALUE_TOLERANCE))
+        {
+            return 1;
+        }
+        if (pv_b > pv_a * (1.0 + PRIORITY_VALUE_TOLERANCE))
+        {
+            return -1;
+        }
+        return exact_fraction::compare(D::exact_priority(a_num_reps, a_population), D::exact_priority(b_num_reps, b_population));
+    }
+
+private:
+    // The first state with the highest priority value wins, so ties go to the lowest index.
+    // Only a priority value close to the highest so far needs an exact comparison.
+    I get_index_of_state_with_next_rep() const
+    {
+        const double *const pv = priority_value_for_each_state.data();
+        const std::size_t num_states = get_num_states();
+
+        std::size_t index_so_far = 0;
+        double upper_bound = pv[0] * (1.0 + PRIORITY_VALUE_TOLERANCE);
+        double lower_bound = pv[0] * (1.0 - PRIORITY_VALUE_TOLERANCE);
+
+        for (std::size_t i = 1; i < num_states; i++)
+        {
+            if (pv[i] > upper_bound || (pv[i] >= lower_bound && compare_exactly(i, index_so_far) > 0))
+            {
+                index_so_far = i;
+                upper_bound = pv[i] * (1.0 + PRIORITY_VALUE_TOLERANCE);
+                lower_bound = pv[i] * (1.0 - PRIORITY_VALUE_TOLERANCE);
+            }
+        }
+
+        return static_cast<I>(index_so_far);
+    }
+
+    int compare_exactly(std::size_t a, std::size_t b) const
+    {
+        return exact_fraction::compare(D::exact_priority(num_reps_for_each_state_at_largest_size[a], population_for_each_state[a]),
+                                       D::exact_priority(num_reps_for_each_state_at_largest_size[b], population_for_each_state[b]));
+    }
+
+    void add_next_rep(I index_of_state_with_next_rep)
+    {
+        const R num_reps = ++num_reps_for_each_state_at_largest_size[index_of_state_with_next_rep];
+        priority_value_for_each_state[index_of_state_with_next_rep] = priority_value(num_reps, population_for_each_state[index_of_state_with_next_rep]);
+        seat_sequence.push_back(index_of_state_with_next_rep);
+    }
+
+public:
+    // Assign seats one at a time until the house has at least `total_num_reps` seats.
+    void extend_seat_sequence(R total_num_reps)
+    {
+        if (largest_total_num_reps() >= total_num_reps)
+        {
+            return;
+        }
+
+        seat_sequence.reserve(total_num_reps - get_num_states());
+
+        while (largest_total_num_reps() < total_num_reps)
+        {
+            add_next_rep(get_index_of_state_with_next_rep());
+        }
+    }
+
+    // May throw std::invalid_argument
+    // Write the number of seats of each state into `state_nums_reps`. Start from whichever
+    // end of the seat sequence is closer to `total_num_reps`, so this costs O(states) plus
+    // the distance to that end.
+    void num_reps_for_each_state(R total_num_reps, std::vector<R> &state_nums_reps)
+    {
+        const std::size_t num_states = get_num_states();
+
+        if (total_num_reps < num_states)
+        {
+            std::string s(__PRETTY_FUNCTION__);
+            s += " -- total_num_reps must be at least ";
+            s += std::to_string(num_states);
+            throw std::invalid_argument(s);
+        }
+
+        extend_seat_sequence(total_num_reps);
+
+        const R largest = largest_total_num_reps();
+
+        if (largest - total_num_reps <= total_num_reps - num_states)
+        {
+            state_nums_reps = num_reps_for_each_state_at_largest_size;
+            for (std::size_t k = largest - num_states; k > total_num_reps - num_states; k--)
+            {
+                assert(state_nums_reps[seat_sequence[k - 1]] > 1);
+                state_nums_reps[seat_sequence[k - 1]]--;
+            }
+        }
+        else
+        {
+            state_nums_reps.assign(num_states, 1);
+            for (std::size_t k = 0; k < total_num_reps - num_states; k++)
+            {
+                state_nums_reps[seat_sequence[k]]++;
+            }
+        }
+    }
+
+    // May throw std::invalid_argument
+    std::vector<R> num_reps_for_each_state(R total_num_reps)
+    {
+        std::vector<R> state_nums_reps;
+        num_reps_for_each_state(total_num_reps, state_nums_reps);
+        return state_nums_reps;
+    }
+};
+
+// The Method of Equal Proportions (see cpp_apportionment.hpp).
+typedef divisor_apportionment_core<huntington_hill> apportionment_core;
+
+#endif // SANDBOX_CPP_APPORTIONMENT_CORE
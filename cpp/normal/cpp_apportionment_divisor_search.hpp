@@ -0,0 +1,296 @@
+#ifndef SANDBOX_CPP_APPORTIONMENT_DIVISOR_SEARCH
+#define SANDBOX_CPP_APPORTIONMENT_DIVISOR_SEARCH
+
+#include "cpp_apportionment_core.hpp"
+#include <cstdint>
+#include <vector>
+#include <queue>
+#include <string>
+#include <stdexcept>
+#include <cassert>
+
+//
+//
+//
+//
+//
+//
+// divisor_search_apportionment
+//
+//
+// The same divisor methods as divisor_apportionment_core, but without assigning the
+// seats one at a time, so the cost depends on the number of states rather than on the
+// house size.
+//
+// Seat by seat, a divisor method always gives the next seat to the highest priority value
+// among each state's next seat (ties go to the lowest index). Each state's priority values
+// decrease from seat to seat, so the seats of a house of size `h` are exactly the `h - S`
+// highest priority values overall, where `S` is the number of states.
+//
+// First, guess a cutoff from the average number of persons per seat, and give each state
+// every seat whose priority value is above the cutoff. That is within about one seat per
+// state of the right answer. Then correct it with a heap: if too few seats were given,
+// keep giving the next seat to the highest priority value left; if too many, keep taking
+// back the seat with the lowest priority value given. This costs O(S log S).
+//
+// num_reps_for_each_state_from_zero() is the same with each state starting from no seats
+// rather than one, for the methods where that is defined (see D::from_zero()).
+template <typename D>
+class divisor_search_apportionment final
+{
+private:
+    // https://en.cppreference.com/w/cpp/container/priority_queue
+    // https://en.cppreference.com/w/cpp/container/vector
+
+public:
+    typedef typename divisor_apportionment_core<D>::R R;
+    typedef typename divisor_apportionment_core<D>::P P;
+    typedef typename divisor_apportionment_core<D>::I I;
+
+public:
+    // The next seat of a state that has `num_reps` seats: its priority value, plus what is
+    // needed to compare it exactly.
+    class candidate final
+    {
+    public:
+        double priority_value = 0.0;
+        R num_reps = 0;
+        P population = 0;
+        I index = 0;
+
+    public:
+        candidate(R the_num_reps, P the_population, I the_index)
+            : priority_value(divisor_apportionment_core<D>::priority_value(the_num_reps, the_population)), num_reps(the_num_reps), population(the_population), index(the_index) {}
+
+    public:
+        // Whether a seat-by-seat apportionment would give this seat before `other`.
+        bool comes_before(const candidate &other) const
+        {
+            const int c = divisor_apportionment_core<D>::compare_priority_values(priority_value, num_reps, population, other.priority_value, other.num_reps, other.population);
+            if (c != 0)
+            {
+                return c > 0;
+            }
+            return index < other.index;
+        }
+    };
+
+    // For a std::priority_queue whose top is the next seat to give.
+    class comes_later final
+    {
+    public:
+        bool operator()(const candidate &a, const candidate &b) const { return b.comes_before(a); }
+    };
+
+    // For a std::priority_queue whose top is the last seat given.
+    class comes_sooner final
+    {
+    public:
+        bool operator()(const candidate &a, const candidate &b) const { return a.comes_before(b); }
+    };
+
+private:
+    static double priority_value(R current_state_num_reps, P population)
+    {
+        return divisor_apportionment_core<D>::priority_value(current_state_num_reps, population);
+    }
+
+    // The number of seats a state gets if it gets every seat whose priority value is above
+    // `cutoff`, but no fewer than `min_num_reps` and no more than `max_num_reps`. Every
+    // divisor of every method is between `n` and `n + 1`, so `population / cutoff` is
+    // within a seat or two of the answer.
+    static R num_reps_above_cutoff(P population, long double cutoff, R min_num_reps, R max_num_reps)
+    {
+        const long double guess = population / cutoff;
+        R n = (guess >= max_num_reps) ? max_num_reps : ((guess < min_num_reps) ? min_num_reps : static_cast<R>(guess));
+
+        while (n > min_num_reps && !(priority_value(n - 1, population) > cutoff))
+        {
+            n--;
+        }
+        while (n < max_num_reps && priority_value(n, population) > cutoff)
+        {
+            n++;
+        }
+
+        return n;
+    }
+
+public:
+    // May throw std::invalid_argument
+    static std::vector<R> num_reps_for_each_state(const std::vector<P> &population_for_each_state, R total_num_reps)
+    {
+        const std::size_t num_states = population_for_each_state.size();
+
+        if (num_states == 0 || total_num_reps < num_states)
+        {
+            std::string s(__PRETTY_FUNCTION__);
+            s += " -- total_num_reps must be at least the number of states, which must be positive";
+            throw std::invalid_argument(s);
+        }
+
+        return apportion(population_for_each_state, total_num_reps, 1);
+    }
+
+    // May throw std::invalid_argument
+    // The same, but each state starts with no seats, so some may get none. Only for the
+    // methods whose D::from_zero() is true.
+    static std::vector<R> num_reps_for_each_state_from_zero(const std::vector<P> &population_for_each_state, R total_num_reps)
+    {
+        if (!D::from_zero())
+        {
+            std::string s(__PRETTY_FUNCTION__);
+            s += " -- ";
+            s += D::name();
+            s += " gives every state a seat before any state a second";
+            throw std::invalid_argument(s);
+        }
+
+        if (population_for_each_state.empty())
+        {
+            std::string s(__PRETTY_FUNCTION__);
+            s += " -- the number of states must be positive";
+            throw std::invalid_argument(s);
+        }
+
+        return apportion(population_for_each_state, total_num_reps, 0);
+    }
+
+private:
+    // Each state starts with `min_num_reps` seats, and `total_num_reps` is at least
+    // `min_num_reps` times the number of states.
+    static std::vector<R> apportion(const std::vector<P> &population_for_each_state, R total_num_reps, R min_num_reps)
+    {
+        const std::size_t num_states = population_for_each_state.size();
+
+        long double total_population = 0.0L;
+        for (auto &&population : population_for_each_state)
+        {
+            if (population == 0)
+            {
+                std::string s(__PRETTY_FUNCTION__);
+                s += " -- each population must be positive";
+                throw std::invalid_argument(s);
+            }
+            total_population += population;
+        }
+
+        std::vector<R> state_nums_reps(num_states, min_num_reps);
+        if (total_num_reps == 0)
+        {
+            return state_nums_reps;
+        }
+
+        const R num_extra_reps = static_cast<R>(total_num_reps - num_states * min_num_reps);
+
+        // The first guess.
+        const long double cutoff = total_population / total_num_reps;
+
+        uint64_t num_extra_reps_so_far = 0;
+        for (std::size_t i = 0; i < num_states; i++)
+        {
+            state_nums_reps[i] = num_reps_above_cutoff(population_for_each_state[i], cutoff, min_num_reps, num_extra_reps + min_num_reps);
+            num_extra_reps_so_far += state_nums_reps[i] - min_num_reps;
+        }
+
+        if (num_extra_reps_so_far < num_extra_reps)
+        {
+            // Too few. Give the next seats in the same order as a seat-by-seat apportionment.
+            std::priority_queue<candidate, std::vector<candidate>, comes_later> next_seats;
+            for (std::size_t i = 0; i < num_states; i++)
+            {
+                next_seats.push(candidate(state_nums_reps[i], population_for_each_state[i], static_cast<I>(i)));
+            }
+            for (; num_extra_reps_so_far < num_extra_reps; num_extra_reps_so_far++)
+            {
+                const I i = next_seats.top().index;
+                next_seats.pop();
+                state_nums_reps[i]++;
+                next_seats.push(candidate(state_nums_reps[i], population_for_each_state[i], i));
+            }
+        }
+        else if (num_extra_reps_so_far > num_extra_reps)
+        {
+            // Too many. Take back the seats in the reverse of that order.
+            std::priority_queue<candidate, std::vector<candidate>, comes_sooner> last_seats;
+            for (std::size_t i = 0; i < num_states; i++)
+            {
+                if (state_nums_reps[i] > min_num_reps)
+                {
+                    last_seats.push(candidate(state_nums_reps[i] - 1, population_for_each_state[i], static_cast<I>(i)));
+                }
+            }
+            for (; num_extra_reps_so_far > num_extra_reps; num_extra_reps_so_far--)
+            {
+                const I i = last_seats.top().index;
+                last_seats.pop();
+                state_nums_reps[i]--;
+                if (state_nums_reps[i] > min_num_reps)
+                {
+                    last_seats.push(candidate(state_nums_reps[i] - 1, population_for_each_state[i], i));
+                }
+            }
+        }
+
+        exchange_misordered_seats(population_for_each_state, min_num_reps, state_nums_reps);
+
+        return state_nums_reps;
+    }
+
+    // The cutoff is compared with rounded priority values, so a seat whose priority value
+    // is within rounding error of the cutoff may be on the wrong side of it. While the best
+    // seat not given comes before the worst seat given, swap them. This almost never does
+    // anything, and costs O(S log S) to build the two heaps when it does not.
+    static void exchange_misordered_seats(const std::vector<P> &population_for_each_state, R min_num_reps, std::vector<R> &state_nums_reps)
+    {
+        const std::size_t num_states = population_for_each_state.size();
+
+        std::priority_queue<candidate, std::vector<candidate>, comes_later> next_seats;
+        std::priority_queue<candidate, std::vector<candidate>, comes_sooner> last_seats;
+        for (std::size_t i = 0; i < num_states; i++)
+        {
+            next_seats.push(candidate(state_nums_reps[i], population_for_each_state[i], static_cast<I>(i)));
+            if (state_nums_reps[i] > min_num_reps)
+            {
+                last_seats.push(candidate(state_nums_reps[i] - 1, population_for_each_state[i], static_cast<I>(i)));
+            }
+        }
+
+        while (!last_seats.empty())
+        {
+            // Either entry may be out of date after an earlier swap.
+            const candidate next = next_seats.top();
+            if (next.num_reps != state_nums_reps[next.index])
+            {
+                next_seats.pop();
+                continue;
+            }
+            const candidate last = last_seats.top();
+            if (last.num_reps + 1 != state_nums_reps[last.index])
+            {
+                last_seats.pop();
+                continue;
+            }
+            if (!next.comes_before(last))
+            {
+                break;
+            }
+
+            next_seats.pop();
+            last_seats.pop();
+            state_nums_reps[next.index]++;
+            state_nums_reps[last.index]--;
+
+            for (const I i : {next.index, last.index})
+            {
+                next_seats.push(candidate(state_nums_reps[i], population_for_each_state[i], i));
+                if (state_nums_reps[i] > min_num_reps)
+                {
+                    last_seats.push(candidate(state_nums_reps[i] - 1, population_for_each_state[i], i));
+                }
+            }
+        }
+    }
+};
+
+#endif // SANDBOX_CPP_APPORTIONMENT_DIVISOR_SEARCH
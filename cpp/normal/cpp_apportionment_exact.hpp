@@ -0,0 +1,80 @@
+#ifndef SANDBOX_CPP_APPORTIONMENT_EXACT
+#define SANDBOX_CPP_APPORTIONMENT_EXACT
+
+#include <cassert>
+
+//
+//
+//
+//
+//
+//
+// exact_fraction
+//
+//
+// A nonnegative fraction whose numerator and denominator are 128-bit unsigned integers.
+// The divisor methods (see cpp_apportionment_methods.hpp) use it to order two seats
+// exactly when their floating-point priority values are too close to tell apart.
+class exact_fraction final
+{
+private:
+    // https://gcc.gnu.org/onlinedocs/gcc/_005f_005fint128.html
+    // https://gcc.gnu.org/onlinedocs/gcc/Alternate-Keywords.html
+    // https://en.wikipedia.org/wiki/Continued_fraction
+
+public:
+    // `__extension__` keeps -Wpedantic quiet.
+    __extension__ typedef unsigned __int128 U;
+
+public:
+    U numerator = 0;
+
+    // This number must be positive.
+    U denominator = 1;
+
+public:
+    exact_fraction(U the_numerator, U the_denominator) : numerator(the_numerator), denominator(the_denominator)
+    {
+        assert(denominator > 0);
+    }
+
+public:
+    // Negative if `a < b`, zero if `a == b`, positive if `a > b`.
+    // Cross-multiplying could need 256 bits, so compare the continued fractions instead:
+    // if the whole parts differ, they decide; otherwise compare the remainders, whose
+    // reciprocals compare the other way around. This is Euclid's algorithm on both
+    // fractions at once, so it ends after O(log) steps.
+    static int compare(exact_fraction a, exact_fraction b)
+    {
+        int sign = 1;
+
+        for (;;)
+        {
+            const U a_whole_part = a.numerator / a.denominator;
+            const U b_whole_part = b.numerator / b.denominator;
+            if (a_whole_part != b_whole_part)
+            {
+                return (a_whole_part < b_whole_part) ? -sign : sign;
+            }
+
+            const U a_remainder = a.numerator % a.denominator;
+            const U b_remainder = b.numerator % b.denominator;
+            if (a_remainder == 0 || b_remainder == 0)
+            {
+                if (a_remainder == b_remainder)
+                {
+                    return 0;
+                }
+                return (a_remainder == 0) ? -sign : sign;
+            }
+
+            // a_remainder / a.denominator < b_remainder / b.denominator exactly when
+            // a.denominator / a_remainder > b.denominator / b_remainder.
+            a = exact_fraction(a.denominator, a_remainder);
+            b = exact_fraction(b.denominator, b_remainder);
+            sign = -sign;
+        }
+    }
+};
+
+#endif // SANDBOX_CPP_APPORTIONMENT_EXACT
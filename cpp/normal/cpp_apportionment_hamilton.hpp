@@ -0,0 +1,133 @@
+#ifndef SANDBOX_CPP_APPORTIONMENT_HAMILTON
+#define SANDBOX_CPP_APPORTIONMENT_HAMILTON
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <cassert>
+
+//
+//
+//
+//
+//
+//
+// hamilton_apportionment
+//
+//
+// The Method of Largest Remainders, or Hamilton-Vinton (see "Hamilton-Vinton Method" in
+// https://crsreports.congress.gov/product/pdf/R/R45951).
+//
+// Each state's quota is its share of the total population times the house size. Each
+// state gets the whole part of its quota, and the seats that are left over go to the
+// states with the largest fractional parts. Like the divisor methods, every state gets at
+// least one seat: states whose quota is below one are given one seat and set aside, and
+// the quotas of the other states are computed again from the seats that remain.
+//
+// All of the arithmetic is done on integers, so ties are exact. A tie goes to the state
+// with the lowest index.
+class hamilton_apportionment final
+{
+private:
+    // https://en.cppreference.com/w/cpp/algorithm/sort
+    // https://gcc.gnu.org/onlinedocs/gcc/_005f_005fint128.html
+    // https://gcc.gnu.org/onlinedocs/gcc/Alternate-Keywords.html
+
+public:
+    typedef uint32_t R;
+    typedef uint64_t P;
+    typedef uint32_t I;
+
+private:
+    // `P * R` always fits in this type. `__extension__` keeps -Wpedantic quiet.
+    __extension__ typedef unsigned __int128 U;
+
+public:
+    // May throw std::invalid_argument
+    static std::vector<R> num_reps_for_each_state(const std::vector<P> &population_for_each_state, R total_num_reps)
+    {
+        const std::size_t num_states = population_for_each_state.size();
+
+        if (num_states == 0 || total_num_reps < num_states)
+        {
+            std::string s(__PRETTY_FUNCTION__);
+            s += " -- total_num_reps must be at least the number of states, which must be positive";
+            throw std::invalid_argument(s);
+        }
+
+        std::vector<R> state_nums_reps(num_states, 0);
+
+        // Set aside each state whose quota is below one, until none are left.
+        U remaining_population = 0;
+        for (auto &&population : population_for_each_state)
+        {
+            if (population == 0)
+            {
+                std::string s(__PRETTY_FUNCTION__);
+                s += " -- each population must be positive";
+                throw std::invalid_argument(s);
+            }
+            remaining_population += population;
+        }
+        R remaining_num_reps = total_num_reps;
+
+        bool set_aside_another_state = true;
+        while (set_aside_another_state)
+        {
+            set_aside_another_state = false;
+            for (std::size_t i = 0; i < num_states; i++)
+            {
+                // A quota below one means population * remaining_num_reps < remaining_population.
+                if (!state_nums_reps[i] && static_cast<U>(population_for_each_state[i]) * remaining_num_reps < remaining_population)
+                {
+                    state_nums_reps[i] = 1;
+                    remaining_population -= population_for_each_state[i];
+                    remaining_num_reps--;
+                    set_aside_another_state = true;
+                }
+            }
+        }
+
+        if (!remaining_num_reps)
+        {
+            return state_nums_reps;
+        }
+
+        // Give each remaining state the whole part of its quota.
+        std::vector<U> remainder_for_each_state(num_states, 0);
+        std::vector<I> indices_of_remaining_states;
+        R num_reps_left_over = remaining_num_reps;
+
+        for (std::size_t i = 0; i < num_states; i++)
+        {
+            if (!state_nums_reps[i])
+            {
+                const U numerator = static_cast<U>(population_for_each_state[i]) * remaining_num_reps;
+                const R whole_part = static_cast<R>(numerator / remaining_population);
+                assert(whole_part >= 1);
+                state_nums_reps[i] = whole_part;
+                remainder_for_each_state[i] = numerator % remaining_population;
+                num_reps_left_over -= whole_part;
+                indices_of_remaining_states.push_back(static_cast<I>(i));
+            }
+        }
+
+        assert(num_reps_left_over <= indices_of_remaining_states.size());
+
+        // Give the seats that are left over to the largest remainders. Every remainder has
+        // the same denominator, so they can be compared as integers.
+        std::sort(indices_of_remaining_states.begin(), indices_of_remaining_states.end(), [&](I i, I j)
+                  { return (remainder_for_each_state[i] != remainder_for_each_state[j]) ? (remainder_for_each_state[i] > remainder_for_each_state[j]) : (i < j); });
+
+        for (R k = 0; k < num_reps_left_over; k++)
+        {
+            state_nums_reps[indices_of_remaining_states[k]]++;
+        }
+
+        return state_nums_reps;
+    }
+};
+
+#endif // SANDBOX_CPP_APPORTIONMENT_HAMILTON
@@ -0,0 +1,158 @@
+#ifndef SANDBOX_CPP_APPORTIONMENT_HIERARCHY
+#define SANDBOX_CPP_APPORTIONMENT_HIERARCHY
+
+#include "cpp_apportionment_divisor_search.hpp"
+#include "cpp_join_guard.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <thread>
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <cassert>
+
+//
+//
+//
+//
+//
+//
+// hierarchical_apportionment
+//
+//
+// Seats for the states, and then each state's seats for its districts. The population of a
+// state is the sum of the populations of its districts. The states are apportioned with
+// the divisor method `D` (with divisor_search_apportionment), so every state gets at least
+// one seat. A state with at least as many seats as districts apportions them with `D` as
+// well, so each of its districts gets at least one. A state with fewer seats than
+// districts (say 50 seats for thousands of districts) cannot give each one, so its
+// districts start from no seats (divisor_search_apportionment::num_reps_for_each_state_from_zero),
+// and most of them get none. That is defined only for the methods whose D::from_zero() is
+// true (Webster and Jefferson). For the others, such a state throws std::invalid_argument.
+//
+// The states are apportioned once, on the calling thread. Then the states' districts are
+// apportioned on `num_threads` threads, largest states first. Each state's districts are
+// apportioned by one thread, into that state's own slot, so the results do not depend on
+// the number of threads or on which thread takes which state.
+template <typename D>
+class hierarchical_apportionment final
+{
+private:
+    // https://en.cppreference.com/w/cpp/thread/thread
+    // https://en.cppreference.com/w/cpp/atomic/atomic
+    // https://en.cppreference.com/w/cpp/error/exception_ptr
+
+public:
+    typedef typename divisor_search_apportionment<D>::R R;
+    typedef typename divisor_search_apportionment<D>::P P;
+    typedef typename divisor_search_apportionment<D>::I I;
+
+    class result final
+    {
+    public:
+        // Element `i` is the number of seats of state `i`.
+        std::vector<R> num_reps_for_each_state;
+
+        // Element `j` of element `i` is the number of seats of district `j` of state `i`.
+        std::vector<std::vector<R>> num_reps_for_each_district;
+    };
+
+public:
+    // May throw std::invalid_argument
+    // Element `j` of element `i` of `district_populations` is the population of district
+    // `j` of state `i`. `num_threads` of zero means one thread per core. If more than one
+    // state cannot be apportioned, the exception of the one with the lowest index is thrown.
+    static result apportion(const std::vector<std::vector<P>> &district_populations, R total_num_reps, unsigned num_threads = 0)
+    {
+        const std::size_t num_states = district_populations.size();
+
+        std::vector<P> population_for_each_state(num_states, 0);
+        for (std::size_t i = 0; i < num_states; i++)
+        {
+            for (auto &&population : district_populations[i])
+            {
+                if (population_for_each_state[i] > UINT64_MAX - population)
+                {
+                    std::string s(__PRETTY_FUNCTION__);
+                    s += " -- the population of state ";
+                    s += std::to_string(i);
+                    s += " is too large";
+                    throw std::invalid_argument(s);
+                }
+                population_for_each_state[i] += population;
+            }
+        }
+
+        result r;
+        r.num_reps_for_each_state = divisor_search_apportionment<D>::num_reps_for_each_state(population_for_each_state, total_num_reps);
+        r.num_reps_for_each_district.resize(num_states);
+
+        if (num_threads == 0)
+        {
+            num_threads = std::thread::hardware_concurrency();
+            if (num_threads == 0)
+            {
+                num_threads = 1;
+            }
+        }
+
+        // The states with the most districts take the longest, so start them first. Ties
+        // keep index order, so the schedule is the same every time.
+        std::vector<I> schedule(num_states);
+        for (std::size_t i = 0; i < num_states; i++)
+        {
+            schedule[i] = static_cast<I>(i);
+        }
+        std::stable_sort(schedule.begin(), schedule.end(), [&](I a, I b)
+                         { return district_populations[a].size() > district_populations[b].size(); });
+
+        std::vector<std::exception_ptr> exception_for_each_state(num_states);
+        std::atomic<std::size_t> next(0);
+
+        auto work = [&]()
+        {
+            for (std::size_t k = next++; k < num_states; k = next++)
+            {
+                const I i = schedule[k];
+                try
+                {
+                    if (r.num_reps_for_each_state[i] >= district_populations[i].size())
+                    {
+                        r.num_reps_for_each_district[i] = divisor_search_apportionment<D>::num_reps_for_each_state(district_populations[i], r.num_reps_for_each_state[i]);
+                    }
+                    else
+                    {
+                        r.num_reps_for_each_district[i] = divisor_search_apportionment<D>::num_reps_for_each_state_from_zero(district_populations[i], r.num_reps_for_each_state[i]);
+                    }
+                }
+                catch (...)
+                {
+                    exception_for_each_state[i] = std::current_exception();
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        cpp_join_guard join_guard(threads);
+        for (unsigned t = 1; t < num_threads && t < num_states; t++)
+        {
+            threads.emplace_back(work);
+        }
+        work();
+        join_guard.join();
+
+        for (auto &&e : exception_for_each_state)
+        {
+            if (e)
+            {
+                std::rethrow_exception(e);
+            }
+        }
+
+        return r;
+    }
+};
+
+#endif // SANDBOX_CPP_APPORTIONMENT_HIERARCHY
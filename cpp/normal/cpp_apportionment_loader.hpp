@@ -0,0 +1,312 @@
+#ifndef SANDBOX_CPP_APPORTIONMENT_LOADER
+#define SANDBOX_CPP_APPORTIONMENT_LOADER
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <stdexcept>
+#include <system_error>
+#include <cassert>
+
+//
+//
+//
+//
+//
+//
+// mapped_file
+//
+//
+// A whole file, mapped read-only into memory. Nothing is read until it is touched, and
+// nothing is copied. Views into `contents()` are valid for as long as this object is.
+class mapped_file final
+{
+private:
+    // https://www.man7.org/linux/man-pages/man2/open.2.html
+    // https://www.man7.org/linux/man-pages/man2/fstat.2.html
+    // https://www.man7.org/linux/man-pages/man2/mmap.2.html
+    // https://www.man7.org/linux/man-pages/man2/madvise.2.html
+    // https://en.cppreference.com/w/cpp/error/system_error
+
+    const char *data = nullptr;
+    std::size_t size = 0;
+
+public:
+    // May throw std::system_error
+    mapped_file(const std::string &path)
+    {
+        const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1)
+        {
+            throw_system_error("open", path);
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) == -1)
+        {
+            const int errnum = errno;
+            close(fd);
+            errno = errnum;
+            throw_system_error("fstat", path);
+        }
+
+        // mmap() refuses a length of zero.
+        size = static_cast<std::size_t>(st.st_size);
+        if (size > 0)
+        {
+            void *p = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED)
+            {
+                const int errnum = errno;
+                close(fd);
+                errno = errnum;
+                throw_system_error("mmap", path);
+            }
+            data = static_cast<const char *>(p);
+
+            // The file is parsed from start to end, once.
+            madvise(p, size, MADV_SEQUENTIAL);
+        }
+
+        // The mapping keeps its own reference to the file.
+        close(fd);
+    }
+
+    mapped_file(const mapped_file &) = delete;
+    mapped_file &operator=(const mapped_file &) = delete;
+
+    ~mapped_file()
+    {
+        if (data)
+        {
+            munmap(const_cast<char *>(data), size);
+        }
+    }
+
+private:
+    [[noreturn]] static void throw_system_error(const char *function_name, const std::string &path)
+    {
+        std::string s(__PRETTY_FUNCTION__);
+        s += " -- ";
+        s += function_name;
+        s += " failed for ";
+        s += path;
+        throw std::system_error(errno, std::generic_category(), s);
+    }
+
+public:
+    std::string_view contents() const
+    {
+        return std::string_view(data, size);
+    }
+};
+
+//
+//
+//
+//
+//
+//
+// population_table
+//
+//
+// The names and populations of a delimited file (CSV, TSV, and so on), as parallel arrays
+// indexed the way divisor_apportionment_core indexes states. Each name is a view into the
+// parsed text, so parsing allocates nothing per field; only the two arrays grow.
+//
+// Each line is one state. Fields are separated by `delimiter`, and a field may be wrapped in
+// double quotes so that it can contain the delimiter. Unless the delimiter is a tab, a
+// population may contain commas as thousands separators (as in "39,538,223"), in groups of
+// exactly three digits. Lines may end in "\n" or "\r\n", and blank lines are skipped.
+class population_table final
+{
+private:
+    // https://en.cppreference.com/w/cpp/string/basic_string_view
+    // https://www.rfc-editor.org/rfc/rfc4180
+    // https://www.man7.org/linux/man-pages/man3/memchr.3.html
+
+public:
+    typedef uint64_t P;
+
+    class format final
+    {
+    public:
+        char delimiter = ',';
+
+        // Whether the first line names the columns instead of being a state.
+        bool has_header = true;
+
+        // Columns are numbered from 0.
+        std::size_t name_column = 0;
+        std::size_t population_column = 1;
+    };
+
+public:
+    std::vector<std::string_view> name_for_each_state;
+    std::vector<P> population_for_each_state;
+
+public:
+    std::size_t get_num_states() const
+    {
+        return population_for_each_state.size();
+    }
+
+private:
+    [[noreturn]] static void throw_invalid_line(std::size_t line_number, const char *reason)
+    {
+        std::string s(__PRETTY_FUNCTION__);
+        s += " -- line ";
+        s += std::to_string(line_number);
+        s += ": ";
+        s += reason;
+        throw std::invalid_argument(s);
+    }
+
+    // The next field of `line`, starting at `position`. Afterwards, `position` is just past
+    // the delimiter that ends the field, or past the end of the line.
+    static std::string_view next_field(std::string_view line, std::size_t &position, char delimiter, std::size_t line_number)
+    {
+        const char *const begin = line.data() + position;
+        const std::size_t length = line.size() - position;
+
+        if (length > 0 && *begin == '"')
+        {
+            const char *const close = static_cast<const char *>(memchr(begin + 1, '"', length - 1));
+            if (!close)
+            {
+                throw_invalid_line(line_number, "a quoted field is never closed");
+            }
+            const std::size_t after = close + 1 - line.data();
+            if (after < line.size() && line[after] != delimiter)
+            {
+                throw_invalid_line(line_number, "a quoted field is followed by something other than the delimiter (escaped quotes are not supported)");
+            }
+            position = after + 1;
+            return std::string_view(begin + 1, close - begin - 1);
+        }
+
+        const char *const end = static_cast<const char *>(memchr(begin, delimiter, length));
+        if (!end)
+        {
+            position = line.size() + 1;
+            return std::string_view(begin, length);
+        }
+        position = end + 1 - line.data();
+        return std::string_view(begin, end - begin);
+    }
+
+    static P parse_population(std::string_view field, bool allow_thousands_separators, std::size_t line_number)
+    {
+        P population = 0;
+        bool has_digit = false;
+
+        // The digits since the last comma, and whether there has been one. The first group
+        // may have one to three digits, and every group after a comma exactly three.
+        std::size_t num_digits_in_group = 0;
+        bool has_comma = false;
+
+        for (const char c : field)
+        {
+            if (c >= '0' && c <= '9')
+            {
+                const P digit = static_cast<P>(c - '0');
+                if (population > (UINT64_MAX - digit) / 10)
+                {
+                    throw_invalid_line(line_number, "the population is too large");
+                }
+                population = population * 10 + digit;
+                has_digit = true;
+                num_digits_in_group++;
+            }
+            else if (c == ',' && allow_thousands_separators)
+            {
+                if (num_digits_in_group == 0 || num_digits_in_group > 3 || (has_comma && num_digits_in_group != 3))
+                {
+                    throw_invalid_line(line_number, "the population has a comma that does not separate thousands");
+                }
+                num_digits_in_group = 0;
+                has_comma = true;
+            }
+            else
+            {
+                throw_invalid_line(line_number, "the population is not a number");
+            }
+        }
+        if (has_comma && num_digits_in_group != 3)
+        {
+            throw_invalid_line(line_number, "the population has a comma that does not separate thousands");
+        }
+        if (!has_digit || population == 0)
+        {
+            throw_invalid_line(line_number, "the population must be a positive number");
+        }
+        return population;
+    }
+
+public:
+    // May throw std::invalid_argument
+    // Append the states in `text`. The names are views into `text`.
+    void parse(std::string_view text, const format &f)
+    {
+        std::size_t line_number = 0;
+        const std::size_t last_column = (f.name_column > f.population_column) ? f.name_column : f.population_column;
+
+        while (!text.empty())
+        {
+            line_number++;
+
+            const char *const newline = static_cast<const char *>(memchr(text.data(), '\n', text.size()));
+            std::string_view line = newline ? text.substr(0, newline - text.data()) : text;
+            text.remove_prefix(newline ? line.size() + 1 : text.size());
+
+            if (!line.empty() && line.back() == '\r')
+            {
+                line.remove_suffix(1);
+            }
+            if (line.empty() || (line_number == 1 && f.has_header))
+            {
+                continue;
+            }
+
+            std::string_view name;
+            std::string_view population;
+            std::size_t position = 0;
+            for (std::size_t column = 0; column <= last_column; column++)
+            {
+                if (position > line.size())
+                {
+                    throw_invalid_line(line_number, "there are too few fields");
+                }
+                const std::string_view field = next_field(line, position, f.delimiter, line_number);
+                if (column == f.name_column)
+                {
+                    name = field;
+                }
+                if (column == f.population_column)
+                {
+                    population = field;
+                }
+            }
+
+            name_for_each_state.push_back(name);
+            population_for_each_state.push_back(parse_population(population, f.delimiter != '\t', line_number));
+        }
+    }
+
+    // May throw std::invalid_argument
+    static population_table parsed(std::string_view text, const format &f)
+    {
+        population_table t;
+        t.parse(text, f);
+        return t;
+    }
+};
+
+#endif // SANDBOX_CPP_APPORTIONMENT_LOADER
@@ -0,0 +1,202 @@
+#ifndef SANDBOX_CPP_APPORTIONMENT_METHODS
+#define SANDBOX_CPP_APPORTIONMENT_METHODS
+
+#include "cpp_apportionment_exact.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cassert>
+
+// https://crsreports.congress.gov/product/pdf/R/R45951
+// https://en.wikipedia.org/wiki/Highest_averages_method
+//
+// Each class below is a divisor method, for use as the template parameter of
+// divisor_apportionment_core (see cpp_apportionment_core.hpp). Every state starts with
+// one seat. A state that currently has `n` seats has a priority value of
+// `multiplier(n) * P` for its next seat, where `P` is its population and where
+// `multiplier(n)` is one over the method's divisor for `n`. Each `multiplier()` must be
+// positive for every `n` of at least 1, and must decrease as `n` increases.
+//
+// `from_zero()` is whether `multiplier(0)` is positive as well, so that a state may also
+// start with no seats (see divisor_search_apportionment::num_reps_for_each_state_from_zero).
+// Where it is not, the first seat's divisor is zero, and every state must get one.
+//
+// `exact_priority(n, P)` is an exact fraction that orders seats the same way as
+// `multiplier(n) * P` does. It is used only to break near-ties between floating-point
+// priority values (see divisor_apportionment_core::compare_priority_values).
+
+//
+//
+//
+//
+//
+//
+// huntington_hill
+//
+//
+// The Method of Equal Proportions (see cpp_apportionment.hpp).
+// The divisor is the geometric mean of n and n + 1.
+class huntington_hill final
+{
+public:
+    static const char *name() { return "huntington_hill"; }
+
+    static bool from_zero() { return false; }
+
+    // The return value for this function must be positive.
+    static long double multiplier(uint32_t current_state_num_reps)
+    {
+        long double m = current_state_num_reps;
+        m *= (m + 1.0L);
+        m = sqrtl(m);
+        m = 1.0L / m;
+        assert(m > 0.0L);
+        return m;
+    }
+
+    // The square of the priority value: P * P / (n * (n + 1)).
+    static exact_fraction exact_priority(uint32_t current_state_num_reps, uint64_t population)
+    {
+        const exact_fraction::U n = current_state_num_reps;
+        return exact_fraction(static_cast<exact_fraction::U>(population) * population, n * (n + 1));
+    }
+};
+
+//
+//
+//
+//
+//
+//
+// webster
+//
+//
+// The Method of Major Fractions, or Sainte-Laguë.
+// The divisor is the arithmetic mean of n and n + 1.
+class webster final
+{
+public:
+    static const char *name() { return "webster"; }
+
+    static bool from_zero() { return true; }
+
+    // The return value for this function must be positive.
+    static long double multiplier(uint32_t current_state_num_reps)
+    {
+        const long double m = 1.0L / (current_state_num_reps + 0.5L);
+        assert(m > 0.0L);
+        return m;
+    }
+
+    // 2 * P / (2 * n + 1).
+    static exact_fraction exact_priority(uint32_t current_state_num_reps, uint64_t population)
+    {
+        const exact_fraction::U n = current_state_num_reps;
+        return exact_fraction(static_cast<exact_fraction::U>(population) * 2, 2 * n + 1);
+    }
+};
+
+//
+//
+//
+//
+//
+//
+// jefferson
+//
+//
+// The Method of Greatest Divisors, or D'Hondt.
+// The divisor is n + 1.
+class jefferson final
+{
+public:
+    static const char *name() { return "jefferson"; }
+
+    static bool from_zero() { return true; }
+
+    // The return value for this function must be positive.
+    static long double multiplier(uint32_t current_state_num_reps)
+    {
+        const long double m = 1.0L / (current_state_num_reps + 1.0L);
+        assert(m > 0.0L);
+        return m;
+    }
+
+    // P / (n + 1).
+    static exact_fraction exact_priority(uint32_t current_state_num_reps, uint64_t population)
+    {
+        const exact_fraction::U n = current_state_num_reps;
+        return exact_fraction(population, n + 1);
+    }
+};
+
+//
+//
+//
+//
+//
+//
+// adams
+//
+//
+// The Method of Smallest Divisors.
+// The divisor is n, which is why every state must already have one seat.
+class adams final
+{
+public:
+    static const char *name() { return "adams"; }
+
+    static bool from_zero() { return false; }
+
+    // The return value for this function must be positive.
+    static long double multiplier(uint32_t current_state_num_reps)
+    {
+        assert(current_state_num_reps > 0);
+        const long double m = 1.0L / current_state_num_reps;
+        assert(m > 0.0L);
+        return m;
+    }
+
+    // P / n.
+    static exact_fraction exact_priority(uint32_t current_state_num_reps, uint64_t population)
+    {
+        assert(current_state_num_reps > 0);
+        return exact_fraction(population, current_state_num_reps);
+    }
+};
+
+//
+//
+//
+//
+//
+//
+// dean
+//
+//
+// The Method of the Harmonic Mean.
+// The divisor is the harmonic mean of n and n + 1, which is n * (n + 1) / (n + 0.5).
+class dean final
+{
+public:
+    static const char *name() { return "dean"; }
+
+    static bool from_zero() { return false; }
+
+    // The return value for this function must be positive.
+    static long double multiplier(uint32_t current_state_num_reps)
+    {
+        const long double n = current_state_num_reps;
+        const long double m = (n + 0.5L) / (n * (n + 1.0L));
+        assert(m > 0.0L);
+        return m;
+    }
+
+    // P * (2 * n + 1) / (2 * n * (n + 1)).
+    static exact_fraction exact_priority(uint32_t current_state_num_reps, uint64_t population)
+    {
+        const exact_fraction::U n = current_state_num_reps;
+        return exact_fraction(static_cast<exact_fraction::U>(population) * (2 * n + 1), 2 * n * (n + 1));
+    }
+};
+
+#endif // SANDBOX_CPP_APPORTIONMENT_METHODS
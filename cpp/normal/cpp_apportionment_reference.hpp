@@ -0,0 +1,84 @@
+#ifndef SANDBOX_CPP_APPORTIONMENT_REFERENCE
+#define SANDBOX_CPP_APPORTIONMENT_REFERENCE
+
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <stdexcept>
+#include <cassert>
+
+//
+//
+//
+//
+//
+//
+// apportionment_reference
+//
+//
+// A deliberately plain version of the Method of Equal Proportions: every state is looked
+// up by name, and every priority value is recomputed for every seat. It is only used to
+// check and to benchmark the faster engines.
+class apportionment_reference final
+{
+public:
+    typedef uint32_t R;
+    typedef uint64_t P;
+    typedef std::string N;
+    typedef std::map<N, R> M;
+
+private:
+    // The return value for this function must be positive.
+    static long double multiplier(R current_state_num_reps)
+    {
+        long double m = current_state_num_reps;
+        m *= (m + 1.0L);
+        m = sqrtl(m);
+        m = 1.0L / m;
+        assert(m > 0.0L);
+        return m;
+    }
+
+public:
+    // May throw std::invalid_argument
+    static M num_reps_for_each_state(const std::map<N, P> &population_for_each_state, R total_num_reps)
+    {
+        if (population_for_each_state.empty() || total_num_reps < population_for_each_state.size())
+        {
+            std::string s(__PRETTY_FUNCTION__);
+            s += " -- total_num_reps must be at least the number of states, which must be positive";
+            throw std::invalid_argument(s);
+        }
+
+        M state_nums_reps;
+        for (auto &&pair : population_for_each_state)
+        {
+            state_nums_reps.insert(std::make_pair(pair.first, 1));
+        }
+
+        for (R num_reps_so_far = static_cast<R>(population_for_each_state.size()); num_reps_so_far < total_num_reps; num_reps_so_far++)
+        {
+            N name_of_state_with_next_rep;
+            long double max_priority_value_so_far = -1.0L;
+            bool first_state = true;
+
+            for (auto &&pair : population_for_each_state)
+            {
+                const long double pv = multiplier(state_nums_reps.at(pair.first)) * pair.second;
+                if (first_state || max_priority_value_so_far < pv)
+                {
+                    max_priority_value_so_far = pv;
+                    name_of_state_with_next_rep = pair.first;
+                }
+                first_state = false;
+            }
+
+            state_nums_reps.at(name_of_state_with_next_rep)++;
+        }
+
+        return state_nums_reps;
+    }
+};
+
+#endif // SANDBOX_CPP_APPORTIONMENT_REFERENCE
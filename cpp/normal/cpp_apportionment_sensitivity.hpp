@@ -0,0 +1,218 @@
+#ifndef SANDBOX_CPP_APPORTIONMENT_SENSITIVITY
+#define SANDBOX_CPP_APPORTIONMENT_SENSITIVITY
+
+#include "cpp_apportionment_divisor_search.hpp"
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <queue>
+#include <string>
+#include <stdexcept>
+#include <cassert>
+
+//
+//
+//
+//
+//
+//
+// apportionment_sensitivity
+//
+//
+// How close each state is to gaining or losing a seat, for one house size, without
+// apportioning again for every tweaked population.
+//
+// A divisor method gives the seats in order of priority value, and a state's priority
+// values depend only on its own population. So, with every other population held fixed, a
+// state gains a seat exactly when its next seat comes before the last seat given to any
+// other state, and loses one exactly when the first seat missed by any other state comes
+// before its own last seat. Both of those seats come from the two lowest seats given and
+// the two highest seats missed, and the population at which the order flips is found from
+// the priority values and confirmed with exact comparisons. The seats themselves come from
+// divisor_search_apportionment, so the whole analysis costs O(S log S).
+template <typename D>
+class apportionment_sensitivity final
+{
+private:
+    // https://en.cppreference.com/w/cpp/container/priority_queue
+    // https://crsreports.congress.gov/product/pdf/R/R45951
+
+public:
+    typedef typename divisor_search_apportionment<D>::R R;
+    typedef typename divisor_search_apportionment<D>::P P;
+    typedef typename divisor_search_apportionment<D>::I I;
+
+    // A state's next seat when it has `num_reps` seats. So the seat is that state's seat
+    // number `num_reps + 1`.
+    typedef typename divisor_search_apportionment<D>::candidate candidate;
+
+private:
+    typedef typename divisor_search_apportionment<D>::comes_later comes_later;
+    typedef typename divisor_search_apportionment<D>::comes_sooner comes_sooner;
+
+public:
+    class state_sensitivity final
+    {
+    public:
+        R num_reps = 0;
+
+        // The smallest increase in this state's population that would give it another
+        // seat, or 0 if no increase would.
+        P population_to_gain_rep = 0;
+
+        // The smallest decrease in this state's population that would cost it a seat, or 0
+        // if no decrease would (a state never has fewer than one seat, and a population must
+        // stay positive).
+        P population_to_lose_rep = 0;
+    };
+
+    class analysis final
+    {
+    public:
+        // Element `i` is about state `i`.
+        std::vector<state_sensitivity> sensitivity_for_each_state;
+
+        // The last seats given, starting with the very last one.
+        std::vector<candidate> last_seats_given;
+
+        // The first seats missed, starting with the very first one.
+        std::vector<candidate> first_seats_missed;
+    };
+
+private:
+    // The smallest population, at least `population`, with which a state with `num_reps`
+    // seats and index `index` would have its next seat come before `other`; or 0 if there
+    // is none.
+    static P smallest_population_before(R num_reps, P population, I index, const candidate &other)
+    {
+        const long double estimate = other.priority_value / divisor_apportionment_core<D>::multiplier(num_reps);
+        if (estimate >= static_cast<long double>(std::numeric_limits<P>::max()) / 2)
+        {
+            return 0;
+        }
+
+        P p = static_cast<P>(estimate);
+        p = (p < population) ? population : p;
+
+        // The estimate is off by no more than the rounding error of a priority value.
+        while (!candidate(num_reps, p, index).comes_before(other))
+        {
+            p++;
+        }
+        while (p > population && candidate(num_reps, p - 1, index).comes_before(other))
+        {
+            p--;
+        }
+        return p;
+    }
+
+    // The largest population, at most `population`, with which a state with `num_reps`
+    // seats and index `index` would have its next seat come after `other`; or 0 if there
+    // is none.
+    static P largest_population_after(R num_reps, P population, I index, const candidate &other)
+    {
+        const long double estimate = other.priority_value / divisor_apportionment_core<D>::multiplier(num_reps);
+
+        P p = (estimate < 1.0L) ? 1 : ((estimate >= population) ? population : static_cast<P>(estimate));
+
+        while (p >= 1 && !other.comes_before(candidate(num_reps, p, index)))
+        {
+            p--;
+        }
+        if (p == 0)
+        {
+            return 0;
+        }
+        while (p < population && other.comes_before(candidate(num_reps, p + 1, index)))
+        {
+            p++;
+        }
+        return p;
+    }
+
+public:
+    // May throw std::invalid_argument
+    // Analyze a house of `total_num_reps` seats, listing up to `num_seats_listed` of the
+    // last seats given and of the first seats missed.
+    static analysis analyze(const std::vector<P> &population_for_each_state, R total_num_reps, std::size_t num_seats_listed = 5)
+    {
+        const std::vector<R> state_nums_reps = divisor_search_apportionment<D>::num_reps_for_each_state(population_for_each_state, total_num_reps);
+        const std::size_t num_states = population_for_each_state.size();
+
+        // Each state's last seat given (if it has more than its first seat), and its first
+        // seat missed.
+        std::priority_queue<candidate, std::vector<candidate>, comes_sooner> last_seats;
+        std::priority_queue<candidate, std::vector<candidate>, comes_later> next_seats;
+        for (std::size_t i = 0; i < num_states; i++)
+        {
+            if (state_nums_reps[i] > 1)
+            {
+                last_seats.push(candidate(state_nums_reps[i] - 1, population_for_each_state[i], static_cast<I>(i)));
+            }
+            next_seats.push(candidate(state_nums_reps[i], population_for_each_state[i], static_cast<I>(i)));
+        }
+
+        analysis a;
+
+        // The two lowest seats given and the two highest seats missed are each a different
+        // state's, and are all that the populations at which seats flip depend on.
+        {
+            std::vector<candidate> lowest_given, highest_missed;
+            for (auto queue = last_seats; !queue.empty() && lowest_given.size() < 2; queue.pop())
+            {
+                lowest_given.push_back(queue.top());
+            }
+            for (auto queue = next_seats; !queue.empty() && highest_missed.size() < 2; queue.pop())
+            {
+                highest_missed.push_back(queue.top());
+            }
+
+            a.sensitivity_for_each_state.resize(num_states);
+            for (std::size_t i = 0; i < num_states; i++)
+            {
+                state_sensitivity &s = a.sensitivity_for_each_state[i];
+                const P population = population_for_each_state[i];
+                s.num_reps = state_nums_reps[i];
+
+                // The last seat given to any other state.
+                const std::size_t g = (!lowest_given.empty() && lowest_given[0].index == i) ? 1 : 0;
+                if (g < lowest_given.size())
+                {
+                    const P p = smallest_population_before(s.num_reps, population, static_cast<I>(i), lowest_given[g]);
+                    s.population_to_gain_rep = p ? (p - population) : 0;
+                }
+
+                // The first seat missed by any other state.
+                const std::size_t m = (!highest_missed.empty() && highest_missed[0].index == i) ? 1 : 0;
+                if (m < highest_missed.size() && s.num_reps > 1)
+                {
+                    const P p = largest_population_after(s.num_reps - 1, population, static_cast<I>(i), highest_missed[m]);
+                    s.population_to_lose_rep = p ? (population - p) : 0;
+                }
+            }
+        }
+
+        // Walk back from the last seat given, and forward from the first seat missed.
+        while (!last_seats.empty() && a.last_seats_given.size() < num_seats_listed)
+        {
+            const candidate c = last_seats.top();
+            last_seats.pop();
+            a.last_seats_given.push_back(c);
+            if (c.num_reps > 1)
+            {
+                last_seats.push(candidate(c.num_reps - 1, c.population, c.index));
+            }
+        }
+        while (!next_seats.empty() && a.first_seats_missed.size() < num_seats_listed)
+        {
+            const candidate c = next_seats.top();
+            next_seats.pop();
+            a.first_seats_missed.push_back(c);
+            next_seats.push(candidate(c.num_reps + 1, c.population, c.index));
+        }
+
+        return a;
+    }
+};
+
+#endif // SANDBOX_CPP_APPORTIONMENT_SENSITIVITY
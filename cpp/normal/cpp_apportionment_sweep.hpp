@@ -0,0 +1,313 @@
+#ifndef SANDBOX_CPP_APPORTIONMENT_SWEEP
+#define SANDBOX_CPP_APPORTIONMENT_SWEEP
+
+#include "cpp_apportionment_divisor_search.hpp"
+#include "cpp_join_guard.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <future>
+#include <iostream>
+#include <limits>
+#include <thread>
+#include <vector>
+#include <queue>
+#include <string>
+#include <stdexcept>
+#include <cassert>
+
+//
+//
+//
+//
+//
+//
+// apportionment_fairness_row
+//
+//
+// How evenly a house of a given size is apportioned (see test_this_class_part_4 in
+// cpp_apportionment.hpp).
+class apportionment_fairness_row final
+{
+public:
+    uint32_t total_num_reps = 0;
+    long double max_persons_per_rep = 0.0L;
+    long double min_persons_per_rep = 0.0L;
+    long double avg_persons_per_rep = 0.0L;
+
+public:
+    static std::ostream &write_tsv_header(std::ostream &os)
+    {
+        return os << "total_num_reps\tmax_persons_per_rep\tmin_persons_per_rep\tavg_persons_per_rep\n";
+    }
+
+    std::ostream &write_tsv(std::ostream &os) const
+    {
+        return os << total_num_reps << '\t' << max_persons_per_rep << '\t' << min_persons_per_rep << '\t' << avg_persons_per_rep << '\n';
+    }
+
+    // One fixed-size record: a uint32_t followed by three doubles, in host byte order.
+    std::ostream &write_binary(std::ostream &os) const
+    {
+        const double values[3] = {static_cast<double>(max_persons_per_rep), static_cast<double>(min_persons_per_rep), static_cast<double>(avg_persons_per_rep)};
+        char record[sizeof(total_num_reps) + sizeof(values)];
+        memcpy(record, &total_num_reps, sizeof(total_num_reps));
+        memcpy(record + sizeof(total_num_reps), values, sizeof(values));
+        return os.write(record, sizeof(record));
+    }
+};
+
+//
+//
+//
+//
+//
+//
+// apportionment_sweep
+//
+//
+// The fairness table of every house size in a range, in one pass. The seats of the
+// smallest size come from divisor_search_apportionment. After that, each seat changes
+// only the persons per seat of the state that wins it, so the next seat, the highest
+// persons per seat and the lowest persons per seat are each kept up to date with a heap
+// or a single comparison, instead of rescanning every state for every size.
+template <typename D>
+class apportionment_sweep final
+{
+private:
+    // https://en.cppreference.com/w/cpp/container/priority_queue
+    // https://en.cppreference.com/w/cpp/thread/thread
+    // https://en.cppreference.com/w/cpp/thread/hardware_concurrency
+    // https://en.cppreference.com/w/cpp/atomic/atomic
+    // https://en.cppreference.com/w/cpp/thread/promise
+    // https://en.cppreference.com/w/cpp/thread/future
+
+public:
+    typedef typename divisor_search_apportionment<D>::R R;
+    typedef typename divisor_search_apportionment<D>::P P;
+    typedef typename divisor_search_apportionment<D>::I I;
+
+private:
+    typedef typename divisor_search_apportionment<D>::candidate candidate;
+    typedef typename divisor_search_apportionment<D>::comes_later comes_later;
+
+    // A state's persons per seat, given that it has `num_reps` seats. An entry whose
+    // `num_reps` is out of date is skipped when it reaches the top of the heap.
+    class ratio_entry final
+    {
+    public:
+        long double persons_per_rep = 0.0L;
+        I index = 0;
+        R num_reps = 0;
+
+    public:
+        ratio_entry(long double the_persons_per_rep, I the_index, R the_num_reps) : persons_per_rep(the_persons_per_rep), index(the_index), num_reps(the_num_reps) {}
+
+    public:
+        bool operator<(const ratio_entry &other) const { return persons_per_rep < other.persons_per_rep; }
+    };
+
+    static long double persons_per_rep(P population, R num_reps)
+    {
+        return static_cast<long double>(population) / static_cast<long double>(num_reps);
+    }
+
+public:
+    // May throw std::invalid_argument
+    // Call `on_row(const apportionment_fairness_row &)` once for each house size from
+    // `min_total_num_reps` to `max_total_num_reps`, in increasing order.
+    template <typename F>
+    static void sweep(const std::vector<P> &population_for_each_state, R min_total_num_reps, R max_total_num_reps, F on_row)
+    {
+        if (min_total_num_reps > max_total_num_reps)
+        {
+            std::string s(__PRETTY_FUNCTION__);
+            s += " -- min_total_num_reps must not be greater than max_total_num_reps";
+            throw std::invalid_argument(s);
+        }
+
+        std::vector<R> state_nums_reps = divisor_search_apportionment<D>::num_reps_for_each_state(population_for_each_state, min_total_num_reps);
+
+        const std::size_t num_states = population_for_each_state.size();
+
+        long double total_population = 0.0L;
+        for (auto &&population : population_for_each_state)
+        {
+            total_population += population;
+        }
+
+        std::priority_queue<candidate, std::vector<candidate>, comes_later> next_seats;
+        std::priority_queue<ratio_entry> max_ratios;
+        long double min_ratio = std::numeric_limits<long double>::infinity();
+
+        for (std::size_t i = 0; i < num_states; i++)
+        {
+            const P population = population_for_each_state[i];
+            const R num_reps = state_nums_reps[i];
+            const long double ratio = persons_per_rep(population, num_reps);
+
+            next_seats.push(candidate(num_reps, population, static_cast<I>(i)));
+            max_ratios.push(ratio_entry(ratio, static_cast<I>(i), num_reps));
+            if (min_ratio > ratio)
+            {
+                min_ratio = ratio;
+            }
+        }
+
+        for (R total_num_reps = min_total_num_reps;; total_num_reps++)
+        {
+            while (max_ratios.top().num_reps != state_nums_reps[max_ratios.top().index])
+            {
+                max_ratios.pop();
+            }
+
+            apportionment_fairness_row row;
+            row.total_num_reps = total_num_reps;
+            row.max_persons_per_rep = max_ratios.top().persons_per_rep;
+            row.min_persons_per_rep = min_ratio;
+            row.avg_persons_per_rep = total_population / static_cast<long double>(total_num_reps);
+            on_row(row);
+
+            if (total_num_reps == max_total_num_reps)
+            {
+                break;
+            }
+
+            // Give the next seat. Only the winner's persons per seat changes, and it can
+            // only go down.
+            const I i = next_seats.top().index;
+            next_seats.pop();
+
+            const P population = population_for_each_state[i];
+            const R num_reps = ++state_nums_reps[i];
+            const long double ratio = persons_per_rep(population, num_reps);
+
+            next_seats.push(candidate(num_reps, population, i));
+            max_ratios.push(ratio_entry(ratio, i, num_reps));
+            if (min_ratio > ratio)
+            {
+                min_ratio = ratio;
+            }
+        }
+    }
+
+    // May throw std::invalid_argument
+    static std::vector<apportionment_fairness_row> sweep(const std::vector<P> &population_for_each_state, R min_total_num_reps, R max_total_num_reps)
+    {
+        std::vector<apportionment_fairness_row> rows;
+        sweep(population_for_each_state, min_total_num_reps, max_total_num_reps, [&](const apportionment_fairness_row &row)
+              { rows.push_back(row); });
+        return rows;
+    }
+
+public:
+    // May throw std::invalid_argument
+    // Sweep each scenario (each element of `scenarios` is a population for each state) on
+    // `num_threads` threads. `on_table(std::size_t scenario_index, const std::vector<apportionment_fairness_row> &)`
+    // is called on the calling thread once per scenario, in scenario order, as soon as that
+    // scenario and every scenario before it are done. So the output does not depend on the
+    // number of threads.
+    template <typename F>
+    static void sweep_scenarios(const std::vector<std::vector<P>> &scenarios, R min_total_num_reps, R max_total_num_reps, unsigned num_threads, F on_table)
+    {
+        if (num_threads == 0)
+        {
+            num_threads = std::thread::hardware_concurrency();
+            if (num_threads == 0)
+            {
+                num_threads = 1;
+            }
+        }
+
+        const std::size_t num_scenarios = scenarios.size();
+
+        std::vector<std::promise<std::vector<apportionment_fairness_row>>> promises(num_scenarios);
+        std::vector<std::future<std::vector<apportionment_fairness_row>>> futures;
+        futures.reserve(num_scenarios);
+        for (auto &&promise : promises)
+        {
+            futures.push_back(promise.get_future());
+        }
+
+        std::atomic<std::size_t> next_scenario_index(0);
+
+        std::vector<std::thread> threads;
+        cpp_join_guard join_guard(threads);
+        for (unsigned t = 0; t < num_threads; t++)
+        {
+            threads.emplace_back([&]()
+                                 {
+                for (std::size_t k = next_scenario_index++; k < num_scenarios; k = next_scenario_index++)
+                {
+                    try
+                    {
+                        promises[k].set_value(sweep(scenarios[k], min_total_num_reps, max_total_num_reps));
+                    }
+                    catch (...)
+                    {
+                        promises[k].set_exception(std::current_exception());
+                    }
+                } });
+        }
+
+        // Rethrow the first exception only after every thread has been joined.
+        std::exception_ptr first_exception;
+        for (std::size_t k = 0; k < num_scenarios; k++)
+        {
+            try
+            {
+                const std::vector<apportionment_fairness_row> rows = futures[k].get();
+                if (!first_exception)
+                {
+                    on_table(k, rows);
+                }
+            }
+            catch (...)
+            {
+                if (!first_exception)
+                {
+                    first_exception = std::current_exception();
+                }
+            }
+        }
+
+        join_guard.join();
+
+        if (first_exception)
+        {
+            std::rethrow_exception(first_exception);
+        }
+    }
+
+    // May throw std::invalid_argument
+    // Stream every scenario's table as TSV, with the scenario index in the first column.
+    static void write_scenarios_tsv(std::ostream &os, const std::vector<std::vector<P>> &scenarios, R min_total_num_reps, R max_total_num_reps, unsigned num_threads)
+    {
+        os << "scenario\t";
+        apportionment_fairness_row::write_tsv_header(os);
+        sweep_scenarios(scenarios, min_total_num_reps, max_total_num_reps, num_threads, [&](std::size_t k, const std::vector<apportionment_fairness_row> &rows)
+                        {
+            for (auto &&row : rows)
+            {
+                row.write_tsv(os << k << '\t');
+            } });
+    }
+
+    // May throw std::invalid_argument
+    // Stream every scenario's table as fixed-size binary records, each preceded by the
+    // scenario index as a uint64_t in host byte order.
+    static void write_scenarios_binary(std::ostream &os, const std::vector<std::vector<P>> &scenarios, R min_total_num_reps, R max_total_num_reps, unsigned num_threads)
+    {
+        sweep_scenarios(scenarios, min_total_num_reps, max_total_num_reps, num_threads, [&](std::size_t k, const std::vector<apportionment_fairness_row> &rows)
+                        {
+            const uint64_t scenario_index = k;
+            for (auto &&row : rows)
+            {
+                os.write(reinterpret_cast<const char *>(&scenario_index), sizeof(scenario_index));
+                row.write_binary(os);
+            } });
+    }
+};
+
+#endif // SANDBOX_CPP_APPORTIONMENT_SWEEP
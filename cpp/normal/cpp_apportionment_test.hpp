@@ -2,9 +2,733 @@
 #define SANDBOX_CPP_APPORTIONMENT_TEST
 
 #include "cpp_apportionment.hpp"
+#include "cpp_apportionment_core.hpp"
+#include "cpp_apportionment_reference.hpp"
+#include "cpp_apportionment_hamilton.hpp"
+#include "cpp_apportionment_divisor_search.hpp"
+#include "cpp_apportionment_sweep.hpp"
+#include "cpp_apportionment_batch.hpp"
+#include "cpp_apportionment_sensitivity.hpp"
+#include "cpp_apportionment_loader.hpp"
+#include "cpp_apportionment_hierarchy.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <random>
 
 class cpp_apportionment_test
 {
+private:
+    // Table A-5 in https://crsreports.congress.gov/product/pdf/R/R45951, plus a tie
+    // between "E" and "F" that the lower index must win.
+    static std::map<apportionment::N, apportionment::P> small_populations()
+    {
+        return {{"A", 2560}, {"B", 3315}, {"C", 995}, {"D", 5012}, {"E", 1234}, {"F", 1234}};
+    }
+
+    static void test_apportionment_core()
+    {
+        const auto populations = small_populations();
+
+        std::vector<apportionment_core::P> dense_populations;
+        for (auto &&pair : populations)
+        {
+            dense_populations.push_back(pair.second);
+        }
+
+        apportionment_core core(dense_populations);
+
+        for (apportionment::R total_num_reps = 60; total_num_reps >= populations.size(); total_num_reps--)
+        {
+            const auto m = apportionment_reference::num_reps_for_each_state(populations, total_num_reps);
+            const auto v = core.num_reps_for_each_state(total_num_reps);
+
+            std::size_t i = 0;
+            for (auto &&pair : m)
+            {
+                assert(v.at(i) == pair.second);
+                i++;
+            }
+        }
+
+        assert(core.get_seat_sequence().size() == 60 - populations.size());
+
+        bool threw = false;
+        try
+        {
+            apportionment_core empty_core(std::vector<apportionment_core::P>{});
+        }
+        catch (const std::invalid_argument &)
+        {
+            threw = true;
+        }
+        assert(threw);
+    }
+
+    template <typename D>
+    static void assert_divisor_method_result(const std::vector<apportionment_core::P> &populations, apportionment_core::R total_num_reps, const std::vector<apportionment_core::R> &expected)
+    {
+        divisor_apportionment_core<D> core(populations);
+        const auto v = core.num_reps_for_each_state(total_num_reps);
+        std::cout << D::name() << ':';
+        for (auto &&num_reps : v)
+        {
+            std::cout << ' ' << num_reps;
+        }
+        std::cout << '\n';
+        assert(v == expected);
+    }
+
+    // The generated table must hold exactly what `D::multiplier()` computes, and the seat
+    // counts past its end must fall back to computing it.
+    template <typename D>
+    static void assert_multiplier_table_matches()
+    {
+        typedef cpp_gen_multiplier_table<D> T;
+        assert(T::MAX_NUM_REPS >= 70);
+        for (apportionment_core::R n = 1; n <= T::MAX_NUM_REPS + 10; n++)
+        {
+            assert(divisor_apportionment_core<D>::multiplier(n) == static_cast<double>(D::multiplier(n)));
+        }
+        assert(T::VALUES[T::MAX_NUM_REPS] == static_cast<double>(D::multiplier(T::MAX_NUM_REPS)));
+    }
+
+    static void test_apportionment_methods()
+    {
+        assert_multiplier_table_matches<huntington_hill>();
+        assert_multiplier_table_matches<webster>();
+        assert_multiplier_table_matches<jefferson>();
+        assert_multiplier_table_matches<adams>();
+        assert_multiplier_table_matches<dean>();
+
+        // Table A-5 in https://crsreports.congress.gov/product/pdf/R/R45951
+        // The quotas are 4.309, 5.580, 1.675 and 8.436.
+        const std::vector<apportionment_core::P> populations{2560, 3315, 995, 5012};
+
+        assert_divisor_method_result<huntington_hill>(populations, 20, {4, 6, 2, 8});
+        assert_divisor_method_result<webster>(populations, 20, {4, 6, 2, 8});
+        assert_divisor_method_result<jefferson>(populations, 20, {4, 6, 1, 9});
+        assert_divisor_method_result<adams>(populations, 20, {4, 6, 2, 8});
+        assert_divisor_method_result<dean>(populations, 20, {4, 6, 2, 8});
+
+        assert(hamilton_apportionment::num_reps_for_each_state(populations, 20) == std::vector<apportionment_core::R>({4, 6, 2, 8}));
+
+        // The quota of the last state is below one, so it is set aside with one seat, and
+        // the other three states split the remaining nine seats.
+        assert(hamilton_apportionment::num_reps_for_each_state({1000, 1000, 1000, 1}, 10) == std::vector<apportionment_core::R>({3, 3, 3, 1}));
+
+        // An exact tie in the remainders goes to the lower index.
+        assert(hamilton_apportionment::num_reps_for_each_state({1, 1, 1}, 4) == std::vector<apportionment_core::R>({2, 1, 1}));
+    }
+
+    // https://en.cppreference.com/w/cpp/numeric/random/mersenne_twister_engine
+    // https://en.cppreference.com/w/cpp/numeric/random/uniform_int_distribution
+    // Some of the populations repeat, so that there are exact ties.
+    static std::vector<apportionment_core::P> random_populations(std::mt19937 &generator, std::size_t num_states, apportionment_core::P max_population)
+    {
+        std::uniform_int_distribution<apportionment_core::P> distribution(1, max_population);
+        std::vector<apportionment_core::P> populations;
+        for (std::size_t i = 0; i < num_states; i++)
+        {
+            if (i > 0 && i % 7 == 0)
+            {
+                populations.push_back(populations[i / 2]);
+            }
+            else
+            {
+                populations.push_back(distribution(generator));
+            }
+        }
+        return populations;
+    }
+
+    template <typename D>
+    static void assert_divisor_search_matches_core(const std::vector<apportionment_core::P> &populations, apportionment_core::R max_total_num_reps)
+    {
+        divisor_apportionment_core<D> core(populations);
+        for (apportionment_core::R total_num_reps = static_cast<apportionment_core::R>(populations.size()); total_num_reps <= max_total_num_reps; total_num_reps++)
+        {
+            assert(divisor_search_apportionment<D>::num_reps_for_each_state(populations, total_num_reps) == core.num_reps_for_each_state(total_num_reps));
+        }
+    }
+
+    // Seat by seat from no seats, with ties to the lowest index, comparing exactly.
+    template <typename D>
+    static std::vector<apportionment_core::R> seat_by_seat_from_zero(const std::vector<apportionment_core::P> &populations, apportionment_core::R total_num_reps)
+    {
+        std::vector<apportionment_core::R> v(populations.size(), 0);
+        for (apportionment_core::R k = 0; k < total_num_reps; k++)
+        {
+            std::size_t best = 0;
+            for (std::size_t i = 1; i < populations.size(); i++)
+            {
+                if (exact_fraction::compare(D::exact_priority(v[i], populations[i]), D::exact_priority(v[best], populations[best])) > 0)
+                {
+                    best = i;
+                }
+            }
+            v[best]++;
+        }
+        return v;
+    }
+
+    template <typename D>
+    static void assert_divisor_search_from_zero_matches_seat_by_seat(const std::vector<apportionment_core::P> &populations, apportionment_core::R max_total_num_reps)
+    {
+        for (apportionment_core::R total_num_reps = 0; total_num_reps <= max_total_num_reps; total_num_reps++)
+        {
+            assert(divisor_search_apportionment<D>::num_reps_for_each_state_from_zero(populations, total_num_reps) == seat_by_seat_from_zero<D>(populations, total_num_reps));
+        }
+    }
+
+    static void test_divisor_search_from_zero()
+    {
+        std::mt19937 generator(20250205);
+
+        assert(divisor_search_apportionment<jefferson>::num_reps_for_each_state_from_zero({1000, 1000, 1000, 1}, 10) == std::vector<apportionment_core::R>({4, 3, 3, 0}));
+        assert(divisor_search_apportionment<webster>::num_reps_for_each_state_from_zero({1, 1, 1}, 2) == std::vector<apportionment_core::R>({1, 1, 0}));
+        assert(divisor_search_apportionment<webster>::num_reps_for_each_state_from_zero({1, 1, 1}, 0) == std::vector<apportionment_core::R>({0, 0, 0}));
+
+        for (std::size_t num_states : {1, 4, 30, 200})
+        {
+            for (apportionment_core::P max_population : {10, 1000000})
+            {
+                const auto populations = random_populations(generator, num_states, max_population);
+                assert_divisor_search_from_zero_matches_seat_by_seat<webster>(populations, 100);
+                assert_divisor_search_from_zero_matches_seat_by_seat<jefferson>(populations, 100);
+            }
+        }
+
+        // The methods whose first divisor is zero give every state a seat first.
+        bool threw = false;
+        try
+        {
+            divisor_search_apportionment<huntington_hill>::num_reps_for_each_state_from_zero({1, 1, 1}, 2);
+        }
+        catch (const std::invalid_argument &)
+        {
+            threw = true;
+        }
+        assert(threw);
+    }
+
+    static void test_divisor_search()
+    {
+        std::mt19937 generator(20250127);
+
+        for (std::size_t num_states : {1, 4, 30})
+        {
+            for (apportionment_core::P max_population : {10, 1000000})
+            {
+                const auto populations = random_populations(generator, num_states, max_population);
+                assert_divisor_search_matches_core<huntington_hill>(populations, 400);
+                assert_divisor_search_matches_core<webster>(populations, 400);
+                assert_divisor_search_matches_core<jefferson>(populations, 400);
+                assert_divisor_search_matches_core<adams>(populations, 400);
+                assert_divisor_search_matches_core<dean>(populations, 400);
+            }
+        }
+
+        // A house far larger than a seat-by-seat apportionment could reach quickly.
+        const auto populations = random_populations(generator, 3000, 40000000);
+        const auto v = divisor_search_apportionment<huntington_hill>::num_reps_for_each_state(populations, 10000000);
+        apportionment_core::R total_num_reps = 0;
+        for (auto &&num_reps : v)
+        {
+            total_num_reps += num_reps;
+        }
+        assert(total_num_reps == 10000000);
+    }
+
+    static void test_sweep()
+    {
+        std::mt19937 generator(20250128);
+
+        std::vector<std::vector<apportionment_core::P>> scenarios;
+        for (int k = 0; k < 5; k++)
+        {
+            scenarios.push_back(random_populations(generator, 20, 1000000));
+        }
+
+        // Each row must match the seat counts of a seat-by-seat apportionment.
+        for (auto &&populations : scenarios)
+        {
+            webster_core_matches_sweep(populations, 20, 300);
+        }
+
+        // The output must not depend on the number of threads.
+        std::ostringstream tsv_1, tsv_3, binary_1, binary_3;
+        apportionment_sweep<webster>::write_scenarios_tsv(tsv_1, scenarios, 100, 300, 1);
+        apportionment_sweep<webster>::write_scenarios_tsv(tsv_3, scenarios, 100, 300, 3);
+        apportionment_sweep<webster>::write_scenarios_binary(binary_1, scenarios, 100, 300, 1);
+        apportionment_sweep<webster>::write_scenarios_binary(binary_3, scenarios, 100, 300, 3);
+        assert(tsv_1.str() == tsv_3.str());
+        assert(binary_1.str() == binary_3.str());
+        assert(binary_1.str().size() == scenarios.size() * 201 * (sizeof(uint64_t) + sizeof(uint32_t) + 3 * sizeof(double)));
+
+        // An invalid scenario is reported after every thread has finished.
+        scenarios.push_back({});
+        bool threw = false;
+        try
+        {
+            apportionment_sweep<webster>::write_scenarios_tsv(tsv_1, scenarios, 100, 300, 2);
+        }
+        catch (const std::invalid_argument &)
+        {
+            threw = true;
+        }
+        assert(threw);
+    }
+
+    static void webster_core_matches_sweep(const std::vector<apportionment_core::P> &populations, apportionment_core::R min_total_num_reps, apportionment_core::R max_total_num_reps)
+    {
+        divisor_apportionment_core<webster> core(populations);
+        apportionment_core::R expected_total_num_reps = min_total_num_reps;
+
+        apportionment_sweep<webster>::sweep(populations, min_total_num_reps, max_total_num_reps, [&](const apportionment_fairness_row &row)
+                                            {
+            assert(row.total_num_reps == expected_total_num_reps);
+            expected_total_num_reps++;
+
+            const auto v = core.num_reps_for_each_state(row.total_num_reps);
+            long double max = 0.0L;
+            long double min = std::numeric_limits<long double>::infinity();
+            for (std::size_t i = 0; i < populations.size(); i++)
+            {
+                const long double ratio = static_cast<long double>(populations[i]) / static_cast<long double>(v[i]);
+                max = (max < ratio) ? ratio : max;
+                min = (min > ratio) ? ratio : min;
+            }
+            assert(row.max_persons_per_rep == max);
+            assert(row.min_persons_per_rep == min); });
+
+        assert(expected_total_num_reps == max_total_num_reps + 1);
+    }
+
+    static void test_batch()
+    {
+        std::mt19937 generator(20250131);
+
+        // 21 scenarios, so the last block is only partly full.
+        const std::size_t num_states = 30;
+        const std::size_t num_scenarios = 21;
+        std::vector<apportionment_core::P> population_matrix;
+        for (std::size_t k = 0; k < num_scenarios; k++)
+        {
+            const auto populations = random_populations(generator, num_states, 5000000);
+            population_matrix.insert(population_matrix.end(), populations.begin(), populations.end());
+        }
+
+        batch_apportionment<huntington_hill> batch(num_states, population_matrix);
+        assert(batch.get_num_scenarios() == num_scenarios);
+
+        // Each scenario must match a seat-by-seat apportionment, whatever the number of threads.
+        const auto v1 = batch.num_reps_for_each_scenario_and_state(435, 1);
+        const auto v3 = batch.num_reps_for_each_scenario_and_state(435, 3);
+        assert(v1 == v3);
+        for (std::size_t k = 0; k < num_scenarios; k++)
+        {
+            const std::vector<apportionment_core::P> populations(population_matrix.begin() + k * num_states, population_matrix.begin() + (k + 1) * num_states);
+            const auto v = apportionment_core(populations).num_reps_for_each_state(435);
+            assert(std::equal(v.begin(), v.end(), v1.begin() + k * num_states));
+        }
+
+        // Each state's distribution counts every scenario once.
+        const auto distributions = batch.seat_distribution_for_each_state(435, 2);
+        assert(distributions.size() == num_states);
+        for (std::size_t i = 0; i < num_states; i++)
+        {
+            uint64_t num_scenarios_counted = 0;
+            for (std::size_t n = 0; n < distributions[i].size(); n++)
+            {
+                num_scenarios_counted += distributions[i][n];
+            }
+            assert(num_scenarios_counted == num_scenarios);
+            assert(distributions[i][v1[i]] > 0);
+        }
+
+        bool threw = false;
+        try
+        {
+            batch_apportionment<huntington_hill>(num_states, std::vector<apportionment_core::P>(num_states + 1, 1));
+        }
+        catch (const std::invalid_argument &)
+        {
+            threw = true;
+        }
+        assert(threw);
+    }
+
+    // Populations full of exact ties and near-ties between seats: multiples of a few base
+    // populations by factors that make seats tie under most methods (for example, the
+    // second seat of P and the ninth seat of 6 * P tie under huntington_hill), each
+    // sometimes nudged by one person.
+    static std::vector<apportionment_core::P> tie_prone_populations(std::mt19937 &generator, std::size_t num_states)
+    {
+        const apportionment_core::P factors[] = {1, 2, 3, 5, 6, 35};
+        std::uniform_int_distribution<apportionment_core::P> base_distribution(1, 100000);
+        std::uniform_int_distribution<std::size_t> factor_distribution(0, sizeof(factors) / sizeof(factors[0]) - 1);
+        std::uniform_int_distribution<int> nudge_distribution(-1, 3);
+
+        const apportionment_core::P bases[] = {base_distribution(generator), base_distribution(generator)};
+
+        std::vector<apportionment_core::P> populations;
+        for (std::size_t i = 0; i < num_states; i++)
+        {
+            const int nudge = nudge_distribution(generator);
+            const apportionment_core::P population = bases[i % 2] * factors[factor_distribution(generator)];
+            populations.push_back((nudge == 1) ? population + 1 : ((nudge == -1) ? population - 1 + (population == 1) : population));
+        }
+        return populations;
+    }
+
+    // Seat by seat, comparing nothing but exact fractions.
+    template <typename D>
+    static std::vector<apportionment_core::R> exact_num_reps_for_each_state(const std::vector<apportionment_core::P> &populations, apportionment_core::R total_num_reps)
+    {
+        std::vector<apportionment_core::R> state_nums_reps(populations.size(), 1);
+        for (std::size_t num_reps_so_far = populations.size(); num_reps_so_far < total_num_reps; num_reps_so_far++)
+        {
+            std::size_t index_so_far = 0;
+            for (std::size_t i = 1; i < populations.size(); i++)
+            {
+                if (exact_fraction::compare(D::exact_priority(state_nums_reps[i], populations[i]), D::exact_priority(state_nums_reps[index_so_far], populations[index_so_far])) > 0)
+                {
+                    index_so_far = i;
+                }
+            }
+            state_nums_reps[index_so_far]++;
+        }
+        return state_nums_reps;
+    }
+
+    template <typename D>
+    static void assert_engines_match_exact_reference(const std::vector<apportionment_core::P> &populations, apportionment_core::R max_total_num_reps)
+    {
+        divisor_apportionment_core<D> core(populations);
+        std::vector<apportionment_core::P> population_matrix;
+        for (apportionment_core::R total_num_reps = static_cast<apportionment_core::R>(populations.size()); total_num_reps <= max_total_num_reps; total_num_reps++)
+        {
+            const auto expected = exact_num_reps_for_each_state<D>(populations, total_num_reps);
+            assert(core.num_reps_for_each_state(total_num_reps) == expected);
+            assert(divisor_search_apportionment<D>::num_reps_for_each_state(populations, total_num_reps) == expected);
+        }
+
+        population_matrix.insert(population_matrix.end(), populations.begin(), populations.end());
+        assert(batch_apportionment<D>(populations.size(), population_matrix).num_reps_for_each_scenario_and_state(max_total_num_reps, 1) == exact_num_reps_for_each_state<D>(populations, max_total_num_reps));
+    }
+
+    static void test_exact_priority_comparison()
+    {
+        // Fractions whose cross products do not fit in 128 bits.
+        const exact_fraction::U big = ~static_cast<exact_fraction::U>(0);
+        assert(exact_fraction::compare(exact_fraction(big, big - 1), exact_fraction(big - 1, big - 2)) < 0);
+        assert(exact_fraction::compare(exact_fraction(big - 1, big - 2), exact_fraction(big, big - 1)) > 0);
+        assert(exact_fraction::compare(exact_fraction(big - 1, big - 1), exact_fraction(3, 3)) == 0);
+        assert(exact_fraction::compare(exact_fraction(6, 4), exact_fraction(big / 3 * 3, big / 3 * 2)) == 0);
+        assert(exact_fraction::compare(exact_fraction(0, 5), exact_fraction(1, big)) < 0);
+
+        // The 2nd seat of P and the 9th seat of 6 * P tie exactly under huntington_hill:
+        // P / sqrt(2) == 6 * P / sqrt(72). The tie must go to the lower index either way.
+        for (apportionment_core::P p : {1234567, 40000001, 987654321})
+        {
+            assert(exact_fraction::compare(huntington_hill::exact_priority(1, p), huntington_hill::exact_priority(8, 6 * p)) == 0);
+            assert(apportionment_core({6 * p, p}).num_reps_for_each_state(10) == std::vector<apportionment_core::R>({9, 1}));
+            assert(apportionment_core({p, 6 * p}).num_reps_for_each_state(10) == std::vector<apportionment_core::R>({2, 8}));
+        }
+
+        std::mt19937 generator(20250201);
+        for (int k = 0; k < 30; k++)
+        {
+            const auto populations = tie_prone_populations(generator, 12);
+            assert_engines_match_exact_reference<huntington_hill>(populations, 200);
+            assert_engines_match_exact_reference<webster>(populations, 200);
+            assert_engines_match_exact_reference<jefferson>(populations, 200);
+            assert_engines_match_exact_reference<adams>(populations, 200);
+            assert_engines_match_exact_reference<dean>(populations, 200);
+        }
+    }
+
+    // The smallest change in the population of state `i` that changes its number of seats
+    // by `direction`, found by apportioning again and again; or 0 if none does.
+    template <typename D>
+    static apportionment_core::P population_change_by_search(std::vector<apportionment_core::P> populations, apportionment_core::R total_num_reps, std::size_t i, int direction)
+    {
+        const apportionment_core::P population = populations[i];
+        const apportionment_core::R num_reps = divisor_search_apportionment<D>::num_reps_for_each_state(populations, total_num_reps)[i];
+
+        // A state's seats never go down as its population goes up, so bisect.
+        auto flips = [&](apportionment_core::P change)
+        {
+            populations[i] = (direction > 0) ? population + change : population - change;
+            const apportionment_core::R n = divisor_search_apportionment<D>::num_reps_for_each_state(populations, total_num_reps)[i];
+            return (direction > 0) ? (n > num_reps) : (n < num_reps);
+        };
+
+        apportionment_core::P high = (direction > 0) ? population * 1000 : population - 1;
+        if (high == 0 || !flips(high))
+        {
+            return 0;
+        }
+        apportionment_core::P low = 0;
+        while (high - low > 1)
+        {
+            const apportionment_core::P middle = low + (high - low) / 2;
+            (flips(middle) ? high : low) = middle;
+        }
+        return high;
+    }
+
+    template <typename D>
+    static void assert_sensitivity_matches_search(const std::vector<apportionment_core::P> &populations, apportionment_core::R total_num_reps)
+    {
+        const auto a = apportionment_sensitivity<D>::analyze(populations, total_num_reps, 4);
+
+        for (std::size_t i = 0; i < populations.size(); i++)
+        {
+            const auto &s = a.sensitivity_for_each_state[i];
+            assert(s.population_to_gain_rep == population_change_by_search<D>(populations, total_num_reps, i, 1));
+            assert(s.population_to_lose_rep == population_change_by_search<D>(populations, total_num_reps, i, -1));
+        }
+
+        // The listed seats must be the ones around position `total_num_reps` in the seat sequence.
+        divisor_apportionment_core<D> core(populations);
+        core.extend_seat_sequence(static_cast<apportionment_core::R>(total_num_reps + a.first_seats_missed.size()));
+        const auto &sequence = core.get_seat_sequence();
+        const std::size_t num_given = total_num_reps - populations.size();
+
+        assert(a.last_seats_given.size() == std::min<std::size_t>(4, num_given));
+        for (std::size_t k = 0; k < a.last_seats_given.size(); k++)
+        {
+            assert(a.last_seats_given[k].index == sequence[num_given - 1 - k]);
+        }
+        assert(a.first_seats_missed.size() == 4);
+        for (std::size_t k = 0; k < a.first_seats_missed.size(); k++)
+        {
+            assert(a.first_seats_missed[k].index == sequence[num_given + k]);
+        }
+    }
+
+    static void test_sensitivity()
+    {
+        std::mt19937 generator(20250202);
+        for (int k = 0; k < 10; k++)
+        {
+            const auto populations = random_populations(generator, 15, 2000000);
+            assert_sensitivity_matches_search<huntington_hill>(populations, 60);
+            assert_sensitivity_matches_search<webster>(populations, 15);
+            assert_sensitivity_matches_search<jefferson>(populations, 100);
+            assert_sensitivity_matches_search<adams>(populations, 40);
+            assert_sensitivity_matches_search<dean>(populations, 60);
+
+            const auto tie_prone = tie_prone_populations(generator, 15);
+            assert_sensitivity_matches_search<huntington_hill>(tie_prone, 80);
+            assert_sensitivity_matches_search<webster>(tie_prone, 80);
+        }
+    }
+
+    // Write `contents` to a new temporary file and return its path.
+    static std::string temporary_file_with(const std::string &contents)
+    {
+        char path[] = "/tmp/cpp_apportionment_test_XXXXXX";
+        const int fd = mkstemp(path);
+        assert(fd != -1);
+        const ssize_t w = write(fd, contents.data(), contents.size());
+        assert(w == static_cast<ssize_t>(contents.size()));
+        close(fd);
+        return path;
+    }
+
+    static bool parse_throws(const std::string &text, const population_table::format &f)
+    {
+        try
+        {
+            population_table::parsed(text, f);
+        }
+        catch (const std::invalid_argument &)
+        {
+            return true;
+        }
+        return false;
+    }
+
+    static void test_loader()
+    {
+        // CSV with a header, quoted fields, CRLF line ends and a blank line.
+        {
+            const std::string path = temporary_file_with("State,Population\r\n"
+                                                         "\"Washington, D.C.\",\"689,545\"\r\n"
+                                                         "Vermont,643077\r\n"
+                                                         "\r\n"
+                                                         "Wyoming,576851");
+            mapped_file file(path);
+            const population_table t = population_table::parsed(file.contents(), population_table::format());
+            unlink(path.c_str());
+
+            assert(t.get_num_states() == 3);
+            assert(t.name_for_each_state[0] == "Washington, D.C.");
+            assert(t.name_for_each_state[1] == "Vermont");
+            assert(t.name_for_each_state[2] == "Wyoming");
+            assert(t.population_for_each_state == std::vector<population_table::P>({689545, 643077, 576851}));
+
+            // The names point into the mapping instead of being copies.
+            const std::string_view contents = file.contents();
+            assert(t.name_for_each_state[1].data() >= contents.data() && t.name_for_each_state[1].data() < contents.data() + contents.size());
+        }
+
+        // TSV without a header, taking the population from the third column.
+        {
+            population_table::format f;
+            f.delimiter = '\t';
+            f.has_header = false;
+            f.name_column = 1;
+            f.population_column = 2;
+            const population_table t = population_table::parsed("06\tCalifornia\t39538223\textra\n48\tTexas\t29145505\n", f);
+            assert(t.get_num_states() == 2);
+            assert(t.name_for_each_state[0] == "California" && t.population_for_each_state[0] == 39538223);
+            assert(t.name_for_each_state[1] == "Texas" && t.population_for_each_state[1] == 29145505);
+        }
+
+        population_table::format f;
+        assert(parse_throws("State,Population\nA,12x\n", f));
+        assert(parse_throws("State,Population\nA,0\n", f));
+        assert(parse_throws("State,Population\nA\n", f));
+        assert(parse_throws("State,Population\n\"A,1\n", f));
+        assert(parse_throws("State,Population\n\"A\"\"B\",1\n", f));
+        assert(parse_throws("State,Population\nA,99999999999999999999\n", f));
+        assert(population_table::parsed("State,Population\n", f).get_num_states() == 0);
+
+        // Commas only as thousands separators, and not at all in TSV.
+        assert(population_table::parsed("State,Population\nA,\"1,234\"\nB,\"12,345,678\"\n", f).population_for_each_state == std::vector<population_table::P>({1234, 12345678}));
+        for (const char *population : {"\"1,,\"", "\"1,\"", "\",123\"", "\"1,,234\"", "\"1,23\"", "\"1234,567\"", "\"1,234,56\"", "\"1,2345\""})
+        {
+            assert(parse_throws(std::string("State,Population\nA,") + population + "\n", f));
+        }
+        population_table::format tab;
+        tab.delimiter = '\t';
+        assert(parse_throws("State\tPopulation\nA\t1,234\n", tab));
+        assert(parse_throws("State\tPopulation\nA\t1,\n", tab));
+        assert(population_table::parsed("State\tPopulation\nA\t1234\n", tab).population_for_each_state[0] == 1234);
+
+        // An empty file cannot be mapped, but it can be loaded.
+        {
+            const std::string path = temporary_file_with("");
+            mapped_file file(path);
+            unlink(path.c_str());
+            assert(file.contents().empty());
+        }
+
+        bool threw = false;
+        try
+        {
+            mapped_file file("/nonexistent/cpp_apportionment_test.csv");
+        }
+        catch (const std::system_error &e)
+        {
+            threw = (e.code().value() == ENOENT);
+        }
+        assert(threw);
+
+        // A loaded table feeds the dense engines as it is.
+        std::mt19937 generator(20250203);
+        const auto populations = random_populations(generator, 300, 40000000);
+        std::string tsv;
+        for (std::size_t i = 0; i < populations.size(); i++)
+        {
+            tsv += "District " + std::to_string(i) + "\t" + std::to_string(populations[i]) + "\n";
+        }
+        f.delimiter = '\t';
+        f.has_header = false;
+        const population_table t = population_table::parsed(tsv, f);
+        assert(t.population_for_each_state == populations);
+        assert(divisor_search_apportionment<huntington_hill>::num_reps_for_each_state(t.population_for_each_state, 3000) == apportionment_core(populations).num_reps_for_each_state(3000));
+    }
+
+    static void test_hierarchy()
+    {
+        std::mt19937 generator(20250204);
+        std::uniform_int_distribution<std::size_t> num_districts_distribution(1, 40);
+
+        std::vector<std::vector<apportionment_core::P>> district_populations;
+        for (int i = 0; i < 23; i++)
+        {
+            district_populations.push_back(random_populations(generator, num_districts_distribution(generator), 100000));
+        }
+
+        const auto r1 = hierarchical_apportionment<webster>::apportion(district_populations, 2000, 1);
+
+        // Each level must match apportioning it on its own.
+        std::vector<apportionment_core::P> population_for_each_state;
+        for (auto &&populations : district_populations)
+        {
+            apportionment_core::P sum = 0;
+            for (auto &&population : populations)
+            {
+                sum += population;
+            }
+            population_for_each_state.push_back(sum);
+        }
+        assert(r1.num_reps_for_each_state == divisor_apportionment_core<webster>(population_for_each_state).num_reps_for_each_state(2000));
+        for (std::size_t i = 0; i < district_populations.size(); i++)
+        {
+            assert(r1.num_reps_for_each_district[i] == divisor_apportionment_core<webster>(district_populations[i]).num_reps_for_each_state(r1.num_reps_for_each_state[i]));
+        }
+
+        // The same results on any number of threads.
+        for (unsigned num_threads : {2, 3, 8, 0})
+        {
+            const auto r = hierarchical_apportionment<webster>::apportion(district_populations, 2000, num_threads);
+            assert(r.num_reps_for_each_state == r1.num_reps_for_each_state);
+            assert(r.num_reps_for_each_district == r1.num_reps_for_each_district);
+        }
+
+        // Fewer seats than districts: Webster from zero, so most districts get none, and no
+        // state's seats are lost.
+        std::vector<std::vector<apportionment_core::P>> many_districts;
+        for (int i = 0; i < 3; i++)
+        {
+            many_districts.push_back(random_populations(generator, 3000, 100000));
+        }
+        const auto r2 = hierarchical_apportionment<webster>::apportion(many_districts, 150, 2);
+        for (std::size_t i = 0; i < many_districts.size(); i++)
+        {
+            assert(r2.num_reps_for_each_state[i] < many_districts[i].size());
+            assert(r2.num_reps_for_each_district[i] == divisor_search_apportionment<webster>::num_reps_for_each_state_from_zero(many_districts[i], r2.num_reps_for_each_state[i]));
+            apportionment_core::R sum = 0;
+            for (auto &&num_reps : r2.num_reps_for_each_district[i])
+            {
+                sum += num_reps;
+            }
+            assert(sum == r2.num_reps_for_each_state[i]);
+        }
+
+        // Huntington-Hill is not defined from zero, so it cannot apportion them.
+        bool threw = false;
+        try
+        {
+            hierarchical_apportionment<huntington_hill>::apportion(many_districts, 150, 2);
+        }
+        catch (const std::invalid_argument &)
+        {
+            threw = true;
+        }
+        assert(threw);
+
+        // A district without population.
+        district_populations[5][0] = 0;
+        threw = false;
+        try
+        {
+            hierarchical_apportionment<webster>::apportion(district_populations, 2000, 4);
+        }
+        catch (const std::invalid_argument &)
+        {
+            threw = true;
+        }
+        assert(threw);
+    }
+
 public:
     static void test_apportionment_class()
     {
@@ -13,6 +737,18 @@ public:
         apportionment::test_this_class_part_3();
         apportionment::test_this_class_part_4();
         apportionment::test_this_class_part_5();
+        apportionment::test_this_class_part_6();
+        apportionment::test_this_class_part_7();
+        test_apportionment_core();
+        test_apportionment_methods();
+        test_divisor_search();
+        test_divisor_search_from_zero();
+        test_sweep();
+        test_batch();
+        test_exact_priority_comparison();
+        test_sensitivity();
+        test_loader();
+        test_hierarchy();
     }
 };
 
@@ -1,9 +1,13 @@
 #ifndef SANDBOX_CPP_ARGS
 #define SANDBOX_CPP_ARGS
 
+#include <atomic>
 #include <iostream>
+#include <memory>
+#include <new>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <cstring>
 #include <cassert>
 #include <initializer_list>
@@ -24,10 +28,155 @@ private:
     // https://en.cppreference.com/w/cpp/error/invalid_argument
     // https://en.cppreference.com/w/cpp/language/new
     // https://en.cppreference.com/w/cpp/language/initialization
+    // https://en.cppreference.com/w/cpp/language/move_constructor
+    // https://en.cppreference.com/w/cpp/language/move_assignment
+    // https://en.cppreference.com/w/cpp/language/alignas
+    // https://en.cppreference.com/w/cpp/atomic/atomic/fetch_sub
+    // https://en.cppreference.com/w/cpp/utility/launder
+    // https://en.wikipedia.org/wiki/Copy-on-write
+
+public:
+    // Command lines whose pointer table and strings fit in this many bytes are stored in
+    // the object itself, without touching the heap.
+    static const std::size_t SMALL_BUFFER_SIZE = 256;
 
 private:
+    // All of the strings are stored in one buffer, after a table of `c + 1` pointers to
+    // them (the last one is nullptr, as in the argv of main). The buffer is either
+    // `small_buffer` or a single heap allocation, `heap`.
+    //
+    // A heap buffer starts with a reference count, and copies share it. A shared buffer is
+    // never changed: set() first gives this object a copy of its own, and nothing else
+    // hands out a way to write to it.
     int c = 0;          // argc
     char **v = nullptr; // argv
+    char *heap = nullptr;
+    alignas(char *) char small_buffer[SMALL_BUFFER_SIZE];
+
+    typedef std::atomic<std::size_t> reference_count;
+    static const std::size_t HEAP_HEADER_SIZE = (sizeof(reference_count) + sizeof(char *) - 1) / sizeof(char *) * sizeof(char *);
+
+    reference_count &get_reference_count() const noexcept
+    {
+        assert(heap);
+        return *std::launder(reinterpret_cast<reference_count *>(heap));
+    }
+
+private:
+    // Store copies of the `argc` strings of `argv` (any of which may be nullptr), with one
+    // allocation at most. `argc` must be positive.
+    void assign(int argc, const char *const *argv)
+    {
+        assert(argc > 0 && !v && !heap);
+
+        std::size_t size = (static_cast<std::size_t>(argc) + 1) * sizeof(char *);
+        for (int i = 0; i < argc; i++)
+        {
+            if (argv[i])
+            {
+                size += std::strlen(argv[i]) + 1;
+            }
+        }
+
+        // new char[] is aligned for any type that fits, so the reference count can go first.
+        char *buffer = small_buffer;
+        if (size > SMALL_BUFFER_SIZE)
+        {
+            heap = new char[HEAP_HEADER_SIZE + size];
+            new (heap) reference_count(1);
+            buffer = heap + HEAP_HEADER_SIZE;
+        }
+
+        c = argc;
+        v = reinterpret_cast<char **>(buffer);
+
+        char *next = buffer + (static_cast<std::size_t>(c) + 1) * sizeof(char *);
+        for (int i = 0; i < c; i++)
+        {
+            if (argv[i])
+            {
+                const std::size_t len = std::strlen(argv[i]);
+                std::memcpy(next, argv[i], len + 1);
+                v[i] = next;
+                next += len + 1;
+            }
+            else
+            {
+                v[i] = nullptr;
+            }
+        }
+        v[c] = nullptr;
+    }
+
+    // Copy the small buffer of `other`, moving the pointers into it along with it.
+    void copy_small_buffer(const args &other) noexcept
+    {
+        assert(!v && !heap && !other.heap && other.v);
+
+        std::memcpy(small_buffer, other.small_buffer, SMALL_BUFFER_SIZE);
+        v = reinterpret_cast<char **>(small_buffer);
+        for (int i = 0; i < other.c; i++)
+        {
+            if (v[i] >= other.small_buffer && v[i] < other.small_buffer + SMALL_BUFFER_SIZE)
+            {
+                v[i] = small_buffer + (v[i] - other.small_buffer);
+            }
+        }
+        c = other.c;
+    }
+
+    // Share the contents of `other`. A heap buffer is shared in O(1); a small buffer is
+    // copied.
+    void share(const args &other) noexcept
+    {
+        assert(!v && !heap);
+
+        if (other.heap)
+        {
+            other.get_reference_count().fetch_add(1, std::memory_order_relaxed);
+            heap = other.heap;
+            v = other.v;
+            c = other.c;
+        }
+        else if (other.v)
+        {
+            copy_small_buffer(other);
+        }
+    }
+
+    // Take over the contents of `other`, and leave it empty. A heap buffer changes hands
+    // in O(1); a small buffer is copied.
+    void take(args &other) noexcept
+    {
+        assert(!v && !heap);
+
+        if (other.heap)
+        {
+            heap = other.heap;
+            v = other.v;
+            c = other.c;
+        }
+        else if (other.v)
+        {
+            copy_small_buffer(other);
+        }
+
+        other.heap = nullptr;
+        other.v = nullptr;
+        other.c = 0;
+    }
+
+    // If the heap buffer is shared, replace it with a copy that is not.
+    void unshare()
+    {
+        if (heap && get_reference_count().load(std::memory_order_acquire) > 1)
+        {
+            args copy(0, nullptr);
+            copy.assign(c, v);
+            clear();
+            take(copy);
+        }
+    }
 
 public:
     // May throw std::invalid_argument
@@ -54,28 +203,7 @@ public:
 
             if (argv)
             {
-                c = argc;
-
-                v = new char *[c];
-
-                for (int i = 0; i < c; i++)
-                {
-                    if (argv[i])
-                    {
-                        auto len = std::strlen(argv[i]);
-                        char *vi = new char[len + 1];
-                        if (len > 0)
-                        {
-                            std::strncpy(vi, argv[i], len);
-                        }
-                        vi[len] = 0; // NOT v[len] = 0
-                        v[i] = vi;
-                    }
-                    else
-                    {
-                        v[i] = nullptr;
-                    }
-                }
+                assign(argc, argv);
             }
             else
             {
@@ -87,6 +215,7 @@ public:
     }
 
     args(const args &other) noexcept : c(0), v(nullptr) { *this = other; }
+    args(args &&other) noexcept : c(0), v(nullptr) { take(other); }
     ~args() noexcept { clear(); }
 
     args &operator=(const args &other) noexcept
@@ -95,31 +224,17 @@ public:
         {
             clear();
 
-            if ((other.c > 0) && other.v)
-            {
-                c = other.c;
-
-                v = new char *[c];
+            share(other);
+        }
+        return *this;
+    }
 
-                for (int i = 0; i < c; i++)
-                {
-                    if (other.v[i])
-                    {
-                        auto len = std::strlen(other.v[i]);
-                        char *vi = new char[len + 1];
-                        if (len > 0)
-                        {
-                            std::strncpy(vi, other.v[i], len);
-                        }
-                        vi[len] = 0; // NOT v[len] = 0
-                        v[i] = vi;
-                    }
-                    else
-                    {
-                        v[i] = nullptr;
-                    }
-                }
-            }
+    args &operator=(args &&other) noexcept
+    {
+        if (this != &other)
+        {
+            clear();
+            take(other);
         }
         return *this;
     }
@@ -164,33 +279,7 @@ public:
         {
             // argc > 0
 
-            c = argc;
-
-            v = new char *[c];
-
-            int i = 0;
-            for (const char *argv_i : il)
-            {
-                if (i < c)
-                {
-                    if (argv_i)
-                    {
-                        auto len = std::strlen(argv_i);
-                        char *vi = new char[len + 1];
-                        if (len > 0)
-                        {
-                            std::strncpy(vi, argv_i, len);
-                        }
-                        vi[len] = 0; // NOT v[len] = 0
-                        v[i] = vi;
-                    }
-                    else
-                    {
-                        v[i] = nullptr;
-                    }
-                }
-                i++;
-            }
+            assign(argc, il.begin());
         }
     }
 
@@ -198,22 +287,29 @@ private:
     // Should be private
     void clear() noexcept
     {
-        if (v)
+        if (heap && get_reference_count().fetch_sub(1, std::memory_order_acq_rel) == 1)
         {
-            for (int i = 0; i < c; i++)
-            {
-                if (v[i])
-                {
-                    delete[] (v[i]);
-                    v[i] = nullptr;
-                }
-            }
-            delete[] v;
-            v = nullptr;
+            get_reference_count().~reference_count();
+            delete[] heap;
         }
+        heap = nullptr;
+        v = nullptr;
         c = 0;
     }
 
+public:
+    int get_argc() const noexcept
+    {
+        return c;
+    }
+
+    // Like the argv of main, this ends with nullptr, so it can be passed to execv(). It is
+    // nullptr if get_argc() is zero.
+    const char *const *get_argv() const noexcept
+    {
+        return v;
+    }
+
 private:
     // https://en.cppreference.com/w/cpp/language/range-for
     // https://en.cppreference.com/w/cpp/language/member_functions#Member_functions_with_cv-qualifiers
@@ -223,24 +319,24 @@ private:
     // https://en.cppreference.com/w/cpp/container/array/end
 
 private:
-    class iterator final
+    class const_iterator final
     {
     private:
         int current_index = 0;
-        args &args_ref;
+        const args &args_ref;
 
     public:
-        iterator(int initial_index, args &a) : current_index(initial_index), args_ref(a) {}
+        const_iterator(int initial_index, const args &a) : current_index(initial_index), args_ref(a) {}
 
     public:
-        bool operator!=(const iterator &other) const noexcept
+        bool operator!=(const const_iterator &other) const noexcept
         {
             assert(&args_ref == &other.args_ref);
             return current_index != other.current_index;
         }
 
     public:
-        iterator &operator++() noexcept
+        const_iterator &operator++() noexcept
         {
             current_index++;
             return *this;
@@ -249,7 +345,8 @@ private:
     public:
         // May throw std::out_of_range
         // Be careful with this function's return value, because it might be nullptr.
-        auto &operator*()
+        // It cannot be used to change the argument; see set().
+        const char *operator*() const
         {
             if (current_index < 0 || current_index >= args_ref.c)
             {
@@ -262,57 +359,85 @@ private:
             }
             return args_ref.v[current_index];
         }
-    };
-
-    class const_iterator final
-    {
-    private:
-        int current_index = 0;
-        const args &args_ref;
-
-    public:
-        const_iterator(int initial_index, const args &a) : current_index(initial_index), args_ref(a) {}
-
-    public:
-        bool operator!=(const const_iterator &other) const noexcept
-        {
-            assert(&args_ref == &other.args_ref);
-            return current_index != other.current_index;
-        }
 
     public:
-        const_iterator &operator++() noexcept
+        // May throw std::out_of_range
+        // A view of the argument, which is empty if the argument is nullptr.
+        std::string_view view() const
         {
-            current_index++;
-            return *this;
+            return args_ref.view_at(current_index, __PRETTY_FUNCTION__);
         }
+    };
 
-    public:
-        // May throw std::out_of_range
-        // Be careful with this function's return value, because it might be nullptr.
-        const auto &operator*() const
+private:
+    // May throw std::out_of_range
+    std::string_view view_at(int index, const char *function_name) const
+    {
+        if (index < 0 || index >= c)
         {
-            if (current_index < 0 || current_index >= args_ref.c)
-            {
-                std::string s(__PRETTY_FUNCTION__);
-                s += " -- Cannot dereference value at index ";
-                s += std::to_string(current_index);
-                s += ", because argc is ";
-                s += std::to_string(args_ref.c);
-                throw std::out_of_range(s);
-            }
-            return args_ref.v[current_index];
+            std::string s(function_name);
+            s += " -- Cannot view value at index ";
+            s += std::to_string(index);
+            s += ", because argc is ";
+            s += std::to_string(c);
+            throw std::out_of_range(s);
         }
-    };
+        return v[index] ? std::string_view(v[index]) : std::string_view();
+    }
 
 public:
-    auto begin() noexcept { return iterator(0, *this); }
-    auto end() noexcept { return iterator(c, *this); }
+    // A non-const args is iterated with const_iterator too, so iterating never copies a
+    // shared buffer.
     auto begin() const noexcept { return const_iterator(0, *this); }
     auto end() const noexcept { return const_iterator(c, *this); }
     auto cbegin() const noexcept { return const_iterator(0, *this); }
     auto cend() const noexcept { return const_iterator(c, *this); }
 
+public:
+    // May throw std::out_of_range or std::bad_alloc
+    // Change argument `index` to a copy of `value`, which may be nullptr. If the buffer is
+    // shared, this object gets a copy of its own first, so its copies do not change. The
+    // pointers from get_argv() and from iterators may be invalidated.
+    void set(int index, const char *value)
+    {
+        if (index < 0 || index >= c)
+        {
+            std::string s(__PRETTY_FUNCTION__);
+            s += " -- Cannot set value at index ";
+            s += std::to_string(index);
+            s += ", because argc is ";
+            s += std::to_string(c);
+            throw std::out_of_range(s);
+        }
+
+        unshare();
+
+        // In place, if the new value fits where the old one was.
+        if (!value)
+        {
+            v[index] = nullptr;
+            return;
+        }
+        const std::size_t len = std::strlen(value);
+        if (v[index] && len <= std::strlen(v[index]))
+        {
+            std::memmove(v[index], value, len + 1);
+            return;
+        }
+
+        // Otherwise into a new buffer. `value` may point into the old one, so that goes
+        // only after the copy.
+        std::unique_ptr<const char *[]> argv(new const char *[c]);
+        for (int i = 0; i < c; i++)
+        {
+            argv[i] = (i == index) ? value : v[i];
+        }
+        args copy(0, nullptr);
+        copy.assign(c, argv.get());
+        clear();
+        take(copy);
+    }
+
 public:
     // https://en.cppreference.com/w/cpp/language/operators
     // "Stream extraction and insertion" section
@@ -0,0 +1,105 @@
+#ifndef SANDBOX_CPP_ARGS_BENCHMARK
+#define SANDBOX_CPP_ARGS_BENCHMARK
+
+#include "cpp_args.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cassert>
+
+class cpp_args_benchmark
+{
+private:
+    // https://en.cppreference.com/w/cpp/chrono/steady_clock
+    // https://en.cppreference.com/w/cpp/chrono/duration/duration_cast
+    template <typename F>
+    static double seconds_taken(F f)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count();
+    }
+
+    static void write_result(const std::string &name, int num_args, int num_copies, double seconds)
+    {
+        std::cout << name << '\t' << num_args << '\t' << num_copies << '\t' << seconds << '\n';
+    }
+
+    // What a copy cost when args allocated each string on its own: one array of pointers,
+    // then one allocation, strlen, and strncpy per argument.
+    static std::size_t copy_each_string(int argc, const char *const *argv)
+    {
+        char **v = new char *[argc];
+        for (int i = 0; i < argc; i++)
+        {
+            const std::size_t len = std::strlen(argv[i]);
+            v[i] = new char[len + 1];
+            std::strncpy(v[i], argv[i], len + 1);
+        }
+
+        const std::size_t first = static_cast<std::size_t>(v[0][0]);
+        for (int i = 0; i < argc; i++)
+        {
+            delete[] v[i];
+        }
+        delete[] v;
+        return first;
+    }
+
+public:
+    // Copy the same 1,000 arguments over and over, as a launcher does before each fork.
+    static void benchmark_copy()
+    {
+        std::cout << "copy\tnum_args\tnum_copies\tseconds\n";
+
+        const int num_args = 1000;
+        const int num_copies = 10000;
+
+        std::vector<std::string> strings;
+        std::vector<const char *> argv;
+        for (int i = 0; i < num_args; i++)
+        {
+            strings.push_back("--option-" + std::to_string(i) + "=value");
+        }
+        for (auto &&s : strings)
+        {
+            argv.push_back(s.c_str());
+        }
+        const args original(num_args, argv.data());
+        volatile std::size_t sink = 0;
+
+        const double each_string_seconds = seconds_taken([&]()
+                                                         {
+            for (int k = 0; k < num_copies; k++)
+            {
+                sink = sink + copy_each_string(original.get_argc(), original.get_argv());
+            } });
+        write_result("one allocation per string", num_args, num_copies, each_string_seconds);
+
+        const double arena_seconds = seconds_taken([&]()
+                                                   {
+            for (int k = 0; k < num_copies; k++)
+            {
+                const args copy(num_args, argv.data());
+                sink = sink + static_cast<std::size_t>(copy.get_argv()[0][0]);
+            } });
+        write_result("one allocation (unshared copy)", num_args, num_copies, arena_seconds);
+
+        const double shared_seconds = seconds_taken([&]()
+                                                    {
+            for (int k = 0; k < num_copies; k++)
+            {
+                const args copy(original);
+                sink = sink + static_cast<std::size_t>(copy.get_argv()[0][0]);
+            } });
+        write_result("shared buffer", num_args, num_copies, shared_seconds);
+
+        assert(sink == static_cast<std::size_t>('-') * 3 * num_copies);
+    }
+};
+
+#endif // SANDBOX_CPP_ARGS_BENCHMARK
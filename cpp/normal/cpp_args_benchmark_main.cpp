@@ -0,0 +1,7 @@
+#include "cpp_args_benchmark.hpp"
+
+int main()
+{
+    cpp_args_benchmark::benchmark_copy();
+    return 0;
+}
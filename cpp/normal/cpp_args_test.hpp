@@ -2,6 +2,9 @@
 #define SANDBOX_CPP_ARGS_TEST
 
 #include "cpp_args.hpp"
+#include <string>
+#include <utility>
+#include <vector>
 
 class cpp_args_test
 {
@@ -51,6 +54,171 @@ private:
         }
     }
 
+    static void assert_args_equality(const args &a, int argc, const char *const argv[])
+    {
+        assert(a.get_argc() == argc);
+        for (int i = 0; i < argc; i++)
+        {
+            assert_string_equality(a.get_argv()[i], argv[i]);
+        }
+        if (argc > 0)
+        {
+            assert(!a.get_argv()[argc]);
+        }
+        else
+        {
+            assert(!a.get_argv());
+        }
+    }
+
+    // Moves and copies, with command lines that fit in the small buffer and ones that do not.
+    static void test_args_storage()
+    {
+        const char *small_argv[] = {"ls", nullptr, "-l", ""};
+        const int small_argc = 4;
+
+        std::vector<std::string> strings;
+        std::vector<const char *> large_argv;
+        for (int i = 0; i < 1000; i++)
+        {
+            strings.push_back("argument-" + std::to_string(i));
+        }
+        for (auto &&s : strings)
+        {
+            large_argv.push_back(s.c_str());
+        }
+        large_argv[500] = nullptr;
+        const int large_argc = static_cast<int>(large_argv.size());
+
+        args small(small_argc, small_argv);
+        args large(large_argc, large_argv.data());
+        assert_args_equality(small, small_argc, small_argv);
+        assert_args_equality(large, large_argc, large_argv.data());
+
+        // The moved-to object does not point into the moved-from object's small buffer.
+        args small_moved(std::move(small));
+        assert_args_equality(small_moved, small_argc, small_argv);
+        assert_args_equality(small, 0, nullptr);
+        small = args(small_argc, small_argv);
+        assert_args_equality(small_moved, small_argc, small_argv);
+
+        const char *const *large_argv_before = large.get_argv();
+        args large_moved(std::move(large));
+        assert(large_moved.get_argv() == large_argv_before);
+        assert_args_equality(large_moved, large_argc, large_argv.data());
+        assert_args_equality(large, 0, nullptr);
+
+        large = std::move(large_moved);
+        assert(large.get_argv() == large_argv_before);
+        assert_args_equality(large_moved, 0, nullptr);
+
+        small_moved = std::move(large);
+        assert_args_equality(small_moved, large_argc, large_argv.data());
+        large = std::move(small);
+        assert_args_equality(large, small_argc, small_argv);
+
+        args copy(small_moved);
+        assert(copy.get_argv() == small_moved.get_argv());
+        assert_args_equality(copy, large_argc, large_argv.data());
+        copy = large;
+        assert_args_equality(copy, small_argc, small_argv);
+
+        args &self = copy;
+        copy = self;
+        assert_args_equality(copy, small_argc, small_argv);
+        copy = std::move(self);
+        assert_args_equality(copy, small_argc, small_argv);
+    }
+
+    // Copies share one buffer until one of them is changed with set().
+    static void test_args_sharing()
+    {
+        std::vector<std::string> strings;
+        std::vector<const char *> argv;
+        for (int i = 0; i < 1000; i++)
+        {
+            strings.push_back(std::to_string(i));
+        }
+        for (auto &&s : strings)
+        {
+            argv.push_back(s.c_str());
+        }
+        const int argc = static_cast<int>(argv.size());
+
+        args original(argc, argv.data());
+        args copy_1(original);
+        args copy_2(0, nullptr);
+        copy_2 = copy_1;
+        assert(copy_1.get_argv() == original.get_argv());
+        assert(copy_2.get_argv() == original.get_argv());
+
+        // Iterating never copies, even without const.
+        int i = 0;
+        for (auto it = copy_1.begin(); it != copy_1.end(); ++it, ++i)
+        {
+            assert(it.view() == strings[i]);
+            assert(std::string(*it) == strings[i]);
+        }
+        i = 0;
+        for (auto &&arg : copy_2)
+        {
+            assert(std::string(arg) == strings[i++]);
+        }
+        assert(copy_1.get_argv() == original.get_argv());
+        assert(copy_2.get_argv() == original.get_argv());
+
+        // Changing one copy leaves the others alone: in place when the value fits, and in
+        // a new buffer when it does not.
+        copy_1.set(0, "X");
+        assert(copy_1.get_argv() != original.get_argv());
+        assert(std::string(copy_1.get_argv()[0]) == "X");
+        assert(std::string(original.get_argv()[0]) == "0");
+        assert(std::string(copy_2.get_argv()[0]) == "0");
+        assert(copy_2.get_argv() == original.get_argv());
+
+        const char *const *copy_1_argv = copy_1.get_argv();
+        copy_1.set(1, "Y");
+        assert(copy_1.get_argv() == copy_1_argv);
+        copy_1.set(2, "a longer argument than before");
+        assert(std::string(copy_1.get_argv()[2]) == "a longer argument than before");
+        assert(std::string(copy_1.get_argv()[1]) == "Y" && std::string(copy_1.get_argv()[999]) == "999");
+        assert(std::string(original.get_argv()[2]) == "2");
+
+        // A copy made after a change, and then changed, does not change the first.
+        args copy_3(copy_1);
+        assert(copy_3.get_argv() == copy_1.get_argv());
+        copy_3.set(0, "Z");
+        assert(std::string(copy_1.get_argv()[0]) == "X");
+        assert(std::string(copy_3.get_argv()[0]) == "Z");
+
+        // A value from the args itself.
+        copy_3.set(3, copy_3.get_argv()[2]);
+        assert(std::string(copy_3.get_argv()[3]) == "a longer argument than before");
+
+        // The last copy keeps the buffer after the others are gone.
+        const char *const *shared_argv = original.get_argv();
+        original = args(0, nullptr);
+        copy_2.set(0, nullptr);
+        assert(copy_2.get_argv() == shared_argv);
+        assert(copy_2.begin().view().empty());
+
+        bool threw = false;
+        try
+        {
+            copy_2.set(argc, "out of range");
+        }
+        catch (const std::out_of_range &)
+        {
+            threw = true;
+        }
+        assert(threw);
+
+        args with_nullptr{"a", nullptr};
+        auto it_3 = with_nullptr.cbegin();
+        ++it_3;
+        assert(it_3.view().empty());
+    }
+
 public:
     static void test_args_class(int argc, char const *argv[])
     {
@@ -78,6 +246,9 @@ public:
         a4.operator_os(std::cout << '\n') << '\n';
 
         std::cout << '\n';
+
+        test_args_storage();
+        test_args_sharing();
     }
 };
 
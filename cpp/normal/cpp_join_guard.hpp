@@ -0,0 +1,45 @@
+#ifndef SANDBOX_CPP_JOIN_GUARD
+#define SANDBOX_CPP_JOIN_GUARD
+
+#include <thread>
+#include <vector>
+
+// Joins the threads of a vector when it goes out of scope. Without it, an exception thrown
+// while some of them run (such as std::system_error from the constructor of the next one)
+// destroys joinable threads, and that calls std::terminate. Declare it just after the
+// vector, so that it goes first.
+class cpp_join_guard final
+{
+private:
+    // https://en.cppreference.com/w/cpp/thread/thread/~thread
+    // https://en.cppreference.com/w/cpp/thread/thread/thread ("Exceptions")
+
+    std::vector<std::thread> &threads;
+
+public:
+    explicit cpp_join_guard(std::vector<std::thread> &the_threads) : threads(the_threads)
+    {
+    }
+
+    cpp_join_guard(const cpp_join_guard &) = delete;
+    cpp_join_guard &operator=(const cpp_join_guard &) = delete;
+
+    ~cpp_join_guard()
+    {
+        join();
+    }
+
+    // Join those that have not been joined yet.
+    void join()
+    {
+        for (auto &&thread : threads)
+        {
+            if (thread.joinable())
+            {
+                thread.join();
+            }
+        }
+    }
+};
+
+#endif // SANDBOX_CPP_JOIN_GUARD
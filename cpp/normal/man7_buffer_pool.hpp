@@ -0,0 +1,98 @@
+#ifndef SANDBOX_CPP_MAN7_BUFFER_POOL
+#define SANDBOX_CPP_MAN7_BUFFER_POOL
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Buffers in a few size classes, from `min_size` doubling up to `max_size`, for one
+// thread (a forwarder's event loop). Each class's buffers are cut from slabs of about
+// `slab_size` bytes, and a buffer that is given back goes on its class's free list for
+// the next one who asks: after the first few, getting and giving back a buffer is a push
+// and a pop. Slabs are kept until the pool is destroyed, so the memory reserved follows the
+// most that was ever in use at once, not the number of connections.
+class man7_buffer_pool final
+{
+private:
+    // https://en.cppreference.com/w/cpp/memory/unique_ptr
+    // https://en.wikipedia.org/wiki/Slab_allocation
+
+    std::vector<size_t> class_sizes;
+    std::vector<std::vector<char *>> free_lists;
+    std::vector<std::unique_ptr<char[]>> slabs;
+    size_t slab_size;
+
+    // Read by other threads, for monitoring
+    std::atomic<size_t> num_bytes_in_use{0};
+    std::atomic<size_t> num_bytes_reserved{0};
+
+public:
+    man7_buffer_pool(size_t min_size, size_t max_size, size_t the_slab_size = 256 * 1024) : slab_size(the_slab_size)
+    {
+        min_size = (min_size == 0) ? 1 : min_size;
+        for (size_t size = min_size; size < max_size; size *= 2)
+        {
+            class_sizes.push_back(size);
+        }
+        class_sizes.push_back(max_size);
+        free_lists.resize(class_sizes.size());
+    }
+
+    man7_buffer_pool(const man7_buffer_pool &) = delete;
+    man7_buffer_pool &operator=(const man7_buffer_pool &) = delete;
+
+    size_t get_num_classes() const
+    {
+        return class_sizes.size();
+    }
+
+    size_t get_class_size(size_t size_class) const
+    {
+        return class_sizes[size_class];
+    }
+
+    // A buffer of get_class_size(size_class) bytes
+    char *acquire(size_t size_class)
+    {
+        std::vector<char *> &free_list = free_lists[size_class];
+        const size_t size = class_sizes[size_class];
+        if (free_list.empty())
+        {
+            // Not value-initialized, so the pages are only touched when used.
+            const size_t num_buffers = (slab_size > size) ? slab_size / size : 1;
+            slabs.emplace_back(new char[num_buffers * size]);
+            for (size_t i = num_buffers; i > 0; i--)
+            {
+                free_list.push_back(slabs.back().get() + (i - 1) * size);
+            }
+            num_bytes_reserved.fetch_add(num_buffers * size, std::memory_order_relaxed);
+        }
+
+        char *const buffer = free_list.back();
+        free_list.pop_back();
+        num_bytes_in_use.fetch_add(size, std::memory_order_relaxed);
+        return buffer;
+    }
+
+    // Give back a buffer from acquire(size_class).
+    void release(char *buffer, size_t size_class)
+    {
+        free_lists[size_class].push_back(buffer);
+        num_bytes_in_use.fetch_sub(class_sizes[size_class], std::memory_order_relaxed);
+    }
+
+    // Safe to call from another thread
+    size_t get_num_bytes_in_use() const
+    {
+        return num_bytes_in_use.load(std::memory_order_relaxed);
+    }
+
+    // Safe to call from another thread
+    size_t get_num_bytes_reserved() const
+    {
+        return num_bytes_reserved.load(std::memory_order_relaxed);
+    }
+};
+
+#endif // SANDBOX_CPP_MAN7_BUFFER_POOL
@@ -0,0 +1,166 @@
+#ifndef SANDBOX_CPP_MAN7_ECHO_SERVER
+#define SANDBOX_CPP_MAN7_ECHO_SERVER
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <cerrno>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// A TCP echo server on a loopback address, with one thread per connection, to stand in
+// for the far end of the forwarders in their tests and benchmarks. A connection is closed
+// once the client stops sending and everything has been echoed.
+class man7_echo_server final
+{
+private:
+    // https://www.man7.org/linux/man-pages/man2/accept.2.html
+    // https://www.man7.org/linux/man-pages/man2/shutdown.2.html
+
+    int listen_fd = -1;
+    int port = 0;
+    std::thread accept_thread;
+
+    std::mutex mutex;
+    std::vector<int> data_sockets;
+    std::vector<std::thread> connection_threads;
+
+    static void echo(int data_socket)
+    {
+        char buffer[64 * 1024];
+        for (;;)
+        {
+            const ssize_t r = read(data_socket, buffer, sizeof(buffer));
+            if (r == -1 && errno == EINTR)
+            {
+                continue;
+            }
+            if (r <= 0)
+            {
+                break;
+            }
+            for (ssize_t written = 0; written < r;)
+            {
+                const ssize_t w = send(data_socket, buffer + written, r - written, MSG_NOSIGNAL);
+                if (w == -1)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+                    return;
+                }
+                written += w;
+            }
+        }
+        shutdown(data_socket, SHUT_WR);
+    }
+
+    void accept_all()
+    {
+        for (;;)
+        {
+            const int data_socket = accept(listen_fd, NULL, NULL);
+            if (data_socket == -1)
+            {
+                if (errno == EINTR || errno == ECONNABORTED)
+                {
+                    continue;
+                }
+                // stop() shut the listening socket down.
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            data_sockets.push_back(data_socket);
+            connection_threads.emplace_back(echo, data_socket);
+        }
+    }
+
+public:
+    // `address` is "127.0.0.1" or "::1". Returns false with errno set on failure.
+    bool start(const std::string &address)
+    {
+        sockaddr_storage addr;
+        memset(&addr, 0, sizeof(addr));
+        socklen_t addrlen = sizeof(sockaddr_in);
+        if (inet_pton(AF_INET, address.c_str(), &((sockaddr_in *)&addr)->sin_addr) == 1)
+        {
+            addr.ss_family = AF_INET;
+        }
+        else if (inet_pton(AF_INET6, address.c_str(), &((sockaddr_in6 *)&addr)->sin6_addr) == 1)
+        {
+            addr.ss_family = AF_INET6;
+            addrlen = sizeof(sockaddr_in6);
+        }
+        else
+        {
+            errno = EINVAL;
+            return false;
+        }
+
+        listen_fd = socket(addr.ss_family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (listen_fd == -1)
+        {
+            return false;
+        }
+        if (bind(listen_fd, (const sockaddr *)&addr, addrlen) == -1 || listen(listen_fd, SOMAXCONN) == -1 || getsockname(listen_fd, (sockaddr *)&addr, &addrlen) == -1)
+        {
+            const int errnum = errno;
+            close(listen_fd);
+            listen_fd = -1;
+            errno = errnum;
+            return false;
+        }
+        port = ntohs((addr.ss_family == AF_INET) ? ((sockaddr_in *)&addr)->sin_port : ((sockaddr_in6 *)&addr)->sin6_port);
+
+        accept_thread = std::thread(&man7_echo_server::accept_all, this);
+        return true;
+    }
+
+    int get_port() const
+    {
+        return port;
+    }
+
+    // Stop accepting, cut off every connection, and wait for the threads.
+    void stop()
+    {
+        if (listen_fd == -1)
+        {
+            return;
+        }
+        shutdown(listen_fd, SHUT_RDWR);
+        accept_thread.join();
+        close(listen_fd);
+        listen_fd = -1;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto &&data_socket : data_sockets)
+        {
+            shutdown(data_socket, SHUT_RDWR);
+        }
+        for (auto &&thread : connection_threads)
+        {
+            thread.join();
+        }
+        for (auto &&data_socket : data_sockets)
+        {
+            close(data_socket);
+        }
+        data_sockets.clear();
+        connection_threads.clear();
+    }
+
+    ~man7_echo_server()
+    {
+        stop();
+    }
+};
+
+#endif // SANDBOX_CPP_MAN7_ECHO_SERVER
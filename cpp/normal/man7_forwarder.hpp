@@ -0,0 +1,1511 @@
+// Based on the forwarder of the "EXAMPLES" section of https://www.man7.org/linux/man-pages/man2/select_tut.2.html
+
+#ifndef SANDBOX_CPP_MAN7_FORWARDER
+#define SANDBOX_CPP_MAN7_FORWARDER
+
+// For accept4()
+#include "man7_gnu_source.hpp"
+
+#include "man7_buffer_pool.hpp"
+#include "man7_connection.hpp"
+#include "man7_io_uring.hpp"
+#include "cpp_sockets.hpp"
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// The forwarder of man7_select_tut_example::man7_select_tut_example_main(), as one
+// edge-triggered epoll event loop that relays any number of connections at once, until
+// request_stop() is called.
+//
+// Each accepted connection (the client side) gets its own connection to the forward-to
+// address (the upstream side), which is connected without blocking, and a buffer for each
+// direction. Data read from one side is buffered until the other side takes it, and each
+// side is read from only while its buffer has room, so a slow reader slows down only its
+// own connection. When one side stops sending, the other side is shut down for writing
+// once the buffer is drained; when both have, the connection is closed. Urgent (MSG_OOB)
+// bytes are relayed as in man7_select_tut_example_main().
+//
+// With data_path::COPY, each buffer is a ring, so reading need not wait until the buffer
+// has been drained, and it comes from a man7_buffer_pool shared by all the connections. A
+// direction holds one only while data is in it: an idle connection holds none. The next
+// buffer that a direction takes is twice as big if it filled the last one, up to
+// `buffer_size`, or half as big if it used at most a quarter of the last few; and a buffer
+// that a read filled is swapped for a bigger one, data and all, before the next read.
+//
+// With data_path::SPLICE, the buffer for each direction is a pipe, and splice(2) moves the
+// data from one socket into the pipe and from the pipe into the other socket without
+// copying it through user space. Urgent bytes are not part of the stream that splice(2)
+// sees, so they still go through recv() and send().
+//
+// With backend::IO_URING, there is no readiness to wait for: one multishot accept keeps
+// accepting, the upstream connect is an operation of its own, and each direction always
+// has one receive in flight that takes a buffer from a shared ring of provided buffers
+// only when data arrives. The data is then sent (with MSG_WAITALL, so all of it or fail)
+// linked to the next receive from the same side, so the next receive starts only once the
+// buffer has been sent and given back; and all of that, for every connection, goes to the
+// kernel in one io_uring_enter() call that also waits for the next completions. Urgent
+// bytes are not relayed, and `path` is not used. If the kernel cannot run it (see
+// man7_io_uring::is_supported()), start() falls back to backend::EPOLL.
+class man7_forwarder final
+{
+private:
+    // https://www.man7.org/linux/man-pages/man7/epoll.7.html
+    // https://www.man7.org/linux/man-pages/man2/connect.2.html ("EINPROGRESS")
+    // https://www.man7.org/linux/man-pages/man2/eventfd.2.html
+    // https://www.man7.org/linux/man-pages/man7/tcp.7.html
+    // https://www.man7.org/linux/man-pages/man2/splice.2.html
+    // https://www.man7.org/linux/man-pages/man7/pipe.7.html ("Pipe capacity")
+    // https://www.man7.org/linux/man-pages/man3/io_uring_prep_multishot_accept.3.html
+    // https://www.man7.org/linux/man-pages/man3/io_uring_setup_buf_ring.3.html
+
+public:
+    enum class backend
+    {
+        EPOLL,
+        IO_URING,
+    };
+
+    enum class data_path
+    {
+        // read() into a buffer, and write() from it
+        COPY,
+
+        // splice() through a pipe
+        SPLICE,
+    };
+
+    class options final
+    {
+    public:
+        // 0 means any free port (see get_listen_port()).
+        int listen_port = 0;
+
+        // Let other sockets listen on the same port too (SO_REUSEPORT), and the kernel
+        // spread the connections among them (see man7_forwarder_pool).
+        bool reuse_port = false;
+
+        int forward_port = 0;
+
+        // An IPv4 or IPv6 address. The forwarder listens on the same family.
+        std::string forward_address = "127.0.0.1";
+
+        // The size of the buffer (or pipe) for each direction of each connection.
+        size_t buffer_size = 64 * 1024;
+
+        // For data_path::COPY: the size of the smallest buffer that a direction takes, when
+        // `adaptive_buffers` is set. Otherwise every direction holds a buffer of
+        // `buffer_size` from accept to close.
+        size_t min_buffer_size = 4 * 1024;
+        bool adaptive_buffers = true;
+
+        data_path path = data_path::COPY;
+
+        backend requested_backend = backend::EPOLL;
+
+        // For backend::IO_URING: the number of buffers (of `buffer_size` each) in the ring
+        // of provided buffers. A direction holds one only from the moment that data arrives
+        // until it has been sent. It must be a power of 2, or start() fails with EINVAL; the
+        // kernel takes up to 32768, and with more, start() falls back to backend::EPOLL.
+        unsigned num_provided_buffers = 64;
+    };
+
+private:
+    static const int MAX_NUM_EVENTS = 256;
+
+    // epoll_event::data (or io_uring user_data) of the listening socket and of `stop_fd`.
+    // The sockets of connections have `(index << 1) | side` (or, for io_uring operations,
+    // `(index << 3) | (operation << 1) | side`) instead.
+    static const uint64_t LISTEN_TAG = UINT64_MAX;
+    static const uint64_t STOP_TAG = UINT64_MAX - 1;
+
+    // io_uring user_data of the cancellation of what is in flight (see finish_io_uring())
+    static const uint64_t CANCEL_TAG = UINT64_MAX - 2;
+
+    static const unsigned NUM_SQ_ENTRIES = 4096;
+
+    // For data_path::COPY: after how many lightly used buffers in a row a direction takes
+    // smaller ones (see release_buffer())
+    static const unsigned NUM_LIGHT_USES_TO_SHRINK = 8;
+    static const unsigned short BUFFER_GROUP_ID = 0;
+
+    enum operation
+    {
+        CONNECT = 0,
+        RECEIVE = 1,
+        SEND = 2,
+    };
+
+    enum side
+    {
+        CLIENT = 0,
+        UPSTREAM = 1,
+    };
+
+    // The data read from one side, on its way to the other side.
+    class direction final
+    {
+    public:
+        // For data_path::COPY: a ring buffer of the pool's class `size_class` (nullptr while
+        // none is held, and then the class of the next one), and where its data starts
+        char *buffer = nullptr;
+        size_t size_class = 0;
+        size_t begin = 0;
+
+        // The number of bytes in the buffer (for backend::IO_URING, in the provided buffer)
+        size_t num_bytes = 0;
+
+        // Since the buffer was taken: the most bytes that were in it at once, and whether
+        // a read filled it
+        size_t high_water = 0;
+        bool filled = false;
+
+        // The number of buffers in a row that were used at most a quarter of
+        unsigned num_light_uses = 0;
+
+        // For data_path::SPLICE: the pipe, its capacity, and the number of bytes in it
+        int pipe_fds[2] = {-1, -1};
+        size_t pipe_capacity = 0;
+        size_t num_bytes_in_pipe = 0;
+
+        // The side that this direction reads from has stopped sending.
+        bool eof = false;
+
+        // The side that this direction writes to has been shut down for writing.
+        bool shut = false;
+
+        // For backend::IO_URING: the provided buffer being sent, and whether the receive
+        // found the ring of provided buffers empty and waits for one to be given back
+        int buffer_id = -1;
+        bool starved = false;
+    };
+
+    class connection final
+    {
+    public:
+        int fds[2] = {-1, -1};
+
+        // `directions[s]` carries the data read from `fds[s]`.
+        direction directions[2];
+
+        bool connecting = true;
+
+        // For backend::IO_URING: a connection is freed only once none of its operations
+        // are in flight, since each of them refers to it.
+        unsigned num_ops_in_flight = 0;
+        bool closing = false;
+    };
+
+private:
+    options opts;
+    backend the_backend = backend::EPOLL;
+    sockaddr_storage forward_addr;
+    socklen_t forward_addrlen = 0;
+
+    int listen_fd = -1;
+    int epoll_fd = -1;
+    int stop_fd = -1;
+
+    // The connection table. A closed connection's slot is reused.
+    std::vector<std::unique_ptr<connection>> connections;
+    std::vector<size_t> free_slots;
+
+    // For data_path::COPY
+    man7_buffer_pool buffer_pool;
+
+    man7_io_uring uring;
+    man7_io_uring::buffer_ring provided_buffers;
+
+    // For backend::IO_URING: the connections whose receives wait for a provided buffer,
+    // as `(index << 1) | side`, and the number of provided buffers that directions hold
+    std::vector<uint64_t> starved_receives;
+    unsigned num_provided_buffers_out = 0;
+
+    // For backend::IO_URING: whether the multishot accept, and the poll of `stop_fd`, are
+    // in flight
+    bool accept_in_flight = false;
+    bool stop_poll_in_flight = false;
+
+    // Accepting ran out of file descriptors, and the connections left in the backlog wait
+    // for one to be freed: the listening socket is edge-triggered, so no event comes for
+    // them (and with io_uring, an accept armed again at once would fail again at once), and
+    // the run loop accepts again once `fd_freed` (set by close_connection()).
+    bool accept_waits_for_fd = false;
+    bool fd_freed = false;
+
+    uint64_t num_syscalls = 0;
+    uint64_t num_accepted = 0;
+
+public:
+    explicit man7_forwarder(const options &the_options) : opts(the_options), buffer_pool(smallest_buffer_size(the_options), the_options.buffer_size)
+    {
+        memset(&forward_addr, 0, sizeof(forward_addr));
+    }
+
+    man7_forwarder(const man7_forwarder &) = delete;
+    man7_forwarder &operator=(const man7_forwarder &) = delete;
+
+    ~man7_forwarder()
+    {
+        close_everything();
+    }
+
+private:
+    static size_t smallest_buffer_size(const options &o)
+    {
+        return o.adaptive_buffers ? std::min(o.min_buffer_size, o.buffer_size) : o.buffer_size;
+    }
+
+    void close_everything()
+    {
+        // End the operations that refer to the connections first.
+        finish_io_uring();
+        uring.close_ring();
+        for (size_t i = 0; i < connections.size(); i++)
+        {
+            if (connections[i])
+            {
+                close_connection(i);
+            }
+        }
+        for (int *fd : {&listen_fd, &epoll_fd, &stop_fd})
+        {
+            if (*fd != -1)
+            {
+                close(*fd);
+                *fd = -1;
+            }
+        }
+    }
+
+    // Cancel the io_uring operations in flight, and wait for them to end. Closing the ring
+    // alone would cancel them too, but in the background: the listening socket would stay
+    // in use for a while after run() returns, and binding its port again could fail. The
+    // ring is closed next, whether this succeeds or not.
+    void finish_io_uring()
+    {
+        size_t num_in_flight = (accept_in_flight ? 1 : 0) + (stop_poll_in_flight ? 1 : 0);
+        accept_in_flight = false;
+        stop_poll_in_flight = false;
+        for (auto &&c : connections)
+        {
+            if (c)
+            {
+                num_in_flight += c->num_ops_in_flight;
+                c->num_ops_in_flight = 0;
+            }
+        }
+        if (num_in_flight == 0 || !uring.make_room(1))
+        {
+            return;
+        }
+        io_uring_sqe *const sqe = uring.get_sqe();
+        man7_io_uring::prepare(sqe, IORING_OP_ASYNC_CANCEL, -1, NULL, 0, CANCEL_TAG);
+        sqe->cancel_flags = IORING_ASYNC_CANCEL_ANY;
+
+        bool cancelled = false;
+        while (num_in_flight > 0 || !cancelled)
+        {
+            if (uring.submit_and_wait(1) == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                man7_connection::write_function_results(__func__, "io_uring_enter", -1, errno);
+                return;
+            }
+            uring.for_each_cqe([&](const io_uring_cqe &cqe)
+                               {
+                if (cqe.user_data == CANCEL_TAG)
+                {
+                    cancelled = true;
+                }
+                else if (cqe.user_data == LISTEN_TAG)
+                {
+                    // Accepted before the cancellation got to it
+                    if (cqe.res >= 0)
+                    {
+                        close(cqe.res);
+                    }
+                    if (!(cqe.flags & IORING_CQE_F_MORE))
+                    {
+                        num_in_flight--;
+                    }
+                }
+                else
+                {
+                    num_in_flight--;
+                } });
+        }
+    }
+
+    // https://www.man7.org/linux/man-pages/man3/inet_pton.3.html
+    bool parse_forward_address()
+    {
+        sockaddr_in *addr_in = (sockaddr_in *)&forward_addr;
+        sockaddr_in6 *addr_in6 = (sockaddr_in6 *)&forward_addr;
+
+        if (inet_pton(AF_INET, opts.forward_address.c_str(), &addr_in->sin_addr) == 1)
+        {
+            addr_in->sin_family = AF_INET;
+            addr_in->sin_port = htons(opts.forward_port);
+            forward_addrlen = sizeof(sockaddr_in);
+            return true;
+        }
+        if (inet_pton(AF_INET6, opts.forward_address.c_str(), &addr_in6->sin6_addr) == 1)
+        {
+            addr_in6->sin6_family = AF_INET6;
+            addr_in6->sin6_port = htons(opts.forward_port);
+            forward_addrlen = sizeof(sockaddr_in6);
+            return true;
+        }
+        errno = EINVAL;
+        return false;
+    }
+
+    // Listen on the wildcard address of the forward-to address's family.
+    int open_listen_socket()
+    {
+        int errnum = 0;
+
+        errno = 0;
+        const int fd = socket(forward_addr.ss_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        errnum = errno;
+        man7_connection::write_function_results(__func__, "socket", fd, errnum);
+
+        if (fd == -1)
+        {
+            return -1;
+        }
+
+        const int yes = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+        if (opts.reuse_port)
+        {
+            errno = 0;
+            const int setsockopt_result = setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &yes, sizeof(yes));
+            errnum = errno;
+            man7_connection::write_function_results(__func__, "setsockopt", setsockopt_result, errnum);
+
+            if (setsockopt_result == -1)
+            {
+                man7_connection::close_without_changing_errno(__func__, fd);
+                return -1;
+            }
+        }
+
+        sockaddr_storage addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.ss_family = forward_addr.ss_family;
+        if (addr.ss_family == AF_INET)
+        {
+            ((sockaddr_in *)&addr)->sin_port = htons(opts.listen_port);
+            ((sockaddr_in *)&addr)->sin_addr.s_addr = htonl(INADDR_ANY);
+        }
+        else
+        {
+            ((sockaddr_in6 *)&addr)->sin6_port = htons(opts.listen_port);
+            ((sockaddr_in6 *)&addr)->sin6_addr = in6addr_any;
+        }
+
+        errno = 0;
+        int ret = bind(fd, (const sockaddr *)&addr, forward_addrlen);
+        errnum = errno;
+        man7_connection::write_function_results(__func__, "bind", ret, errnum);
+
+        if (ret == 0)
+        {
+            errno = 0;
+            ret = listen(fd, SOMAXCONN);
+            errnum = errno;
+            man7_connection::write_function_results(__func__, "listen", ret, errnum);
+        }
+
+        if (ret == -1)
+        {
+            man7_connection::close_without_changing_errno(__func__, fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    // Returns 0, or -1 with errno set.
+    int start_io_uring()
+    {
+        if (!man7_io_uring::is_supported())
+        {
+            errno = ENOTSUP;
+            return -1;
+        }
+        if (uring.init(NUM_SQ_ENTRIES) == -1)
+        {
+            return -1;
+        }
+        // io_uring waits for the sockets itself. The listening socket stays non-blocking
+        // until nothing else can fail, since the epoll backend that start() falls back to
+        // accepts until EAGAIN.
+        if (provided_buffers.setup(uring, BUFFER_GROUP_ID, opts.num_provided_buffers, opts.buffer_size) == -1 || fcntl(listen_fd, F_SETFL, fcntl(listen_fd, F_GETFL) & ~O_NONBLOCK) == -1)
+        {
+            const int errnum = errno;
+            uring.close_ring();
+            errno = errnum;
+            return -1;
+        }
+        return 0;
+    }
+
+    bool add_to_epoll(int fd, uint32_t events, uint64_t tag)
+    {
+        epoll_event event;
+        memset(&event, 0, sizeof(event));
+        event.events = events;
+        event.data.u64 = tag;
+        return epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) == 0;
+    }
+
+public:
+    // Returns 0, or -1 with errno set.
+    int start()
+    {
+        int errnum = 0;
+
+        if (!parse_forward_address())
+        {
+            man7_connection::write_function_results(__func__, "parse_forward_address", -1, errno);
+            return -1;
+        }
+
+        // The ring of provided buffers is indexed with a mask.
+        const unsigned n = opts.num_provided_buffers;
+        if (opts.requested_backend == backend::IO_URING && (n == 0 || (n & (n - 1)) != 0))
+        {
+            man7_connection::write_function_results(__func__, "num_provided_buffers (not a power of 2)", -1, EINVAL);
+            errno = EINVAL;
+            return -1;
+        }
+
+        listen_fd = open_listen_socket();
+        if (listen_fd == -1)
+        {
+            return -1;
+        }
+
+        errno = 0;
+        stop_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        errnum = errno;
+        man7_connection::write_function_results(__func__, "eventfd", stop_fd, errnum);
+
+        if (stop_fd != -1 && opts.requested_backend == backend::IO_URING)
+        {
+            errno = 0;
+            const int start_result = start_io_uring();
+            errnum = errno;
+            man7_connection::write_function_results(__func__, "start_io_uring", start_result, errnum);
+            if (start_result == 0)
+            {
+                the_backend = backend::IO_URING;
+                return 0;
+            }
+            man7_connection::write_str("io_uring is not available, falling back to epoll");
+        }
+        the_backend = backend::EPOLL;
+
+        errno = 0;
+        epoll_fd = (stop_fd == -1) ? -1 : epoll_create1(EPOLL_CLOEXEC);
+        errnum = errno;
+        man7_connection::write_function_results(__func__, "epoll_create1", epoll_fd, errnum);
+
+        if (epoll_fd == -1 || !add_to_epoll(listen_fd, EPOLLIN | EPOLLET, LISTEN_TAG) || !add_to_epoll(stop_fd, EPOLLIN, STOP_TAG))
+        {
+            errnum = errno;
+            close_everything();
+            errno = errnum;
+            return -1;
+        }
+        return 0;
+    }
+
+    // The backend that start() settled on
+    backend get_backend() const
+    {
+        return the_backend;
+    }
+
+    // https://www.man7.org/linux/man-pages/man2/getsockname.2.html
+    // Returns -1 if start() has not succeeded.
+    int get_listen_port() const
+    {
+        sockaddr_storage addr;
+        socklen_t addrlen = sizeof(addr);
+        if (listen_fd == -1 || getsockname(listen_fd, (sockaddr *)&addr, &addrlen) == -1)
+        {
+            return -1;
+        }
+        return ntohs((addr.ss_family == AF_INET) ? ((sockaddr_in *)&addr)->sin_port : ((sockaddr_in6 *)&addr)->sin6_port);
+    }
+
+    // Make run() return. Safe to call from another thread, or from a signal handler.
+    void request_stop()
+    {
+        const uint64_t one = 1;
+        const int errnum = errno;
+        if (write(stop_fd, &one, sizeof(one)) == -1)
+        {
+            // The counter is full, so a stop is pending anyway.
+        }
+        errno = errnum;
+    }
+
+private:
+    void close_connection(size_t index)
+    {
+        connection &c = *connections[index];
+        for (int fd : c.fds)
+        {
+            if (fd != -1)
+            {
+                // Closing the socket also takes it out of the epoll set.
+                close(fd);
+            }
+        }
+        for (auto &&d : c.directions)
+        {
+            for (int fd : d.pipe_fds)
+            {
+                if (fd != -1)
+                {
+                    close(fd);
+                }
+            }
+            if (d.buffer != nullptr)
+            {
+                buffer_pool.release(d.buffer, d.size_class);
+            }
+        }
+        connections[index].reset();
+        free_slots.push_back(index);
+        fd_freed = true;
+    }
+
+    static bool is_out_of_fds(int errnum)
+    {
+        return errnum == EMFILE || errnum == ENFILE;
+    }
+
+    // Accepting stopped for want of a file descriptor.
+    void wait_for_fd()
+    {
+        accept_waits_for_fd = true;
+        fd_freed = false;
+    }
+
+    // Whether accepting should start again, now that a file descriptor has been freed
+    bool fd_is_freed_for_accept()
+    {
+        if (!accept_waits_for_fd || !fd_freed)
+        {
+            return false;
+        }
+        accept_waits_for_fd = false;
+        return true;
+    }
+
+    static void set_no_delay(int fd)
+    {
+        const int yes = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+    }
+
+    // The index of a new connection in the table
+    size_t new_connection()
+    {
+        size_t index = connections.size();
+        if (!free_slots.empty())
+        {
+            index = free_slots.back();
+            free_slots.pop_back();
+        }
+        else
+        {
+            connections.emplace_back();
+        }
+        connections[index].reset(new connection());
+        return index;
+    }
+
+    void accept_all()
+    {
+        for (;;)
+        {
+            num_syscalls++;
+            const int client_fd = accept4(listen_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (client_fd == -1)
+            {
+                if (errno == EINTR || errno == ECONNABORTED)
+                {
+                    continue;
+                }
+                if (errno != EAGAIN && errno != EWOULDBLOCK)
+                {
+                    man7_connection::write_function_results(__func__, "accept4", client_fd, errno);
+                }
+                if (is_out_of_fds(errno))
+                {
+                    wait_for_fd();
+                }
+                return;
+            }
+
+            num_accepted++;
+            const int upstream_fd = socket(forward_addr.ss_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+            if (upstream_fd == -1)
+            {
+                const int errnum = errno;
+                man7_connection::write_function_results(__func__, "socket", upstream_fd, errnum);
+                close(client_fd);
+                // Rather than accept the rest only to close them too
+                if (is_out_of_fds(errnum))
+                {
+                    wait_for_fd();
+                    return;
+                }
+                continue;
+            }
+            set_no_delay(client_fd);
+            set_no_delay(upstream_fd);
+
+            const int connect_result = connect(upstream_fd, (const sockaddr *)&forward_addr, forward_addrlen);
+            if (connect_result == -1 && errno != EINPROGRESS)
+            {
+                man7_connection::write_function_results(__func__, "connect", connect_result, errno);
+                close(upstream_fd);
+                close(client_fd);
+                continue;
+            }
+
+            const size_t index = new_connection();
+            connection &c = *connections[index];
+            c.fds[CLIENT] = client_fd;
+            c.fds[UPSTREAM] = upstream_fd;
+            c.connecting = (connect_result == -1);
+            if (!allocate_buffers(c))
+            {
+                man7_connection::write_function_results(__func__, "allocate_buffers", -1, errno);
+                close_connection(index);
+                continue;
+            }
+
+            const uint32_t events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLPRI | EPOLLET;
+            if (!add_to_epoll(client_fd, events, index << 1 | CLIENT) || !add_to_epoll(upstream_fd, events, index << 1 | UPSTREAM))
+            {
+                man7_connection::write_function_results(__func__, "epoll_ctl", -1, errno);
+                close_connection(index);
+            }
+        }
+    }
+
+    // https://www.man7.org/linux/man-pages/man2/pipe.2.html
+    // https://www.man7.org/linux/man-pages/man2/fcntl.2.html ("F_SETPIPE_SZ")
+    bool allocate_buffers(connection &c)
+    {
+        for (auto &&d : c.directions)
+        {
+            if (opts.path == data_path::COPY)
+            {
+                // With adaptive buffers, a direction takes one only when data comes.
+                if (!opts.adaptive_buffers)
+                {
+                    d.buffer = buffer_pool.acquire(d.size_class);
+                }
+                continue;
+            }
+
+            if (pipe2(d.pipe_fds, O_NONBLOCK | O_CLOEXEC) == -1)
+            {
+                return false;
+            }
+            // The kernel rounds the size up, and may refuse to grow it past
+            // /proc/sys/fs/pipe-max-size, so use whatever it ends up being.
+            fcntl(d.pipe_fds[1], F_SETPIPE_SZ, static_cast<int>(opts.buffer_size));
+            const int capacity = fcntl(d.pipe_fds[1], F_GETPIPE_SZ);
+            if (capacity <= 0)
+            {
+                return false;
+            }
+            d.pipe_capacity = static_cast<size_t>(capacity);
+        }
+        return true;
+    }
+
+    // https://www.man7.org/linux/man-pages/man2/getsockopt.2.html
+    // Returns false if the upstream connection failed.
+    static bool finish_connecting(connection &c)
+    {
+        int error = 0;
+        socklen_t len = sizeof(error);
+        if (getsockopt(c.fds[UPSTREAM], SOL_SOCKET, SO_ERROR, &error, &len) == -1 || error != 0)
+        {
+            return false;
+        }
+        c.connecting = false;
+        return true;
+    }
+
+    // https://www.man7.org/linux/man-pages/man2/recv.2.html
+    // https://www.man7.org/linux/man-pages/man2/send.2.html
+    // Relay an urgent byte from side `from`, as man7_select_tut_example_main() does.
+    static void relay_urgent_byte(connection &c, int from)
+    {
+        char ch;
+        if (recv(c.fds[from], &ch, 1, MSG_OOB) == 1)
+        {
+            send(c.fds[1 - from], &ch, 1, MSG_OOB | MSG_NOSIGNAL);
+        }
+    }
+
+    // The (one or two) pieces of the ring buffer `buffer` of `capacity` bytes that make up
+    // `length` bytes from `start`. Returns the number of pieces.
+    static size_t split_ring(char *buffer, size_t capacity, size_t start, size_t length, iovec pieces[2])
+    {
+        const size_t first = std::min(length, capacity - start);
+        pieces[0].iov_base = buffer + start;
+        pieces[0].iov_len = first;
+        pieces[1].iov_base = buffer;
+        pieces[1].iov_len = length - first;
+        return (length > first) ? 2 : 1;
+    }
+
+    // Swap the buffer of `d`, which a read filled, for one of the next class, with the data
+    // at its start.
+    void grow_buffer(direction &d)
+    {
+        const size_t capacity = buffer_pool.get_class_size(d.size_class);
+        char *const bigger = buffer_pool.acquire(d.size_class + 1);
+        const size_t first = std::min(d.num_bytes, capacity - d.begin);
+        memcpy(bigger, d.buffer + d.begin, first);
+        memcpy(bigger + first, d.buffer, d.num_bytes - first);
+        buffer_pool.release(d.buffer, d.size_class);
+        d.buffer = bigger;
+        d.size_class++;
+        d.begin = 0;
+        d.filled = false;
+    }
+
+    // Give the buffer of a drained direction back to the pool, and pick the class of the
+    // next one: bigger if this one filled up, smaller if it and the ones before it were
+    // barely used.
+    void release_buffer(direction &d)
+    {
+        const size_t capacity = buffer_pool.get_class_size(d.size_class);
+        buffer_pool.release(d.buffer, d.size_class);
+        d.buffer = nullptr;
+        d.begin = 0;
+        if (d.filled && d.size_class + 1 < buffer_pool.get_num_classes())
+        {
+            d.size_class++;
+        }
+        else if (d.high_water > 0 && d.high_water <= capacity / 4)
+        {
+            // A burst that happens to come in small reads is no reason to shrink.
+            if (++d.num_light_uses == NUM_LIGHT_USES_TO_SHRINK && d.size_class > 0)
+            {
+                d.size_class--;
+                d.num_light_uses = 0;
+            }
+        }
+        else if (d.high_water > 0)
+        {
+            d.num_light_uses = 0;
+        }
+        d.high_water = 0;
+        d.filled = false;
+    }
+
+    // https://www.man7.org/linux/man-pages/man2/recvmsg.2.html
+    // https://www.man7.org/linux/man-pages/man2/sendmsg.2.html
+    // Move data from side `from` to the other side until neither the read nor the write can
+    // go any further: edge-triggered events only come again for new readiness. Returns false
+    // if either socket failed.
+    bool pump_through_buffer(connection &c, int from)
+    {
+        direction &d = c.directions[from];
+        const int to = 1 - from;
+        iovec pieces[2];
+        msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = pieces;
+
+        for (;;)
+        {
+            bool progress = false;
+
+            if (d.num_bytes > 0 && !c.connecting)
+            {
+                const size_t capacity = buffer_pool.get_class_size(d.size_class);
+                msg.msg_iovlen = split_ring(d.buffer, capacity, d.begin, d.num_bytes, pieces);
+                num_syscalls++;
+                const ssize_t w = sendmsg(c.fds[to], &msg, MSG_NOSIGNAL);
+                if (w > 0)
+                {
+                    d.begin = (d.begin + w) % capacity;
+                    d.num_bytes -= w;
+                    progress = true;
+                }
+                else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+                {
+                    return false;
+                }
+            }
+
+            if (!d.eof && !(from == UPSTREAM && c.connecting))
+            {
+                if (d.buffer == nullptr)
+                {
+                    d.buffer = buffer_pool.acquire(d.size_class);
+                }
+                else if (opts.adaptive_buffers && d.filled && d.size_class + 1 < buffer_pool.get_num_classes())
+                {
+                    grow_buffer(d);
+                }
+
+                const size_t capacity = buffer_pool.get_class_size(d.size_class);
+                if (d.num_bytes < capacity)
+                {
+                    msg.msg_iovlen = split_ring(d.buffer, capacity, (d.begin + d.num_bytes) % capacity, capacity - d.num_bytes, pieces);
+                    num_syscalls++;
+                    const ssize_t r = recvmsg(c.fds[from], &msg, 0);
+                    if (r > 0)
+                    {
+                        d.num_bytes += r;
+                        d.high_water = std::max(d.high_water, d.num_bytes);
+                        d.filled |= (d.num_bytes == capacity);
+                        progress = true;
+                    }
+                    else if (r == 0)
+                    {
+                        d.eof = true;
+                        progress = true;
+                    }
+                    else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            if (!progress)
+            {
+                break;
+            }
+        }
+
+        if (opts.adaptive_buffers && d.num_bytes == 0 && d.buffer != nullptr)
+        {
+            release_buffer(d);
+        }
+
+        if (d.eof && d.num_bytes == 0 && !d.shut && !c.connecting)
+        {
+            num_syscalls++;
+            shutdown(c.fds[to], SHUT_WR);
+            d.shut = true;
+        }
+        return true;
+    }
+
+    // Like pump_through_buffer(), but through the direction's pipe. A pipe holds a page per
+    // chunk of data that it is given, so it can be full before `pipe_capacity` bytes are in
+    // it; then the read into it fails with EAGAIN until the write out of it makes room.
+    bool pump_through_pipe(connection &c, int from)
+    {
+        direction &d = c.directions[from];
+        const int to = 1 - from;
+        const unsigned flags = SPLICE_F_MOVE | SPLICE_F_NONBLOCK;
+
+        for (;;)
+        {
+            bool progress = false;
+
+            if (d.num_bytes_in_pipe > 0 && !c.connecting)
+            {
+                num_syscalls++;
+                const ssize_t w = splice(d.pipe_fds[0], NULL, c.fds[to], NULL, d.num_bytes_in_pipe, flags);
+                if (w > 0)
+                {
+                    d.num_bytes_in_pipe -= w;
+                    progress = true;
+                }
+                else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+                {
+                    return false;
+                }
+            }
+
+            if (!d.eof && d.num_bytes_in_pipe < d.pipe_capacity && !(from == UPSTREAM && c.connecting))
+            {
+                num_syscalls++;
+                const ssize_t r = splice(c.fds[from], NULL, d.pipe_fds[1], NULL, d.pipe_capacity - d.num_bytes_in_pipe, flags);
+                if (r > 0)
+                {
+                    d.num_bytes_in_pipe += r;
+                    progress = true;
+                }
+                else if (r == 0)
+                {
+                    d.eof = true;
+                    progress = true;
+                }
+                else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+                {
+                    return false;
+                }
+            }
+
+            if (!progress)
+            {
+                break;
+            }
+        }
+
+        if (d.eof && d.num_bytes_in_pipe == 0 && !d.shut && !c.connecting)
+        {
+            num_syscalls++;
+            shutdown(c.fds[to], SHUT_WR);
+            d.shut = true;
+        }
+        return true;
+    }
+
+    bool pump(connection &c, int from)
+    {
+        return (opts.path == data_path::SPLICE) ? pump_through_pipe(c, from) : pump_through_buffer(c, from);
+    }
+
+    void handle_event(size_t index, int event_side, uint32_t events)
+    {
+        // A connection closed earlier in this batch
+        if (index >= connections.size() || !connections[index])
+        {
+            return;
+        }
+        connection &c = *connections[index];
+
+        if (c.connecting && event_side == UPSTREAM && (events & (EPOLLOUT | EPOLLERR | EPOLLHUP)))
+        {
+            if (!finish_connecting(c))
+            {
+                close_connection(index);
+                return;
+            }
+        }
+
+        if (events & EPOLLPRI)
+        {
+            relay_urgent_byte(c, event_side);
+        }
+
+        if (!pump(c, CLIENT) || !pump(c, UPSTREAM) || (c.directions[CLIENT].shut && c.directions[UPSTREAM].shut))
+        {
+            close_connection(index);
+        }
+    }
+
+    int run_epoll()
+    {
+        epoll_event events[MAX_NUM_EVENTS];
+
+        for (;;)
+        {
+            num_syscalls++;
+            const int num_events = epoll_wait(epoll_fd, events, MAX_NUM_EVENTS, -1);
+            if (num_events == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                man7_connection::write_function_results(__func__, "epoll_wait", num_events, errno);
+                return -1;
+            }
+
+            for (int i = 0; i < num_events; i++)
+            {
+                const uint64_t tag = events[i].data.u64;
+                if (tag == STOP_TAG)
+                {
+                    close_everything();
+                    errno = 0;
+                    return 0;
+                }
+                if (tag == LISTEN_TAG)
+                {
+                    accept_all();
+                    continue;
+                }
+                handle_event(static_cast<size_t>(tag >> 1), static_cast<int>(tag & 1), events[i].events);
+            }
+
+            if (fd_is_freed_for_accept())
+            {
+                accept_all();
+            }
+        }
+    }
+
+    bool submit_accept()
+    {
+        if (!uring.make_room(1))
+        {
+            return false;
+        }
+        io_uring_sqe *const sqe = uring.get_sqe();
+        man7_io_uring::prepare(sqe, IORING_OP_ACCEPT, listen_fd, NULL, 0, LISTEN_TAG);
+        sqe->ioprio |= IORING_ACCEPT_MULTISHOT;
+        sqe->accept_flags = SOCK_CLOEXEC;
+        accept_in_flight = true;
+        return true;
+    }
+
+    static uint64_t tag_of(size_t index, operation op, int side)
+    {
+        return static_cast<uint64_t>(index) << 3 | op << 1 | side;
+    }
+
+    // Returns false if it could not be submitted, and the connection is closing instead. It
+    // is freed by the caller if nothing else of it is in flight (see handle_completion()).
+    bool submit_receive(size_t index, int from)
+    {
+        connection &c = *connections[index];
+        if (!uring.make_room(1))
+        {
+            begin_closing(c);
+            return false;
+        }
+        io_uring_sqe *const sqe = uring.get_sqe();
+        man7_io_uring::prepare(sqe, IORING_OP_RECV, c.fds[from], NULL, static_cast<uint32_t>(provided_buffers.buffer_size), tag_of(index, RECEIVE, from));
+        // Wait for data before taking a buffer. Otherwise the kernel takes one as soon as it
+        // issues the receive, and fails it with ENOBUFS when there is none, data or not: a
+        // starved receive retried by retry_starved_receives() might then have nothing to
+        // read, and never give the buffer back that would retry the next one.
+        sqe->ioprio |= IORING_RECVSEND_POLL_FIRST;
+        sqe->flags |= IOSQE_BUFFER_SELECT;
+        sqe->buf_group = provided_buffers.group_id;
+        c.num_ops_in_flight++;
+        return true;
+    }
+
+    // Send what was received from side `from`, linked to the next receive from that side.
+    // Returns false as submit_receive() does.
+    bool submit_send(size_t index, int from)
+    {
+        connection &c = *connections[index];
+        direction &d = c.directions[from];
+        if (!uring.make_room(2))
+        {
+            begin_closing(c);
+            return false;
+        }
+        io_uring_sqe *const sqe = uring.get_sqe();
+        man7_io_uring::prepare(sqe, IORING_OP_SEND, c.fds[1 - from], provided_buffers.get_buffer(static_cast<unsigned short>(d.buffer_id)), static_cast<uint32_t>(d.num_bytes), tag_of(index, SEND, from));
+        sqe->msg_flags = MSG_WAITALL | MSG_NOSIGNAL;
+        sqe->flags |= IOSQE_IO_LINK;
+        c.num_ops_in_flight++;
+        return submit_receive(index, from);
+    }
+
+    void on_accepted(int client_fd)
+    {
+        num_accepted++;
+        const int upstream_fd = socket(forward_addr.ss_family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (upstream_fd == -1)
+        {
+            man7_connection::write_function_results(__func__, "socket", upstream_fd, errno);
+            close(client_fd);
+            return;
+        }
+        set_no_delay(client_fd);
+        set_no_delay(upstream_fd);
+
+        const size_t index = new_connection();
+        connection &c = *connections[index];
+        c.fds[CLIENT] = client_fd;
+        c.fds[UPSTREAM] = upstream_fd;
+
+        if (!uring.make_room(1))
+        {
+            close_connection(index);
+            return;
+        }
+        io_uring_sqe *const sqe = uring.get_sqe();
+        man7_io_uring::prepare(sqe, IORING_OP_CONNECT, upstream_fd, &forward_addr, 0, tag_of(index, CONNECT, UPSTREAM));
+        sqe->off = forward_addrlen;
+        c.num_ops_in_flight++;
+    }
+
+    // Make the operations in flight finish: a pending receive returns 0, and a pending send
+    // fails.
+    void begin_closing(connection &c)
+    {
+        if (!c.closing)
+        {
+            c.closing = true;
+            for (int fd : c.fds)
+            {
+                shutdown(fd, SHUT_RDWR);
+            }
+        }
+    }
+
+    // Returns whether `d` had a buffer to give back.
+    bool put_back_buffer(direction &d)
+    {
+        if (d.buffer_id == -1)
+        {
+            return false;
+        }
+        provided_buffers.put_back(static_cast<unsigned short>(d.buffer_id));
+        d.buffer_id = -1;
+        num_provided_buffers_out--;
+        return true;
+    }
+
+    // A receive that found no provided buffer tries again, now that one is free. Receives
+    // wait for data before taking one, so the retried one takes it (or ends the stream),
+    // and then the next is retried. It may close a connection, so it is called when no
+    // reference to one is held.
+    void retry_starved_receives()
+    {
+        while (!starved_receives.empty())
+        {
+            const uint64_t tag = starved_receives.back();
+            starved_receives.pop_back();
+            const size_t index = static_cast<size_t>(tag >> 1);
+            const int from = static_cast<int>(tag & 1);
+            // The connection may have closed, and its slot been reused, since.
+            if (index < connections.size() && connections[index] && connections[index]->directions[from].starved)
+            {
+                connections[index]->directions[from].starved = false;
+                if (!submit_receive(index, from) && connections[index]->num_ops_in_flight == 0)
+                {
+                    // No completion is coming that would free it.
+                    close_connection(index);
+                }
+                return;
+            }
+        }
+    }
+
+    void handle_completion(const io_uring_cqe &cqe)
+    {
+        const size_t index = static_cast<size_t>(cqe.user_data >> 3);
+        const operation op = static_cast<operation>((cqe.user_data >> 1) & 3);
+        const int from = static_cast<int>(cqe.user_data & 1);
+        connection &c = *connections[index];
+        direction &d = c.directions[from];
+        c.num_ops_in_flight--;
+        bool gave_back = false;
+
+        if (op == CONNECT)
+        {
+            c.connecting = false;
+            if (cqe.res < 0)
+            {
+                begin_closing(c);
+            }
+            else if (!c.closing && submit_receive(index, CLIENT))
+            {
+                submit_receive(index, UPSTREAM);
+            }
+        }
+        else if (op == RECEIVE)
+        {
+            if (cqe.flags & IORING_CQE_F_BUFFER)
+            {
+                d.buffer_id = man7_io_uring::buffer_ring::buffer_id_of(cqe);
+                num_provided_buffers_out++;
+            }
+            if (c.closing || cqe.res <= 0)
+            {
+                gave_back = put_back_buffer(d);
+            }
+
+            if (c.closing)
+            {
+                // Only waiting for the other operations in flight
+            }
+            else if (cqe.res > 0)
+            {
+                d.num_bytes = static_cast<size_t>(cqe.res);
+                submit_send(index, from);
+            }
+            else if (cqe.res == 0)
+            {
+                d.eof = true;
+                shutdown(c.fds[1 - from], SHUT_WR);
+                d.shut = true;
+            }
+            else if (cqe.res == -ENOBUFS && num_provided_buffers_out < opts.num_provided_buffers)
+            {
+                // A buffer was given back between the receive finding none and this
+                // completion (earlier in the same batch, for instance), so no give-back
+                // is coming that would retry it.
+                submit_receive(index, from);
+            }
+            else if (cqe.res == -ENOBUFS)
+            {
+                d.starved = true;
+                starved_receives.push_back(index << 1 | from);
+            }
+            else
+            {
+                // -ECANCELED if the linked send failed
+                begin_closing(c);
+            }
+        }
+        else
+        {
+            gave_back = put_back_buffer(d);
+            if (cqe.res < 0 || static_cast<size_t>(cqe.res) != d.num_bytes)
+            {
+                begin_closing(c);
+            }
+        }
+
+        // This also frees a connection that a failed submission above began closing.
+        if (c.num_ops_in_flight == 0 && (c.closing || (c.directions[CLIENT].shut && c.directions[UPSTREAM].shut)))
+        {
+            close_connection(index);
+        }
+
+        // A receive that ended without taking a buffer (at the end of the stream, for
+        // instance) leaves the one that it may have been retried for to the next.
+        const bool left_buffer = op == RECEIVE && !(cqe.flags & IORING_CQE_F_BUFFER) && cqe.res != -ENOBUFS;
+        if (gave_back || (left_buffer && num_provided_buffers_out < opts.num_provided_buffers))
+        {
+            retry_starved_receives();
+        }
+    }
+
+    int run_io_uring()
+    {
+        if (!submit_accept() || !uring.make_room(1))
+        {
+            return -1;
+        }
+        io_uring_sqe *const sqe = uring.get_sqe();
+        man7_io_uring::prepare(sqe, IORING_OP_POLL_ADD, stop_fd, NULL, 0, STOP_TAG);
+        sqe->poll32_events = POLLIN;
+        stop_poll_in_flight = true;
+
+        for (;;)
+        {
+            if (uring.submit_and_wait(1) == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                man7_connection::write_function_results(__func__, "io_uring_enter", -1, errno);
+                return -1;
+            }
+
+            bool stopped = false;
+            bool failed = false;
+            uring.for_each_cqe([&](const io_uring_cqe &cqe)
+                               {
+                if (cqe.user_data == STOP_TAG)
+                {
+                    stop_poll_in_flight = false;
+                    stopped = true;
+                }
+                else if (cqe.user_data == LISTEN_TAG)
+                {
+                    if (cqe.res >= 0)
+                    {
+                        on_accepted(cqe.res);
+                    }
+                    else if (cqe.res != -ECONNABORTED && cqe.res != -EINTR)
+                    {
+                        man7_connection::write_function_results(__func__, "accept", -1, -cqe.res);
+                    }
+                    // The multishot accept ended (after an error, for instance).
+                    if (!(cqe.flags & IORING_CQE_F_MORE))
+                    {
+                        accept_in_flight = false;
+                        if (cqe.res < 0 && is_out_of_fds(-cqe.res))
+                        {
+                            wait_for_fd();
+                        }
+                        else
+                        {
+                            failed |= !submit_accept();
+                        }
+                    }
+                }
+                else
+                {
+                    handle_completion(cqe);
+                } });
+
+            if (stopped)
+            {
+                close_everything();
+                errno = 0;
+                return 0;
+            }
+            if (fd_is_freed_for_accept())
+            {
+                failed |= !submit_accept();
+            }
+            if (failed)
+            {
+                return -1;
+            }
+        }
+    }
+
+public:
+    // Relay connections until request_stop() is called, and then close them all. Returns 0,
+    // or -1 with errno set if waiting for events fails.
+    int run()
+    {
+        return (the_backend == backend::IO_URING) ? run_io_uring() : run_epoll();
+    }
+
+    // The number of connections being relayed
+    size_t get_num_connections() const
+    {
+        return connections.size() - free_slots.size();
+    }
+
+    // The number of connections accepted so far
+    uint64_t get_num_accepted() const
+    {
+        return num_accepted;
+    }
+
+    // For data_path::COPY: the bytes of the buffers that directions hold. Safe to call from
+    // another thread.
+    size_t get_num_buffer_bytes_in_use() const
+    {
+        return buffer_pool.get_num_bytes_in_use();
+    }
+
+    // For data_path::COPY: the bytes that the pool of buffers has reserved, in use or not.
+    // Safe to call from another thread.
+    size_t get_num_buffer_bytes_reserved() const
+    {
+        return buffer_pool.get_num_bytes_reserved();
+    }
+
+    // The number of system calls made to move data: epoll_wait(), accept4(), recv(),
+    // send(), splice() and shutdown(); or io_uring_enter().
+    uint64_t get_num_syscalls() const
+    {
+        return num_syscalls + uring.get_num_enters();
+    }
+
+private:
+    static man7_forwarder *&forwarder_to_stop()
+    {
+        static man7_forwarder *f = nullptr;
+        return f;
+    }
+
+    static void stop_on_signal(int)
+    {
+        forwarder_to_stop()->request_stop();
+    }
+
+public:
+    // "<listen-port> <forward-to-port> <forward-to-ip-address>", from argv[1] to argv[3],
+    // into `o`. Returns 0, or the exit status of man7_forwarder_main() for what is wrong,
+    // with errno set.
+    static int parse_arguments(char const *argv[], options &o)
+    {
+        try
+        {
+            o.listen_port = std::stoi(argv[1]);
+            o.forward_port = std::stoi(argv[2]);
+        }
+        catch (...)
+        {
+            errno = EINVAL;
+            return 2;
+        }
+        for (const int port : {o.listen_port, o.forward_port})
+        {
+            if (port < ((int)LOWER_BOUND_FOR_LOCAL_IP_PORT) || port > 65535)
+            {
+                // Refer to 'errno = EACCES;' in cpp_sockets::f_bind_ip()
+                errno = EACCES;
+                return 3;
+            }
+        }
+        o.forward_address = argv[3];
+        return 0;
+    }
+
+    // https://www.man7.org/linux/man-pages/man2/sigaction.2.html
+    // Like man7_select_tut_example::man7_select_tut_example_main(), "fwd <listen-port>
+    // <forward-to-port> <forward-to-ip-address>", but forwarding until SIGINT or SIGTERM.
+    static int man7_forwarder_main(int argc, char const *argv[])
+    {
+        if (argc != 4)
+        {
+            man7_connection::write_str("Usage: fwd <listen-port> <forward-to-port> <forward-to-ip-address>");
+            errno = (argc < 4) ? EINVAL : E2BIG;
+            return 1;
+        }
+
+        options o;
+        const int parse_result = parse_arguments(argv, o);
+        if (parse_result != 0)
+        {
+            return parse_result;
+        }
+
+        man7_forwarder forwarder(o);
+        if (forwarder.start() == -1)
+        {
+            return 4;
+        }
+
+        forwarder_to_stop() = &forwarder;
+        struct sigaction newact, oldact_SIGINT, oldact_SIGTERM;
+        memset(&newact, 0, sizeof(newact));
+        newact.sa_handler = stop_on_signal;
+        sigaction(SIGINT, &newact, &oldact_SIGINT);
+        sigaction(SIGTERM, &newact, &oldact_SIGTERM);
+
+        const int run_result = forwarder.run();
+
+        const int errnum = errno;
+        sigaction(SIGINT, &oldact_SIGINT, NULL);
+        sigaction(SIGTERM, &oldact_SIGTERM, NULL);
+        forwarder_to_stop() = nullptr;
+        errno = errnum;
+
+        return (run_result == 0) ? 0 : 5;
+    }
+};
+
+#endif // SANDBOX_CPP_MAN7_FORWARDER
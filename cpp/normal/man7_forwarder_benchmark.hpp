@@ -0,0 +1,478 @@
+#ifndef SANDBOX_MAN7_FORWARDER_BENCHMARK
+#define SANDBOX_MAN7_FORWARDER_BENCHMARK
+
+#include "man7_forwarder.hpp"
+#include "man7_forwarder_pool.hpp"
+#include "man7_echo_server.hpp"
+#include "cpp_ip_loopback.hpp"
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <cassert>
+
+class man7_forwarder_benchmark
+{
+private:
+    // https://en.cppreference.com/w/cpp/chrono/steady_clock
+    // https://en.cppreference.com/w/cpp/chrono/duration/duration_cast
+    template <typename F>
+    static double seconds_taken(F f)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count();
+    }
+
+    // https://www.man7.org/linux/man-pages/man3/pthread_getcpuclockid.3.html
+    static double thread_cpu_seconds(std::thread &thread)
+    {
+        clockid_t clock_id;
+        timespec ts;
+        if (pthread_getcpuclockid(thread.native_handle(), &clock_id) != 0 || clock_gettime(clock_id, &ts) == -1)
+        {
+            return 0.0;
+        }
+        return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) / 1e9;
+    }
+
+    static int connect_to(int port)
+    {
+        sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        inet_pton(AF_INET, IPv4_LOOPBACK_STRING_LITERAL, &addr.sin_addr);
+
+        const int fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        assert(fd != -1);
+        const int connect_result = connect(fd, (const sockaddr *)&addr, sizeof(addr));
+        assert(connect_result == 0);
+        const int yes = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+        return fd;
+    }
+
+    // Send `num_bytes` on each of `num_connections` connections to `port`, which echoes,
+    // and read them all back. Returns the seconds taken.
+    static double echo_bulk(int port, int num_connections, size_t num_bytes)
+    {
+        std::vector<int> fds;
+        for (int i = 0; i < num_connections; i++)
+        {
+            fds.push_back(connect_to(port));
+        }
+
+        return seconds_taken([&]()
+                             {
+            std::vector<std::thread> threads;
+            for (auto &&fd : fds)
+            {
+                threads.emplace_back([fd, num_bytes]()
+                                     {
+                    std::vector<char> chunk(64 * 1024, 'x');
+                    for (size_t sent = 0; sent < num_bytes;)
+                    {
+                        const ssize_t w = send(fd, chunk.data(), std::min(chunk.size(), num_bytes - sent), MSG_NOSIGNAL);
+                        assert(w > 0);
+                        sent += w;
+                    }
+                    shutdown(fd, SHUT_WR); });
+                threads.emplace_back([fd, num_bytes]()
+                                     {
+                    std::vector<char> chunk(64 * 1024);
+                    size_t received = 0;
+                    for (;;)
+                    {
+                        const ssize_t r = read(fd, chunk.data(), chunk.size());
+                        assert(r >= 0);
+                        if (r == 0)
+                        {
+                            break;
+                        }
+                        received += r;
+                    }
+                    assert(received == num_bytes);
+                    close(fd); });
+            }
+            for (auto &&thread : threads)
+            {
+                thread.join();
+            } });
+    }
+
+    // Round trips of `message_size` bytes on one connection to `port`. Returns the
+    // microseconds each round trip took, sorted.
+    static std::vector<double> echo_round_trips(int port, int num_round_trips, size_t message_size)
+    {
+        const int fd = connect_to(port);
+        std::vector<char> message(message_size, 'x');
+        std::vector<double> microseconds;
+
+        for (int i = 0; i < num_round_trips; i++)
+        {
+            microseconds.push_back(1e6 * seconds_taken([&]()
+                                                       {
+                const ssize_t w = send(fd, message.data(), message.size(), MSG_NOSIGNAL);
+                assert(w == static_cast<ssize_t>(message.size()));
+                for (size_t received = 0; received < message_size;)
+                {
+                    const ssize_t r = read(fd, message.data() + received, message_size - received);
+                    assert(r > 0);
+                    received += r;
+                } }));
+        }
+        close(fd);
+
+        std::sort(microseconds.begin(), microseconds.end());
+        return microseconds;
+    }
+
+    // `num_clients` threads, each making `num_connections_per_client` connections to
+    // `port`, one after another, with a one-byte round trip on each. Returns the seconds
+    // taken.
+    static double echo_connections(int port, int num_clients, int num_connections_per_client)
+    {
+        return seconds_taken([&]()
+                             {
+            std::vector<std::thread> threads;
+            for (int i = 0; i < num_clients; i++)
+            {
+                threads.emplace_back([&]()
+                                     {
+                    for (int j = 0; j < num_connections_per_client; j++)
+                    {
+                        const int fd = connect_to(port);
+                        char c = 'x';
+                        const ssize_t w = send(fd, &c, 1, MSG_NOSIGNAL);
+                        assert(w == 1);
+                        const ssize_t r = read(fd, &c, 1);
+                        assert(r == 1);
+                        close(fd);
+                    } });
+            }
+            for (auto &&thread : threads)
+            {
+                thread.join();
+            } });
+    }
+
+    static double percentile(const std::vector<double> &sorted, double p)
+    {
+        return sorted[static_cast<size_t>(p * (sorted.size() - 1))];
+    }
+
+    static void write_throughput(const std::string &name, int num_connections, size_t num_bytes_per_connection, double seconds, double cpu_seconds)
+    {
+        // Each byte crosses the forwarder twice: there and back.
+        const double num_bytes = 2.0 * num_connections * num_bytes_per_connection;
+        std::cout << name << '\t' << num_connections << '\t' << num_bytes * 8 / seconds / 1e9 << '\t';
+        if (cpu_seconds > 0)
+        {
+            std::cout << cpu_seconds / (num_bytes / 1e9);
+        }
+        else
+        {
+            std::cout << '-';
+        }
+        std::cout << '\n';
+    }
+
+    // Run `f(port)` against the echo server through a forwarder with options `o`, and
+    // return the forwarder thread's CPU time through `cpu_seconds`, and the number of
+    // system calls that it made to move data through `num_syscalls`.
+    template <typename F>
+    static void through_forwarder(man7_forwarder::options o, const man7_echo_server &echo_server, double &cpu_seconds, uint64_t &num_syscalls, F f)
+    {
+        o.forward_port = echo_server.get_port();
+        o.forward_address = IPv4_LOOPBACK_STRING_LITERAL;
+
+        man7_forwarder forwarder(o);
+        const int start_result = forwarder.start();
+        assert(start_result == 0);
+        std::thread forwarder_thread([&]()
+                                     { forwarder.run(); });
+
+        const double cpu_seconds_before = thread_cpu_seconds(forwarder_thread);
+        f(forwarder.get_listen_port());
+        cpu_seconds = thread_cpu_seconds(forwarder_thread) - cpu_seconds_before;
+
+        forwarder.request_stop();
+        forwarder_thread.join();
+        num_syscalls = forwarder.get_num_syscalls();
+    }
+
+    // https://www.man7.org/linux/man-pages/man2/dup.2.html
+    // The forwarders write a line per setup call, which would get in the way of the table.
+    static void run_quietly(const std::function<void()> &f)
+    {
+        fflush(stdout);
+        const int saved_stdout = dup(STDOUT_FILENO);
+        const int fd = open("/dev/null", O_WRONLY);
+        dup2(fd, STDOUT_FILENO);
+        close(fd);
+
+        f();
+
+        dup2(saved_stdout, STDOUT_FILENO);
+        close(saved_stdout);
+    }
+
+    static std::vector<std::pair<man7_forwarder::data_path, std::string>> paths()
+    {
+        return {{man7_forwarder::data_path::COPY, "man7_forwarder"},
+                {man7_forwarder::data_path::SPLICE, "man7_forwarder (splice)"}};
+    }
+
+    // Run `f(port)` against the echo server through a man7_forwarder_pool with
+    // `num_workers` workers.
+    template <typename F>
+    static void through_pool(unsigned num_workers, const man7_echo_server &echo_server, F f)
+    {
+        man7_forwarder_pool::options o;
+        o.forwarder_options.forward_port = echo_server.get_port();
+        o.forwarder_options.forward_address = IPv4_LOOPBACK_STRING_LITERAL;
+        o.num_workers = num_workers;
+
+        man7_forwarder_pool pool(o);
+        const int start_result = pool.start();
+        assert(start_result == 0);
+        std::thread pool_thread([&]()
+                                { pool.run(); });
+
+        f(pool.get_listen_port());
+
+        pool.request_stop();
+        pool_thread.join();
+    }
+
+public:
+    // Bulk echo and round trips over loopback, straight to the echo server and through the
+    // forwarder. Throughput counts both directions; CPU is the forwarder thread's.
+    static void benchmark_forwarder()
+    {
+        man7_echo_server echo_server;
+        const bool started = echo_server.start(IPv4_LOOPBACK_STRING_LITERAL);
+        assert(started);
+
+        const size_t num_bytes_per_connection = 64 * 1024 * 1024;
+        man7_forwarder::options o;
+
+        std::cout << "path\tnum_connections\tgbit_per_second\tforwarder_cpu_seconds_per_gb\n";
+        for (const int num_connections : {1, 8})
+        {
+            const size_t num_bytes = num_bytes_per_connection / num_connections;
+
+            const double direct_seconds = echo_bulk(echo_server.get_port(), num_connections, num_bytes);
+            write_throughput("direct", num_connections, num_bytes, direct_seconds, 0.0);
+
+            for (const auto &path : paths())
+            {
+                o.path = path.first;
+                double seconds = 0.0, cpu_seconds = 0.0;
+                uint64_t num_syscalls = 0;
+                run_quietly([&]()
+                            { through_forwarder(o, echo_server, cpu_seconds, num_syscalls, [&](int port)
+                                                { seconds = echo_bulk(port, num_connections, num_bytes); }); });
+                write_throughput(path.second, num_connections, num_bytes, seconds, cpu_seconds);
+            }
+        }
+
+        std::cout << "path\tmessage_size\tp50_microseconds\tp99_microseconds\n";
+        const int num_round_trips = 20000;
+        const size_t message_size = 64;
+
+        std::vector<double> direct = echo_round_trips(echo_server.get_port(), num_round_trips, message_size);
+        std::cout << "direct\t" << message_size << '\t' << percentile(direct, 0.5) << '\t' << percentile(direct, 0.99) << '\n';
+
+        for (const auto &path : paths())
+        {
+            o.path = path.first;
+            std::vector<double> forwarded;
+            double cpu_seconds = 0.0;
+            uint64_t num_syscalls = 0;
+            run_quietly([&]()
+                        { through_forwarder(o, echo_server, cpu_seconds, num_syscalls, [&](int port)
+                                            { forwarded = echo_round_trips(port, num_round_trips, message_size); }); });
+            std::cout << path.second << '\t' << message_size << '\t' << percentile(forwarded, 0.5) << '\t' << percentile(forwarded, 0.99) << '\n';
+        }
+    }
+
+    // New connections per second (each with a one-byte round trip) and bulk throughput with
+    // 8 connections, through a man7_forwarder_pool of 1 worker and up, as far as the
+    // number of CPUs (and at least 4). With fewer CPUs than workers, the workers take turns
+    // on the same CPUs, so there is nothing more to gain.
+    static void benchmark_pool()
+    {
+        man7_echo_server echo_server;
+        const bool started = echo_server.start(IPv4_LOOPBACK_STRING_LITERAL);
+        assert(started);
+
+        const unsigned num_cpus = std::thread::hardware_concurrency();
+        const int num_clients = 8;
+        const int num_connections_per_client = 500;
+        const int num_bulk_connections = 8;
+        const size_t num_bytes_per_connection = 8 * 1024 * 1024;
+
+        std::cout << "num_workers\tnum_cpus\tconnections_per_second\tgbit_per_second\n";
+        for (unsigned num_workers = 1; num_workers <= std::max(num_cpus, 4u); num_workers *= 2)
+        {
+            double connection_seconds = 0.0, bulk_seconds = 0.0;
+            run_quietly([&]()
+                        { through_pool(num_workers, echo_server, [&](int port)
+                                       {
+                connection_seconds = echo_connections(port, num_clients, num_connections_per_client);
+                bulk_seconds = echo_bulk(port, num_bulk_connections, num_bytes_per_connection); }); });
+
+            // Each byte crosses the forwarder twice: there and back.
+            const double num_bytes = 2.0 * num_bulk_connections * num_bytes_per_connection;
+            std::cout << num_workers << '\t' << num_cpus << '\t' << num_clients * num_connections_per_client / connection_seconds << '\t' << num_bytes * 8 / bulk_seconds / 1e9 << '\n';
+        }
+    }
+
+    // The buffers of the COPY path, fixed at 1 KiB (as in man7_select_tut_example_main()),
+    // fixed at 64 KiB, and adaptive from 4 KiB to 64 KiB: bulk throughput and the system
+    // calls made per MB, and then the buffer memory held by connections that have gone idle
+    // after a one-byte round trip each.
+    static void benchmark_buffers()
+    {
+        man7_echo_server echo_server;
+        const bool started = echo_server.start(IPv4_LOOPBACK_STRING_LITERAL);
+        assert(started);
+
+        struct buffers
+        {
+            std::string name;
+            size_t buffer_size;
+            bool adaptive;
+        };
+        const std::vector<buffers> all_buffers = {
+            {"fixed 1 KiB", 1024, false},
+            {"fixed 64 KiB", 64 * 1024, false},
+            {"adaptive 4-64 KiB", 64 * 1024, true}};
+        const size_t num_bytes_per_connection = 64 * 1024 * 1024;
+        const int num_idle_connections = 1000;
+
+        std::cout << "buffers\tnum_connections\tgbit_per_second\tsyscalls_per_mb\n";
+        for (const int num_connections : {1, 8})
+        {
+            const size_t num_bytes = num_bytes_per_connection / num_connections;
+            for (const auto &b : all_buffers)
+            {
+                man7_forwarder::options o;
+                o.buffer_size = b.buffer_size;
+                o.adaptive_buffers = b.adaptive;
+                double seconds = 0.0, cpu_seconds = 0.0;
+                uint64_t num_syscalls = 0;
+                run_quietly([&]()
+                            { through_forwarder(o, echo_server, cpu_seconds, num_syscalls, [&](int port)
+                                                { seconds = echo_bulk(port, num_connections, num_bytes); }); });
+
+                // Each byte crosses the forwarder twice: there and back.
+                const double num_mb = 2.0 * num_connections * num_bytes / (1024 * 1024);
+                std::cout << b.name << '\t' << num_connections << '\t' << num_mb * 1024 * 1024 * 8 / seconds / 1e9 << '\t' << num_syscalls / num_mb << '\n';
+            }
+        }
+
+        std::cout << "buffers\tnum_idle_connections\tbuffer_bytes_in_use\tbuffer_bytes_reserved\n";
+        for (const auto &b : all_buffers)
+        {
+            man7_forwarder::options o;
+            o.buffer_size = b.buffer_size;
+            o.adaptive_buffers = b.adaptive;
+            o.forward_port = echo_server.get_port();
+            o.forward_address = IPv4_LOOPBACK_STRING_LITERAL;
+            size_t num_bytes_in_use = 0, num_bytes_reserved = 0;
+            run_quietly([&]()
+                        {
+                man7_forwarder forwarder(o);
+                const int start_result = forwarder.start();
+                assert(start_result == 0);
+                std::thread forwarder_thread([&]()
+                                             { forwarder.run(); });
+
+                std::vector<int> fds;
+                for (int i = 0; i < num_idle_connections; i++)
+                {
+                    fds.push_back(connect_to(forwarder.get_listen_port()));
+                    char c = 'x';
+                    const ssize_t w = send(fds.back(), &c, 1, MSG_NOSIGNAL);
+                    assert(w == 1);
+                    const ssize_t r = read(fds.back(), &c, 1);
+                    assert(r == 1);
+                }
+                // Let the forwarder finish with the last byte.
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                num_bytes_in_use = forwarder.get_num_buffer_bytes_in_use();
+                num_bytes_reserved = forwarder.get_num_buffer_bytes_reserved();
+
+                for (auto &&fd : fds)
+                {
+                    close(fd);
+                }
+                forwarder.request_stop();
+                forwarder_thread.join(); });
+            std::cout << b.name << '\t' << num_idle_connections << '\t' << num_bytes_in_use << '\t' << num_bytes_reserved << '\n';
+        }
+    }
+
+    // Small round trips, on one connection and on many at once (a thread each), through
+    // the forwarder with each backend: how many system calls the forwarder makes per round
+    // trip, and how many round trips go through per second. With io_uring, one
+    // io_uring_enter() covers every connection that had something to do.
+    static void benchmark_backends()
+    {
+        man7_echo_server echo_server;
+        const bool started = echo_server.start(IPv4_LOOPBACK_STRING_LITERAL);
+        assert(started);
+
+        const std::vector<std::pair<man7_forwarder::backend, std::string>> backends = {
+            {man7_forwarder::backend::EPOLL, "epoll"},
+            {man7_forwarder::backend::IO_URING, "io_uring"}};
+        const int num_round_trips = 40000;
+        const size_t message_size = 64;
+
+        std::cout << "backend\tnum_connections\tround_trips_per_second\tsyscalls_per_round_trip\n";
+        for (const int num_connections : {1, 32})
+        {
+            for (const auto &backend : backends)
+            {
+                man7_forwarder::options o;
+                o.requested_backend = backend.first;
+                double seconds = 0.0, cpu_seconds = 0.0;
+                uint64_t num_syscalls = 0;
+                run_quietly([&]()
+                            { through_forwarder(o, echo_server, cpu_seconds, num_syscalls, [&](int port)
+                                                { seconds = seconds_taken([&]()
+                                                                          {
+                    std::vector<std::thread> threads;
+                    for (int i = 0; i < num_connections; i++)
+                    {
+                        threads.emplace_back([&]()
+                                             { echo_round_trips(port, num_round_trips / num_connections, message_size); });
+                    }
+                    for (auto &&thread : threads)
+                    {
+                        thread.join();
+                    } }); }); });
+                std::cout << backend.second << '\t' << num_connections << '\t' << num_round_trips / seconds << '\t' << static_cast<double>(num_syscalls) / num_round_trips << '\n';
+            }
+        }
+    }
+};
+
+#endif // SANDBOX_MAN7_FORWARDER_BENCHMARK
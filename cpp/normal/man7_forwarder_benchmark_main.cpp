@@ -0,0 +1,10 @@
+#include "man7_forwarder_benchmark.hpp"
+
+int main()
+{
+    man7_forwarder_benchmark::benchmark_forwarder();
+    man7_forwarder_benchmark::benchmark_backends();
+    man7_forwarder_benchmark::benchmark_buffers();
+    man7_forwarder_benchmark::benchmark_pool();
+    return 0;
+}
@@ -0,0 +1,253 @@
+#ifndef SANDBOX_CPP_MAN7_FORWARDER_POOL
+#define SANDBOX_CPP_MAN7_FORWARDER_POOL
+
+// For pthread_setaffinity_np() and CPU_SET()
+#include "man7_gnu_source.hpp"
+
+#include "man7_forwarder.hpp"
+#include "man7_connection.hpp"
+#include "cpp_join_guard.hpp"
+
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <string.h>
+#include <cerrno>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// man7_forwarder on `num_workers` threads at once, each with its own listening socket on
+// the same port (SO_REUSEPORT) and its own event loop, and each pinned to a CPU of its
+// own (as far as there are enough of them). The kernel spreads the incoming connections
+// among the listening sockets, and a connection then stays on the thread that accepted
+// it, so the workers share nothing and take no locks.
+class man7_forwarder_pool final
+{
+private:
+    // https://www.man7.org/linux/man-pages/man7/socket.7.html ("SO_REUSEPORT")
+    // https://www.man7.org/linux/man-pages/man3/pthread_setaffinity_np.3.html
+    // https://www.man7.org/linux/man-pages/man2/sched_getaffinity.2.html
+
+public:
+    class options final
+    {
+    public:
+        // For every worker. `reuse_port` is always set.
+        man7_forwarder::options forwarder_options;
+
+        // 0 means one per CPU that this process may run on.
+        unsigned num_workers = 0;
+
+        bool pin_to_cpus = true;
+    };
+
+private:
+    options opts;
+    std::vector<std::unique_ptr<man7_forwarder>> forwarders;
+
+    // The CPUs that this process may run on, in order
+    std::vector<int> cpus;
+
+public:
+    explicit man7_forwarder_pool(const options &the_options) : opts(the_options)
+    {
+    }
+
+    man7_forwarder_pool(const man7_forwarder_pool &) = delete;
+    man7_forwarder_pool &operator=(const man7_forwarder_pool &) = delete;
+
+    // Returns 0, or -1 with errno set.
+    int start()
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(0, sizeof(set), &set) == 0)
+        {
+            for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+            {
+                if (CPU_ISSET(cpu, &set))
+                {
+                    cpus.push_back(cpu);
+                }
+            }
+        }
+        if (opts.num_workers == 0)
+        {
+            opts.num_workers = cpus.empty() ? 1 : static_cast<unsigned>(cpus.size());
+        }
+
+        // The first worker picks the port, if it is 0, and the others listen on the same.
+        man7_forwarder::options o = opts.forwarder_options;
+        o.reuse_port = true;
+        for (unsigned i = 0; i < opts.num_workers; i++)
+        {
+            forwarders.emplace_back(new man7_forwarder(o));
+            if (forwarders.back()->start() == -1)
+            {
+                const int errnum = errno;
+                forwarders.clear();
+                errno = errnum;
+                return -1;
+            }
+            o.listen_port = forwarders.front()->get_listen_port();
+        }
+        return 0;
+    }
+
+    // Returns -1 if start() has not succeeded.
+    int get_listen_port() const
+    {
+        return forwarders.empty() ? -1 : forwarders.front()->get_listen_port();
+    }
+
+    size_t get_num_workers() const
+    {
+        return forwarders.size();
+    }
+
+    // The connections accepted so far by worker `worker`. Only meaningful once run() has
+    // returned.
+    uint64_t get_num_accepted(size_t worker) const
+    {
+        return forwarders[worker]->get_num_accepted();
+    }
+
+    // Make run() return. Safe to call from another thread, or from a signal handler.
+    void request_stop()
+    {
+        for (auto &&forwarder : forwarders)
+        {
+            forwarder->request_stop();
+        }
+    }
+
+private:
+    void work(size_t worker, int &run_result)
+    {
+        if (opts.pin_to_cpus && !cpus.empty())
+        {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpus[worker % cpus.size()], &set);
+            const int errnum = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+            if (errnum != 0)
+            {
+                man7_connection::write_function_results(__func__, "pthread_setaffinity_np", -1, errnum);
+            }
+        }
+        run_result = forwarders[worker]->run();
+    }
+
+public:
+    // Run every worker until request_stop() is called. Returns 0, or -1 if any worker's
+    // run() failed. May throw std::system_error, if a thread cannot be started, once the
+    // workers that did start have stopped.
+    int run()
+    {
+        std::vector<int> run_results(forwarders.size(), -1);
+        std::vector<std::thread> threads;
+        cpp_join_guard join_guard(threads);
+        try
+        {
+            for (size_t i = 0; i < forwarders.size(); i++)
+            {
+                threads.emplace_back(&man7_forwarder_pool::work, this, i, std::ref(run_results[i]));
+            }
+        }
+        catch (...)
+        {
+            // The workers that started run until they are stopped, and join_guard waits
+            // for them.
+            request_stop();
+            throw;
+        }
+        join_guard.join();
+
+        for (const int run_result : run_results)
+        {
+            if (run_result != 0)
+            {
+                return -1;
+            }
+        }
+        errno = 0;
+        return 0;
+    }
+
+private:
+    static man7_forwarder_pool *&pool_to_stop()
+    {
+        static man7_forwarder_pool *p = nullptr;
+        return p;
+    }
+
+    static void stop_on_signal(int)
+    {
+        pool_to_stop()->request_stop();
+    }
+
+public:
+    // https://www.man7.org/linux/man-pages/man2/sigaction.2.html
+    // Like man7_forwarder::man7_forwarder_main(), but "fwd <listen-port> <forward-to-port>
+    // <forward-to-ip-address> <num-workers>", where a <num-workers> of 0 means one per CPU.
+    static int man7_forwarder_pool_main(int argc, char const *argv[])
+    {
+        if (argc != 5)
+        {
+            man7_connection::write_str("Usage: fwd <listen-port> <forward-to-port> <forward-to-ip-address> <num-workers>");
+            errno = (argc < 5) ? EINVAL : E2BIG;
+            return 1;
+        }
+
+        options o;
+        const int parse_result = man7_forwarder::parse_arguments(argv, o.forwarder_options);
+        if (parse_result != 0)
+        {
+            return parse_result;
+        }
+        try
+        {
+            const int num_workers = std::stoi(argv[4]);
+            if (num_workers < 0)
+            {
+                errno = EINVAL;
+                return 2;
+            }
+            o.num_workers = static_cast<unsigned>(num_workers);
+        }
+        catch (...)
+        {
+            errno = EINVAL;
+            return 2;
+        }
+
+        man7_forwarder_pool pool(o);
+        if (pool.start() == -1)
+        {
+            return 4;
+        }
+
+        pool_to_stop() = &pool;
+        struct sigaction newact, oldact_SIGINT, oldact_SIGTERM;
+        memset(&newact, 0, sizeof(newact));
+        newact.sa_handler = stop_on_signal;
+        sigaction(SIGINT, &newact, &oldact_SIGINT);
+        sigaction(SIGTERM, &newact, &oldact_SIGTERM);
+
+        const int run_result = pool.run();
+
+        const int errnum = errno;
+        sigaction(SIGINT, &oldact_SIGINT, NULL);
+        sigaction(SIGTERM, &oldact_SIGTERM, NULL);
+        pool_to_stop() = nullptr;
+        errno = errnum;
+
+        return (run_result == 0) ? 0 : 5;
+    }
+};
+
+#endif // SANDBOX_CPP_MAN7_FORWARDER_POOL
@@ -4,6 +4,8 @@
 // Adapted from "Client program" section of https://www.man7.org/linux/man-pages/man3/getaddrinfo.3.html
 
 #include "man7_getaddrinfo_example.hpp"
+#include "man7_happy_eyeballs.hpp"
+#include "man7_resolver.hpp"
 #include "cpp_sockets.hpp"
 
 #include <netdb.h>
@@ -19,17 +21,18 @@
 class man7_getaddrinfo_example_client
 {
 public:
-    static int man7_getaddrinfo_example_client_main(int argc, char const *argv[])
+    // The host is looked up with `resolver` (by default, man7_resolver::get_default()), so
+    // runs after the first within a process take the addresses from its cache.
+    static int man7_getaddrinfo_example_client_main(int argc, char const *argv[], man7_resolver *resolver = nullptr)
     {
         int errnum = 0;
 
-        int sfd;
+        int sfd = -1;
         int getaddrinfo_result;
         char buf[BUF_SIZE_getaddrinfo];
         size_t size;
         ssize_t nread, nwrite;
         addrinfo hints;
-        addrinfo *result, *rp;
 
         if (argc < 3)
         {
@@ -92,9 +95,10 @@ public:
         hints.ai_protocol = 0; /* Any protocol */
 
         errno = 0;
-        getaddrinfo_result = getaddrinfo(argv[1], argv[2], &hints, &result);
-        errnum = errno;
-        man7_getaddrinfo_example::write_getinfo_results(__func__, "getaddrinfo", getaddrinfo_result, errnum);
+        const man7_resolver::result_ptr result = (resolver ? *resolver : man7_resolver::get_default()).resolve(argv[1], argv[2], &hints);
+        getaddrinfo_result = result->error;
+        errnum = result->errnum;
+        man7_getaddrinfo_example::write_getinfo_results(__func__, "man7_resolver::resolve", getaddrinfo_result, errnum);
 
         if (getaddrinfo_result)
         {
@@ -135,6 +139,7 @@ public:
                 errno = ESOCKTNOSUPPORT;
                 return 14;
             case EAI_SYSTEM:
+                errno = errnum;
                 return 15;
             default:
                 errno = EIO;
@@ -143,42 +148,19 @@ public:
         }
 
         /* getaddrinfo() returns a list of address structures.
-           Try each address until we successfully connect(2).
-           If socket(2) (or connect(2)) fails, we (close the socket
-           and) try the next address. */
-
-        for (rp = result; rp; rp = rp->ai_next)
-        {
-            errno = 0;
-            sfd = socket(rp->ai_family, rp->ai_socktype, rp->ai_protocol);
-            errnum = errno;
-            man7_connection::write_function_results(__func__, "socket", sfd, errnum);
+           Race them, IPv6 against IPv4, and keep the first
+           that connect(2) succeeds for (see man7_happy_eyeballs). */
 
-            if (sfd == -1)
-            {
-                continue;
-            }
-
-            errno = 0;
-            const int connect_result = connect(sfd, rp->ai_addr, rp->ai_addrlen); // https://www.man7.org/linux/man-pages/man2/connect.2.html
-            errnum = errno;
-            man7_connection::write_function_results(__func__, "connect", connect_result, errnum);
-
-            if (!connect_result)
-            {
-                break; /* Success */
-            }
-
-            man7_connection::close_without_changing_errno(__func__, sfd);
-        }
-
-        freeaddrinfo(result); /* No longer needed */
+        man7_happy_eyeballs connector;
+        errno = 0;
+        sfd = connector.connect(result->addresses);
+        errnum = errno;
+        man7_connection::write_function_results(__func__, "man7_happy_eyeballs::connect", sfd, errnum);
 
-        if (!rp)
+        if (sfd == -1)
         {
             /* No address succeeded */
             man7_connection::write_str("Could not connect");
-            man7_connection::close_without_changing_errno(__func__, sfd);
             return 17;
         }
 
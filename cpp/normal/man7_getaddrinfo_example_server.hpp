@@ -4,6 +4,8 @@
 // Adapted from "Server program" section of https://www.man7.org/linux/man-pages/man3/getaddrinfo.3.html
 
 #include "man7_getaddrinfo_example.hpp"
+#include "man7_udp_echo.hpp"
+#include "man7_udp_echo_pool.hpp"
 #include "cpp_sockets.hpp"
 
 #include <netdb.h>
@@ -23,6 +25,11 @@ private:
     static const int MAX_NUM_TRIES = 4;
 
 public:
+    // With a second argument, "epoll", "io_uring" or "mmsg", the datagrams are echoed by
+    // man7_udp_echo with that backend, without any output per datagram (see
+    // echo_with_backend()); "gso" is "mmsg" with GRO and GSO. With a third, the number of
+    // workers (0 for one per CPU), they are echoed by a man7_udp_echo_pool instead (see
+    // echo_with_pool()).
     static int man7_getaddrinfo_example_server_main(int argc, char const *argv[])
     {
         int errnum = 0;
@@ -36,7 +43,7 @@ public:
         addrinfo *result, *rp;
         sockaddr_storage peer_addr;
 
-        if (argc != 2)
+        if (argc < 2 || argc > 4)
         {
             // Based on part of man7_getaddrinfo_example_client::man7_getaddrinfo_example_client_main()
             write_usage(argv[0]);
@@ -206,6 +213,15 @@ public:
             }
         }
 
+        if (argc == 3)
+        {
+            return echo_with_backend(sfd, argv[2]);
+        }
+        if (argc == 4)
+        {
+            return echo_with_pool(sfd, argv[2], argv[3]);
+        }
+
         /* Read datagrams and echo them back to sender. */
 
         int num_tries_left = MAX_NUM_TRIES; // Decrease this variable by 1 every time recvfrom returns -1 and sets errno to EAGAIN
@@ -275,6 +291,138 @@ public:
     }
 
 private:
+    // Echo on `sfd` with man7_udp_echo, and then close it. Like the loop of
+    // man7_getaddrinfo_example_server_main(), it ends once MAX_NUM_TRIES receive timeouts
+    // (of a second each) in a row have passed without a datagram.
+    static int echo_with_backend(int sfd, const std::string &backend_name)
+    {
+        int errnum = 0;
+
+        man7_udp_echo::options o;
+        if (!parse_backend(backend_name, o))
+        {
+            man7_connection::close_without_changing_errno(__func__, sfd);
+            errno = EINVAL;
+            return 18;
+        }
+
+        int echo_result;
+        {
+            man7_udp_echo echo(sfd, o);
+
+            errno = 0;
+            echo_result = echo.start();
+            if (echo_result == 0)
+            {
+                echo_result = echo.run();
+            }
+            errnum = errno;
+            man7_connection::write_function_results(__func__, "man7_udp_echo::run", echo_result, errnum);
+
+            std::string s("Echoed ");
+            s += std::to_string(echo.get_num_datagrams());
+            s += " datagrams with ";
+            s += std::to_string(echo.get_num_syscalls());
+            s += " system calls";
+            man7_connection::write_str(s);
+        }
+
+        man7_connection::close_without_changing_errno(__func__, sfd);
+        errno = errnum;
+        return (echo_result == 0) ? 0 : 19;
+    }
+
+    // Echo with a man7_udp_echo_pool of `num_workers_str` workers, on the address that
+    // `sfd` was bound to (`sfd` itself is closed, so that the workers' sockets can take its
+    // place). MAX_NUM_TRIES applies to each worker: one that has been idle that long ends
+    // on its own, and the rest go on with the datagrams that it would have had, until they
+    // are idle too.
+    static int echo_with_pool(int sfd, const std::string &backend_name, const std::string &num_workers_str)
+    {
+        int errnum = 0;
+
+        man7_udp_echo_pool::options o;
+        int num_workers = -1;
+        try
+        {
+            num_workers = std::stoi(num_workers_str);
+        }
+        catch (...)
+        {
+        }
+        if (!parse_backend(backend_name, o.echo_options) || num_workers < 0)
+        {
+            man7_connection::close_without_changing_errno(__func__, sfd);
+            errno = EINVAL;
+            return 18;
+        }
+        o.num_workers = static_cast<unsigned>(num_workers);
+
+        sockaddr_storage addr;
+        socklen_t addrlen = sizeof(addr);
+        errno = 0;
+        const int getsockname_result = getsockname(sfd, (sockaddr *)&addr, &addrlen);
+        errnum = errno;
+        man7_connection::write_function_results(__func__, "getsockname", getsockname_result, errnum);
+        man7_connection::close_without_changing_errno(__func__, sfd);
+        if (getsockname_result == -1)
+        {
+            return 19;
+        }
+
+        man7_udp_echo_pool pool(o);
+        errno = 0;
+        int pool_result = pool.start((const sockaddr *)&addr, addrlen);
+        if (pool_result == 0)
+        {
+            pool_result = pool.run();
+        }
+        errnum = errno;
+        man7_connection::write_function_results(__func__, "man7_udp_echo_pool::run", pool_result, errnum);
+
+        for (size_t i = 0; i < pool.get_num_workers(); i++)
+        {
+            std::string s("Worker ");
+            s += std::to_string(i);
+            s += " echoed ";
+            s += std::to_string(pool.get_num_datagrams(i));
+            s += " datagrams with ";
+            s += std::to_string(pool.get_num_syscalls(i));
+            s += " system calls";
+            man7_connection::write_str(s);
+        }
+
+        errno = errnum;
+        return (pool_result == 0) ? 0 : 19;
+    }
+
+    // Set `o` for the backend named `backend_name`, and to end once MAX_NUM_TRIES receive
+    // timeouts (of a second each) in a row have passed without a datagram. Returns false
+    // if there is no such backend.
+    static bool parse_backend(const std::string &backend_name, man7_udp_echo::options &o)
+    {
+        if (backend_name == "epoll")
+        {
+            o.requested_backend = man7_udp_echo::backend::EPOLL;
+        }
+        else if (backend_name == "io_uring")
+        {
+            o.requested_backend = man7_udp_echo::backend::IO_URING;
+        }
+        else if (backend_name == "mmsg" || backend_name == "gso")
+        {
+            o.requested_backend = man7_udp_echo::backend::MMSG;
+            o.gro = (backend_name == "gso");
+            o.gso = (backend_name == "gso");
+        }
+        else
+        {
+            return false;
+        }
+        o.idle_timeout_ms = MAX_NUM_TRIES * 1000;
+        return true;
+    }
+
     // Output the string atomically, and don't change errno.
     // Based on man7_getaddrinfo_example_client::write_num_bytes_received()
     static void write_num_bytes_received(ssize_t nread, const std::string &host, const std::string &service)
@@ -297,7 +445,7 @@ private:
         const int errnum = errno;
         std::string s("Usage: ");
         s += argv_0;
-        s += " port";
+        s += " port [epoll|io_uring|mmsg|gso [num-workers]]";
         man7_connection::write_str(s);
         errno = errnum;
     }
@@ -1,10 +1,29 @@
 #ifndef SANDBOX_MAN7_GETADDRINFO_EXAMPLE_TEST
 #define SANDBOX_MAN7_GETADDRINFO_EXAMPLE_TEST
 
+// For pthread_setaffinity_np() and CPU_SET()
+#include "man7_gnu_source.hpp"
+
 #include "man7_getaddrinfo_example_client.hpp"
 #include "man7_getaddrinfo_example_server.hpp"
+#include "man7_udp_echo.hpp"
+#include "man7_udp_echo_pool.hpp"
+#include "man7_sendmmsg_example.hpp"
 #include "cpp_waitpid.hpp"
 
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cassert>
+
 class man7_getaddrinfo_example_test
 {
 private:
@@ -53,7 +72,9 @@ public:
     // https://www.man7.org/linux/man-pages/man2/fork.2.html
     // https://www.man7.org/linux/man-pages/man2/wait.2.html
     // Based on man7_test::test_man7()
-    static void test_man7_getaddrinfo_example(const char *host)
+    // `backend_name`, if any, is the server's second argument, and `num_workers`, if any,
+    // its third.
+    static void test_man7_getaddrinfo_example(const char *host, const char *backend_name = nullptr, const char *num_workers = nullptr)
     {
         int errnum = 0;
 
@@ -69,12 +90,15 @@ public:
         {
             man7_connection::write_function_results(__func__, "fork (child process)", pid_server, errnum);
 
-            int argc_server = 2;
-            const char *argv_server[2] = {
+            int argc_server = num_workers ? 4 : (backend_name ? 3 : 2);
+            const char *argv_server[4] = {
                 "./getaddrinfo_example_server",
 
                 // Refer to LOWER_BOUND_FOR_LOCAL_IP_PORT
-                "4097"};
+                "4097",
+
+                backend_name,
+                num_workers};
 
             errno = 0;
             int server_result = man7_getaddrinfo_example_server::man7_getaddrinfo_example_server_main(argc_server, argv_server);
@@ -120,6 +144,255 @@ public:
             man7_connection::write_function_results(__func__, "waitpid_special", waitpid_special_result, errnum);
         }
     }
+
+    // Many datagrams, a window of them at a time, through man7_udp_echo with backend `b`,
+    // which must echo each one, and then stop when asked to. With `segmented`, each window
+    // is sent as one message for GSO to cut up, which reaches the echo server (with GRO)
+    // in one piece, and must come back (with GSO) as the datagrams that it was cut into.
+    static void test_man7_udp_echo(const char *host, man7_udp_echo::backend b, bool segmented = false)
+    {
+        const int family = strchr(host, ':') ? AF_INET6 : AF_INET;
+        sockaddr_storage addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.ss_family = family;
+        socklen_t addrlen = (family == AF_INET) ? sizeof(sockaddr_in) : sizeof(sockaddr_in6);
+        inet_pton(family, host, (family == AF_INET) ? (void *)&((sockaddr_in *)&addr)->sin_addr : (void *)&((sockaddr_in6 *)&addr)->sin6_addr);
+
+        const int sfd = socket(family, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        assert(sfd != -1);
+        int ret = bind(sfd, (const sockaddr *)&addr, addrlen);
+        assert(ret == 0);
+        ret = getsockname(sfd, (sockaddr *)&addr, &addrlen);
+        assert(ret == 0);
+
+        man7_udp_echo::options o;
+        o.requested_backend = b;
+        o.num_slots = 8;
+        o.gro = segmented;
+        o.gso = segmented;
+        man7_udp_echo echo(sfd, o);
+        ret = echo.start();
+        assert(ret == 0);
+
+        int run_result = -1;
+        std::thread echo_thread([&]()
+                                { run_result = echo.run(); });
+
+        const int cfd = socket(family, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        assert(cfd != -1);
+        ret = connect(cfd, (const sockaddr *)&addr, addrlen);
+        assert(ret == 0);
+
+        // A window no larger than the slots, so that none is dropped for want of room.
+        const int num_windows = 200;
+        const int window = 8;
+        const size_t segment_size = 8;
+        for (int k = 0; k < num_windows; k++)
+        {
+            std::string segments;
+            for (int i = 0; i < window; i++)
+            {
+                std::string sent = std::to_string(k * window + i);
+                if (!segmented)
+                {
+                    const ssize_t w = send(cfd, sent.data(), sent.size(), 0);
+                    assert(w == static_cast<ssize_t>(sent.size()));
+                    continue;
+                }
+                // Zero-padded to the segment size, but for the last, which may be shorter.
+                if (i + 1 < window)
+                {
+                    sent.insert(0, segment_size - sent.size(), '0');
+                }
+                segments += sent;
+            }
+            if (segmented)
+            {
+                iovec iov = {&segments[0], segments.size()};
+                msghdr msg;
+                memset(&msg, 0, sizeof(msg));
+                msg.msg_iov = &iov;
+                msg.msg_iovlen = 1;
+                alignas(cmsghdr) char control[CMSG_SPACE(sizeof(uint16_t))];
+                man7_sendmmsg_example::set_segment_size(msg, control, segment_size);
+                const ssize_t w = sendmsg(cfd, &msg, 0);
+                assert(w == static_cast<ssize_t>(segments.size()));
+            }
+
+            for (int i = 0; i < window; i++)
+            {
+                char received[32];
+                const ssize_t r = recv(cfd, received, sizeof(received), 0);
+                assert(r > 0);
+                assert(!segmented || i + 1 == window || r == static_cast<ssize_t>(segment_size));
+                const int n = std::stoi(std::string(received, r));
+                assert(n == k * window + i || !segmented);
+                assert(n / window == k);
+            }
+        }
+
+        echo.request_stop();
+        echo_thread.join();
+        assert(run_result == 0);
+        assert(echo.get_num_datagrams() == static_cast<uint64_t>(num_windows * window));
+
+        std::string s("man7_udp_echo: ");
+        s += std::to_string(echo.get_num_syscalls());
+        s += " system calls for ";
+        s += std::to_string(echo.get_num_datagrams());
+        s += " datagrams";
+        man7_connection::write_str(s);
+
+        close(cfd);
+        close(sfd);
+    }
+
+    // run() ends once the socket has been idle for `idle_timeout_ms`, not some multiple of
+    // it: with io_uring, the first wait, which times out, is also the one that submits the
+    // receives.
+    static void test_man7_udp_echo_idle_timeout(const char *host, man7_udp_echo::backend b)
+    {
+        const int family = strchr(host, ':') ? AF_INET6 : AF_INET;
+        sockaddr_storage addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.ss_family = family;
+        socklen_t addrlen = (family == AF_INET) ? sizeof(sockaddr_in) : sizeof(sockaddr_in6);
+        inet_pton(family, host, (family == AF_INET) ? (void *)&((sockaddr_in *)&addr)->sin_addr : (void *)&((sockaddr_in6 *)&addr)->sin6_addr);
+
+        const int sfd = socket(family, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        assert(sfd != -1);
+        int ret = bind(sfd, (const sockaddr *)&addr, addrlen);
+        assert(ret == 0);
+
+        const int idle_timeout_ms = 400;
+        man7_udp_echo::options o;
+        o.requested_backend = b;
+        o.idle_timeout_ms = idle_timeout_ms;
+        man7_udp_echo echo(sfd, o);
+        ret = echo.start();
+        assert(ret == 0);
+
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        const int run_result = echo.run();
+        const double idle_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        assert(run_result == 0);
+        assert(idle_ms >= idle_timeout_ms - 50 && idle_ms < 1.5 * idle_timeout_ms);
+
+        close(sfd);
+    }
+
+    // Datagrams from many peers at once through a man7_udp_echo_pool of 3 workers, which
+    // must echo each one, and then end on their own once each has been idle for a while.
+    // By hash, each peer's source port picks the worker: all 60 landing on fewer than 3 is
+    // next to impossible. By CPU, every datagram goes to the same worker, as the peers all
+    // send from one CPU (and loopback receives on the CPU that sends).
+    static void test_man7_udp_echo_pool(const char *host, man7_udp_echo_pool::steering steer)
+    {
+        const int family = strchr(host, ':') ? AF_INET6 : AF_INET;
+        sockaddr_storage addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.ss_family = family;
+        socklen_t addrlen = (family == AF_INET) ? sizeof(sockaddr_in) : sizeof(sockaddr_in6);
+        inet_pton(family, host, (family == AF_INET) ? (void *)&((sockaddr_in *)&addr)->sin_addr : (void *)&((sockaddr_in6 *)&addr)->sin6_addr);
+
+        man7_udp_echo_pool::options o;
+        o.echo_options.requested_backend = man7_udp_echo::backend::MMSG;
+        o.echo_options.idle_timeout_ms = 300;
+        o.num_workers = 3;
+        o.steer = steer;
+        man7_udp_echo_pool pool(o);
+        int ret = pool.start((const sockaddr *)&addr, addrlen);
+        assert(ret == 0);
+        assert(pool.get_num_workers() == 3);
+        if (family == AF_INET)
+        {
+            ((sockaddr_in *)&addr)->sin_port = htons(pool.get_port());
+        }
+        else
+        {
+            ((sockaddr_in6 *)&addr)->sin6_port = htons(pool.get_port());
+        }
+
+        int run_result = -1;
+        std::thread pool_thread([&]()
+                                { run_result = pool.run(); });
+
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        ret = sched_getaffinity(0, sizeof(set), &set);
+        assert(ret == 0);
+        int cpu = 0;
+        while (!CPU_ISSET(cpu, &set))
+        {
+            cpu++;
+        }
+
+        const int num_peers = 60;
+        const int num_datagrams_per_peer = 5;
+        std::thread peers_thread([&]()
+                                 {
+            cpu_set_t one;
+            CPU_ZERO(&one);
+            CPU_SET(cpu, &one);
+            const int errnum = pthread_setaffinity_np(pthread_self(), sizeof(one), &one);
+            assert(errnum == 0);
+
+            std::vector<int> cfds;
+            for (int i = 0; i < num_peers; i++)
+            {
+                const int cfd = socket(family, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+                assert(cfd != -1);
+                const int connect_result = connect(cfd, (const sockaddr *)&addr, addrlen);
+                assert(connect_result == 0);
+                cfds.push_back(cfd);
+            }
+            for (int k = 0; k < num_datagrams_per_peer; k++)
+            {
+                for (int i = 0; i < num_peers; i++)
+                {
+                    const std::string sent = std::to_string(i * num_datagrams_per_peer + k);
+                    const ssize_t w = send(cfds[i], sent.data(), sent.size(), 0);
+                    assert(w == static_cast<ssize_t>(sent.size()));
+                    char received[32];
+                    const ssize_t r = recv(cfds[i], received, sizeof(received), 0);
+                    assert(r > 0);
+                    assert(std::string(received, r) == sent);
+                }
+            }
+            for (auto &&cfd : cfds)
+            {
+                close(cfd);
+            } });
+        peers_thread.join();
+
+        // No request_stop(): each worker ends once it has been idle for idle_timeout_ms.
+        pool_thread.join();
+        assert(run_result == 0);
+
+        uint64_t num_echoed = 0;
+        for (size_t i = 0; i < pool.get_num_workers(); i++)
+        {
+            if (steer == man7_udp_echo_pool::steering::HASH)
+            {
+                assert(pool.get_num_datagrams(i) > 0);
+            }
+            num_echoed += pool.get_num_datagrams(i);
+        }
+        assert(num_echoed == static_cast<uint64_t>(num_peers * num_datagrams_per_peer));
+        if (steer == man7_udp_echo_pool::steering::CPU_BPF)
+        {
+            assert(pool.get_num_datagrams(cpu % 3) == num_echoed);
+        }
+
+        std::string s("man7_udp_echo_pool:");
+        for (size_t i = 0; i < pool.get_num_workers(); i++)
+        {
+            s += ' ';
+            s += std::to_string(pool.get_num_datagrams(i));
+        }
+        s += " datagrams";
+        man7_connection::write_str(s);
+    }
 };
 
 #endif // SANDBOX_MAN7_GETADDRINFO_EXAMPLE_TEST
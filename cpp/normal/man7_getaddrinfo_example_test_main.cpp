@@ -5,5 +5,26 @@ int main()
 {
     man7_getaddrinfo_example_test::test_man7_getaddrinfo_example(IPv4_LOOPBACK_STRING_LITERAL);
     man7_getaddrinfo_example_test::test_man7_getaddrinfo_example(IPv6_LOOPBACK_STRING_LITERAL);
+    man7_getaddrinfo_example_test::test_man7_getaddrinfo_example(IPv4_LOOPBACK_STRING_LITERAL, "io_uring");
+    man7_getaddrinfo_example_test::test_man7_getaddrinfo_example(IPv4_LOOPBACK_STRING_LITERAL, "epoll");
+    man7_getaddrinfo_example_test::test_man7_getaddrinfo_example(IPv4_LOOPBACK_STRING_LITERAL, "mmsg");
+    man7_getaddrinfo_example_test::test_man7_getaddrinfo_example(IPv4_LOOPBACK_STRING_LITERAL, "gso");
+    man7_getaddrinfo_example_test::test_man7_udp_echo(IPv4_LOOPBACK_STRING_LITERAL, man7_udp_echo::backend::EPOLL);
+    man7_getaddrinfo_example_test::test_man7_udp_echo(IPv6_LOOPBACK_STRING_LITERAL, man7_udp_echo::backend::EPOLL);
+    man7_getaddrinfo_example_test::test_man7_udp_echo(IPv4_LOOPBACK_STRING_LITERAL, man7_udp_echo::backend::IO_URING);
+    man7_getaddrinfo_example_test::test_man7_udp_echo(IPv6_LOOPBACK_STRING_LITERAL, man7_udp_echo::backend::IO_URING);
+    man7_getaddrinfo_example_test::test_man7_udp_echo(IPv4_LOOPBACK_STRING_LITERAL, man7_udp_echo::backend::MMSG);
+    man7_getaddrinfo_example_test::test_man7_udp_echo(IPv6_LOOPBACK_STRING_LITERAL, man7_udp_echo::backend::MMSG);
+    man7_getaddrinfo_example_test::test_man7_udp_echo(IPv4_LOOPBACK_STRING_LITERAL, man7_udp_echo::backend::MMSG, true);
+    man7_getaddrinfo_example_test::test_man7_udp_echo(IPv6_LOOPBACK_STRING_LITERAL, man7_udp_echo::backend::MMSG, true);
+    man7_getaddrinfo_example_test::test_man7_udp_echo_idle_timeout(IPv4_LOOPBACK_STRING_LITERAL, man7_udp_echo::backend::EPOLL);
+    man7_getaddrinfo_example_test::test_man7_udp_echo_idle_timeout(IPv4_LOOPBACK_STRING_LITERAL, man7_udp_echo::backend::IO_URING);
+    man7_getaddrinfo_example_test::test_man7_udp_echo_idle_timeout(IPv4_LOOPBACK_STRING_LITERAL, man7_udp_echo::backend::MMSG);
+    man7_getaddrinfo_example_test::test_man7_getaddrinfo_example(IPv4_LOOPBACK_STRING_LITERAL, "mmsg", "2");
+    man7_getaddrinfo_example_test::test_man7_udp_echo_pool(IPv4_LOOPBACK_STRING_LITERAL, man7_udp_echo_pool::steering::HASH);
+    man7_getaddrinfo_example_test::test_man7_udp_echo_pool(IPv6_LOOPBACK_STRING_LITERAL, man7_udp_echo_pool::steering::HASH);
+    man7_getaddrinfo_example_test::test_man7_udp_echo_pool(IPv4_LOOPBACK_STRING_LITERAL, man7_udp_echo_pool::steering::INCOMING_CPU);
+    man7_getaddrinfo_example_test::test_man7_udp_echo_pool(IPv4_LOOPBACK_STRING_LITERAL, man7_udp_echo_pool::steering::CPU_BPF);
+    man7_getaddrinfo_example_test::test_man7_udp_echo_pool(IPv6_LOOPBACK_STRING_LITERAL, man7_udp_echo_pool::steering::CPU_BPF);
     return 0;
 }
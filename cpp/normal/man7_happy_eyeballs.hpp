@@ -0,0 +1,296 @@
+#ifndef SANDBOX_CPP_MAN7_HAPPY_EYEBALLS
+#define SANDBOX_CPP_MAN7_HAPPY_EYEBALLS
+
+#include "man7_resolver.hpp"
+#include "man7_connection.hpp"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cerrno>
+#include <chrono>
+#include <vector>
+
+// A connect() to the first of several addresses that answers, without waiting for each
+// in turn (RFC 8305, "Happy Eyeballs Version 2"). The addresses are put in order, one
+// family after the other (IPv6, IPv4, IPv6, ... if the first is IPv6), and tried with
+// non-blocking connects: the next starts `attempt_delay` after the one before, or at once
+// if every attempt so far has failed, and those already started carry on in the meantime.
+// The first to connect wins, and the others are closed. So an address that does not
+// answer costs `attempt_delay`, not a connect timeout, and one that refuses costs nothing.
+//
+// For IPv4 and IPv6 addresses only. A non-blocking connect() to an AF_UNIX socket whose
+// backlog is full fails with EAGAIN rather than going on in the background, so it would
+// count as a failure here, where a blocking connect() would have waited.
+class man7_happy_eyeballs final
+{
+private:
+    // https://www.rfc-editor.org/rfc/rfc8305
+    // https://www.man7.org/linux/man-pages/man2/connect.2.html ("EINPROGRESS")
+    // https://www.man7.org/linux/man-pages/man2/poll.2.html
+
+public:
+    class options final
+    {
+    public:
+        // RFC 8305's "Connection Attempt Delay": 250 ms recommended, and at least 10 ms
+        std::chrono::milliseconds attempt_delay{250};
+
+        // For the whole connection. -1 means no limit, other than each attempt's own.
+        int timeout_ms = -1;
+
+        // RFC 8305's "First Address Family Count": how many addresses of the first one's
+        // family go before the first of the other family
+        unsigned first_family_count = 1;
+    };
+
+private:
+    class attempt final
+    {
+    public:
+        int fd;
+        size_t index;
+    };
+
+    options opts;
+
+    int winner = -1;
+    size_t num_attempts = 0;
+
+public:
+    man7_happy_eyeballs() : man7_happy_eyeballs(options())
+    {
+    }
+
+    explicit man7_happy_eyeballs(const options &the_options) : opts(the_options)
+    {
+    }
+
+    // The order in which connect() tries `candidates`, as indexes into it
+    static std::vector<size_t> order(const std::vector<man7_resolver::address> &candidates, unsigned first_family_count = 1)
+    {
+        std::vector<size_t> first_family, other_families;
+        for (size_t i = 0; i < candidates.size(); i++)
+        {
+            (candidates[i].family == candidates[0].family ? first_family : other_families).push_back(i);
+        }
+
+        std::vector<size_t> ordered;
+        size_t f = 0, o = 0;
+        while (f < first_family.size() && f < first_family_count)
+        {
+            ordered.push_back(first_family[f++]);
+        }
+        while (f < first_family.size() || o < other_families.size())
+        {
+            if (o < other_families.size())
+            {
+                ordered.push_back(other_families[o++]);
+            }
+            if (f < first_family.size())
+            {
+                ordered.push_back(first_family[f++]);
+            }
+        }
+        return ordered;
+    }
+
+    // A connected socket to one of `candidates`, in blocking mode, or -1 with errno set:
+    // that of the last attempt to fail, or ETIMEDOUT if `timeout_ms` ran out first.
+    int connect(const std::vector<man7_resolver::address> &candidates)
+    {
+        using clock = std::chrono::steady_clock;
+
+        winner = -1;
+        num_attempts = 0;
+
+        const std::vector<size_t> ordered = order(candidates, opts.first_family_count);
+        std::vector<attempt> pending;
+        size_t next = 0;
+        int last_errnum = EADDRNOTAVAIL;
+
+        const clock::time_point deadline = clock::now() + std::chrono::milliseconds(opts.timeout_ms);
+        clock::time_point next_start = clock::now();
+
+        for (;;)
+        {
+            // The next attempt, when it is due, or at once if none is left in progress.
+            clock::time_point now = clock::now();
+            while (next < ordered.size() && (pending.empty() || now >= next_start))
+            {
+                const size_t index = ordered[next++];
+                attempt a = {-1, index};
+                const int start_result = start_attempt(candidates[index], a.fd);
+                if (start_result == 1)
+                {
+                    return win(a, pending);
+                }
+                if (start_result == 0)
+                {
+                    pending.push_back(a);
+                    next_start = now + opts.attempt_delay;
+                    break;
+                }
+                last_errnum = errno;
+            }
+
+            if (pending.empty())
+            {
+                errno = last_errnum;
+                return -1;
+            }
+
+            int timeout = -1;
+            if (next < ordered.size())
+            {
+                timeout = milliseconds_until(next_start, now);
+            }
+            if (opts.timeout_ms >= 0)
+            {
+                if (now >= deadline)
+                {
+                    give_up(pending);
+                    errno = ETIMEDOUT;
+                    return -1;
+                }
+                const int until_deadline = milliseconds_until(deadline, now);
+                timeout = (timeout == -1 || until_deadline < timeout) ? until_deadline : timeout;
+            }
+
+            std::vector<pollfd> pfds(pending.size());
+            for (size_t i = 0; i < pending.size(); i++)
+            {
+                pfds[i].fd = pending[i].fd;
+                pfds[i].events = POLLOUT;
+                pfds[i].revents = 0;
+            }
+            if (poll(pfds.data(), pfds.size(), timeout) == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                const int errnum = errno;
+                give_up(pending);
+                errno = errnum;
+                return -1;
+            }
+
+            // Settle the attempts that have: one that connected wins, and one that failed
+            // lets the next start at once.
+            std::vector<attempt> still_pending;
+            for (size_t i = 0; i < pending.size(); i++)
+            {
+                if (pfds[i].revents == 0)
+                {
+                    still_pending.push_back(pending[i]);
+                    continue;
+                }
+                int err = 0;
+                socklen_t len = sizeof(err);
+                if (getsockopt(pending[i].fd, SOL_SOCKET, SO_ERROR, &err, &len) == -1)
+                {
+                    err = errno;
+                }
+                man7_connection::write_function_results(__func__, "connect (completed)", (err == 0) ? 0 : -1, err);
+                if (err == 0)
+                {
+                    const attempt a = pending[i];
+                    pending.erase(pending.begin() + i);
+                    return win(a, pending);
+                }
+                close(pending[i].fd);
+                pending[i].fd = -1;
+                last_errnum = err;
+                next_start = clock::now();
+            }
+            pending.swap(still_pending);
+        }
+    }
+
+    // The index into the candidates of the one that connect() connected to, or -1
+    int get_winner() const
+    {
+        return winner;
+    }
+
+    // How many connects the last connect() started
+    size_t get_num_attempts() const
+    {
+        return num_attempts;
+    }
+
+private:
+    static int milliseconds_until(std::chrono::steady_clock::time_point then, std::chrono::steady_clock::time_point now)
+    {
+        if (then <= now)
+        {
+            return 0;
+        }
+        return static_cast<int>(std::chrono::ceil<std::chrono::milliseconds>(then - now).count());
+    }
+
+    // Returns 1 if `a` connected at once, 0 if it is in progress on `fd`, or -1 with errno
+    // set if it failed.
+    int start_attempt(const man7_resolver::address &a, int &fd)
+    {
+        int errnum = 0;
+        num_attempts++;
+
+        errno = 0;
+        fd = socket(a.family, a.socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, a.protocol);
+        errnum = errno;
+        man7_connection::write_function_results(__func__, "socket", fd, errnum);
+        if (fd == -1)
+        {
+            return -1;
+        }
+
+        errno = 0;
+        const int connect_result = ::connect(fd, (const sockaddr *)&a.addr, a.addrlen);
+        errnum = errno;
+        man7_connection::write_function_results(__func__, "connect", connect_result, errnum);
+        if (connect_result == 0)
+        {
+            return 1;
+        }
+        if (errnum == EINPROGRESS)
+        {
+            return 0;
+        }
+        close(fd);
+        fd = -1;
+        errno = errnum;
+        return -1;
+    }
+
+    // `a` connected: close the others, and hand it over in blocking mode.
+    int win(const attempt &a, std::vector<attempt> &others)
+    {
+        give_up(others);
+        winner = static_cast<int>(a.index);
+        const int flags = fcntl(a.fd, F_GETFL);
+        if (flags == -1 || fcntl(a.fd, F_SETFL, flags & ~O_NONBLOCK) == -1)
+        {
+            man7_connection::close_without_changing_errno(__func__, a.fd);
+            return -1;
+        }
+        errno = 0;
+        return a.fd;
+    }
+
+    static void give_up(std::vector<attempt> &attempts)
+    {
+        for (auto &&a : attempts)
+        {
+            if (a.fd != -1)
+            {
+                close(a.fd);
+            }
+        }
+        attempts.clear();
+    }
+};
+
+#endif // SANDBOX_CPP_MAN7_HAPPY_EYEBALLS
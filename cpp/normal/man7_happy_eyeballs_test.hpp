@@ -0,0 +1,259 @@
+#ifndef SANDBOX_MAN7_HAPPY_EYEBALLS_TEST
+#define SANDBOX_MAN7_HAPPY_EYEBALLS_TEST
+
+#include "man7_happy_eyeballs.hpp"
+#include "man7_resolver.hpp"
+#include "cpp_ip_loopback.hpp"
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cassert>
+
+class man7_happy_eyeballs_test
+{
+private:
+    // https://www.man7.org/linux/man-pages/man2/listen.2.html
+    // A TCP port on a loopback address that accepts connections, refuses them (bound, but
+    // not listening, so that a SYN gets a RST), or lets them hang: its backlog is 0, and
+    // one connection that nobody accepts fills it, so the kernel drops further SYNs, and
+    // the client sends its SYN again only after a second. release() accepts that one, so
+    // a hanging connection gets through on its next SYN: a listener that is slow to answer.
+    class stand_in_listener final
+    {
+    public:
+        enum class behavior
+        {
+            ACCEPT,
+            REFUSE,
+            HANG,
+        };
+
+    private:
+        int fd = -1;
+        int filler_fd = -1;
+        man7_resolver::address a;
+
+    public:
+        stand_in_listener(const char *host, behavior b)
+        {
+            a.family = strchr(host, ':') ? AF_INET6 : AF_INET;
+            a.socktype = SOCK_STREAM;
+            a.protocol = 0;
+            memset(&a.addr, 0, sizeof(a.addr));
+            a.addr.ss_family = a.family;
+            a.addrlen = (a.family == AF_INET) ? sizeof(sockaddr_in) : sizeof(sockaddr_in6);
+            inet_pton(a.family, host, (a.family == AF_INET) ? (void *)&((sockaddr_in *)&a.addr)->sin_addr : (void *)&((sockaddr_in6 *)&a.addr)->sin6_addr);
+
+            fd = socket(a.family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+            assert(fd != -1);
+            int ret = bind(fd, (const sockaddr *)&a.addr, a.addrlen);
+            assert(ret == 0);
+            socklen_t addrlen = a.addrlen;
+            ret = getsockname(fd, (sockaddr *)&a.addr, &addrlen);
+            assert(ret == 0);
+
+            if (b == behavior::REFUSE)
+            {
+                return;
+            }
+            ret = listen(fd, (b == behavior::HANG) ? 0 : 16);
+            assert(ret == 0);
+            if (b == behavior::HANG)
+            {
+                filler_fd = socket(a.family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+                assert(filler_fd != -1);
+                ret = ::connect(filler_fd, (const sockaddr *)&a.addr, a.addrlen);
+                assert(ret == 0);
+            }
+        }
+
+        stand_in_listener(const stand_in_listener &) = delete;
+        stand_in_listener &operator=(const stand_in_listener &) = delete;
+
+        ~stand_in_listener()
+        {
+            for (const int f : {fd, filler_fd})
+            {
+                if (f != -1)
+                {
+                    close(f);
+                }
+            }
+        }
+
+        const man7_resolver::address &candidate() const
+        {
+            return a;
+        }
+
+        // A connection made to it (the filler's, first, for HANG)
+        int accept_one()
+        {
+            return accept4(fd, NULL, NULL, SOCK_CLOEXEC);
+        }
+
+        // Let the next connection through (HANG).
+        void release()
+        {
+            const int accepted = accept_one();
+            assert(accepted != -1);
+            close(accepted);
+        }
+    };
+
+    using behavior = stand_in_listener::behavior;
+
+    static double milliseconds_since(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    static man7_happy_eyeballs::options options_with(int attempt_delay_ms, int timeout_ms = -1)
+    {
+        man7_happy_eyeballs::options o;
+        o.attempt_delay = std::chrono::milliseconds(attempt_delay_ms);
+        o.timeout_ms = timeout_ms;
+        return o;
+    }
+
+public:
+    // RFC 8305, section 4: one family after the other, starting with the first address's.
+    static void test_man7_happy_eyeballs_order()
+    {
+        stand_in_listener v6a(IPv6_LOOPBACK_STRING_LITERAL, behavior::REFUSE);
+        stand_in_listener v6b(IPv6_LOOPBACK_STRING_LITERAL, behavior::REFUSE);
+        stand_in_listener v6c(IPv6_LOOPBACK_STRING_LITERAL, behavior::REFUSE);
+        stand_in_listener v4a(IPv4_LOOPBACK_STRING_LITERAL, behavior::REFUSE);
+        stand_in_listener v4b(IPv4_LOOPBACK_STRING_LITERAL, behavior::REFUSE);
+
+        const std::vector<man7_resolver::address> candidates = {v6a.candidate(), v6b.candidate(), v6c.candidate(), v4a.candidate(), v4b.candidate()};
+        assert(man7_happy_eyeballs::order(candidates) == std::vector<size_t>({0, 3, 1, 4, 2}));
+        assert(man7_happy_eyeballs::order(candidates, 2) == std::vector<size_t>({0, 1, 3, 2, 4}));
+
+        const std::vector<man7_resolver::address> v4_first = {v4a.candidate(), v6a.candidate(), v6b.candidate()};
+        assert(man7_happy_eyeballs::order(v4_first) == std::vector<size_t>({0, 1, 2}));
+        assert(man7_happy_eyeballs::order({}).empty());
+    }
+
+    // When the first address answers, it is the only one tried, and the socket that comes
+    // back is connected and blocking.
+    static void test_man7_happy_eyeballs_first_answers()
+    {
+        stand_in_listener v6(IPv6_LOOPBACK_STRING_LITERAL, behavior::ACCEPT);
+        stand_in_listener v4(IPv4_LOOPBACK_STRING_LITERAL, behavior::ACCEPT);
+
+        man7_happy_eyeballs connector(options_with(250));
+        const int fd = connector.connect({v6.candidate(), v4.candidate()});
+        assert(fd != -1);
+        assert(connector.get_winner() == 0);
+        assert(connector.get_num_attempts() == 1);
+        assert((fcntl(fd, F_GETFL) & O_NONBLOCK) == 0);
+
+        const int accepted = v6.accept_one();
+        assert(accepted != -1);
+        const ssize_t w = write(fd, "x", 1);
+        assert(w == 1);
+        char c = 0;
+        const ssize_t r = read(accepted, &c, 1);
+        assert(r == 1 && c == 'x');
+        close(accepted);
+        close(fd);
+    }
+
+    // An address that does not answer costs the attempt delay, not a connect timeout, and
+    // one that refuses costs nothing.
+    static void test_man7_happy_eyeballs_fallback()
+    {
+        {
+            stand_in_listener v6(IPv6_LOOPBACK_STRING_LITERAL, behavior::HANG);
+            stand_in_listener v4(IPv4_LOOPBACK_STRING_LITERAL, behavior::ACCEPT);
+
+            man7_happy_eyeballs connector(options_with(100));
+            const auto start = std::chrono::steady_clock::now();
+            const int fd = connector.connect({v6.candidate(), v4.candidate()});
+            const double elapsed = milliseconds_since(start);
+            assert(fd != -1);
+            assert(connector.get_winner() == 1);
+            assert(connector.get_num_attempts() == 2);
+            assert(elapsed >= 100 && elapsed < 900);
+            close(fd);
+        }
+        {
+            stand_in_listener v6(IPv6_LOOPBACK_STRING_LITERAL, behavior::REFUSE);
+            stand_in_listener v4(IPv4_LOOPBACK_STRING_LITERAL, behavior::ACCEPT);
+
+            man7_happy_eyeballs connector(options_with(5000));
+            const auto start = std::chrono::steady_clock::now();
+            const int fd = connector.connect({v6.candidate(), v4.candidate()});
+            assert(fd != -1);
+            assert(connector.get_winner() == 1);
+            assert(milliseconds_since(start) < 1000);
+            close(fd);
+        }
+    }
+
+    // An attempt carries on after the next has started, and wins if it answers first:
+    // here the first listener is slow, and the second never answers.
+    static void test_man7_happy_eyeballs_slow_listener()
+    {
+        stand_in_listener v6(IPv6_LOOPBACK_STRING_LITERAL, behavior::HANG);
+        stand_in_listener v4(IPv4_LOOPBACK_STRING_LITERAL, behavior::HANG);
+
+        std::thread releaser([&]()
+                             {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            v6.release(); });
+
+        man7_happy_eyeballs connector(options_with(100, 5000));
+        const int fd = connector.connect({v6.candidate(), v4.candidate()});
+        releaser.join();
+        assert(fd != -1);
+        assert(connector.get_winner() == 0);
+        assert(connector.get_num_attempts() == 2);
+        close(fd);
+    }
+
+    // When every attempt fails, the error is the last one's, or ETIMEDOUT for the whole.
+    static void test_man7_happy_eyeballs_failure()
+    {
+        {
+            stand_in_listener v6(IPv6_LOOPBACK_STRING_LITERAL, behavior::REFUSE);
+            stand_in_listener v4(IPv4_LOOPBACK_STRING_LITERAL, behavior::REFUSE);
+
+            man7_happy_eyeballs connector(options_with(250));
+            errno = 0;
+            const int fd = connector.connect({v6.candidate(), v4.candidate()});
+            assert(fd == -1 && errno == ECONNREFUSED);
+            assert(connector.get_winner() == -1);
+            assert(connector.get_num_attempts() == 2);
+        }
+        {
+            stand_in_listener v6(IPv6_LOOPBACK_STRING_LITERAL, behavior::HANG);
+            stand_in_listener v4(IPv4_LOOPBACK_STRING_LITERAL, behavior::HANG);
+
+            man7_happy_eyeballs connector(options_with(100, 300));
+            const auto start = std::chrono::steady_clock::now();
+            errno = 0;
+            const int fd = connector.connect({v6.candidate(), v4.candidate()});
+            const double elapsed = milliseconds_since(start);
+            assert(fd == -1 && errno == ETIMEDOUT);
+            assert(connector.get_num_attempts() == 2);
+            assert(elapsed >= 300 && elapsed < 900);
+        }
+        {
+            man7_happy_eyeballs connector;
+            errno = 0;
+            const int fd = connector.connect({});
+            assert(fd == -1 && errno == EADDRNOTAVAIL);
+        }
+    }
+};
+
+#endif // SANDBOX_MAN7_HAPPY_EYEBALLS_TEST
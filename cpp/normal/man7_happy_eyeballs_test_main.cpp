@@ -0,0 +1,11 @@
+#include "man7_happy_eyeballs_test.hpp"
+
+int main()
+{
+    man7_happy_eyeballs_test::test_man7_happy_eyeballs_order();
+    man7_happy_eyeballs_test::test_man7_happy_eyeballs_first_answers();
+    man7_happy_eyeballs_test::test_man7_happy_eyeballs_fallback();
+    man7_happy_eyeballs_test::test_man7_happy_eyeballs_slow_listener();
+    man7_happy_eyeballs_test::test_man7_happy_eyeballs_failure();
+    return 0;
+}
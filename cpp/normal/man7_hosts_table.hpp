@@ -0,0 +1,259 @@
+#ifndef SANDBOX_CPP_MAN7_HOSTS_TABLE
+#define SANDBOX_CPP_MAN7_HOSTS_TABLE
+
+#include "man7_resolver.hpp"
+
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// A stand-in for name resolution, in the format of /etc/hosts ("address name aliases...",
+// with '#' comments), that answers as getaddrinfo() would from those lines alone: no DNS,
+// no nsswitch.conf, and the same answers on every machine. Each lookup can be made to take
+// `delay`, as a slow name server would, and they are counted. For man7_resolver's
+// `lookup` (see as_lookup()), in tests and benchmarks.
+class man7_hosts_table final
+{
+private:
+    // https://www.man7.org/linux/man-pages/man5/hosts.5.html
+    // https://www.man7.org/linux/man-pages/man3/getaddrinfo.3.html
+
+    class host final
+    {
+    public:
+        int family;
+        sockaddr_storage addr;
+        std::vector<std::string> names;
+    };
+
+    std::vector<host> hosts;
+    std::chrono::milliseconds delay{0};
+    mutable std::atomic<uint64_t> num_lookups{0};
+
+public:
+    man7_hosts_table() = default;
+
+    explicit man7_hosts_table(const std::string &text, std::chrono::milliseconds the_delay = std::chrono::milliseconds(0)) : delay(the_delay)
+    {
+        add_lines(text);
+    }
+
+    man7_hosts_table(const man7_hosts_table &) = delete;
+    man7_hosts_table &operator=(const man7_hosts_table &) = delete;
+
+    // Lines whose address does not parse are skipped. Returns the number of hosts added.
+    size_t add_lines(const std::string &text)
+    {
+        const size_t num_hosts = hosts.size();
+        std::istringstream lines(text);
+        std::string line;
+        while (std::getline(lines, line))
+        {
+            line = line.substr(0, line.find('#'));
+            std::istringstream fields(line);
+            std::string address_str;
+            if (!(fields >> address_str))
+            {
+                continue;
+            }
+
+            host h;
+            memset(&h.addr, 0, sizeof(h.addr));
+            if (inet_pton(AF_INET, address_str.c_str(), &((sockaddr_in *)&h.addr)->sin_addr) == 1)
+            {
+                h.family = AF_INET;
+            }
+            else if (inet_pton(AF_INET6, address_str.c_str(), &((sockaddr_in6 *)&h.addr)->sin6_addr) == 1)
+            {
+                h.family = AF_INET6;
+            }
+            else
+            {
+                continue;
+            }
+            h.addr.ss_family = h.family;
+
+            std::string name;
+            while (fields >> name)
+            {
+                h.names.push_back(name);
+            }
+            if (!h.names.empty())
+            {
+                hosts.push_back(h);
+            }
+        }
+        return hosts.size() - num_hosts;
+    }
+
+    // Like add_lines(), with the lines of the file at `path` (such as "/etc/hosts").
+    // Returns false if it cannot be read.
+    bool add_file(const std::string &path)
+    {
+        std::ifstream file(path);
+        if (!file)
+        {
+            return false;
+        }
+        std::ostringstream text;
+        text << file.rdbuf();
+        add_lines(text.str());
+        return true;
+    }
+
+    void set_delay(std::chrono::milliseconds the_delay)
+    {
+        delay = the_delay;
+    }
+
+    uint64_t get_num_lookups() const
+    {
+        return num_lookups.load(std::memory_order_relaxed);
+    }
+
+    // As getaddrinfo() would answer if these were all the hosts: a numeric `node` stands for
+    // itself, and an empty one for the wildcard address (AI_PASSIVE) or the loopback one.
+    // `service` must be a port number (or empty, for 0). Without a socket type in `hints`,
+    // each address comes once for SOCK_STREAM and once for SOCK_DGRAM.
+    man7_resolver::result lookup(const std::string &node, const std::string &service, const addrinfo &hints) const
+    {
+        num_lookups.fetch_add(1, std::memory_order_relaxed);
+        if (delay.count() > 0)
+        {
+            std::this_thread::sleep_for(delay);
+        }
+
+        man7_resolver::result r;
+        if (hints.ai_family != AF_UNSPEC && hints.ai_family != AF_INET && hints.ai_family != AF_INET6)
+        {
+            r.error = EAI_FAMILY;
+            return r;
+        }
+
+        in_port_t port = 0;
+        if (!service.empty())
+        {
+            char *end = nullptr;
+            const unsigned long n = strtoul(service.c_str(), &end, 10);
+            if (*end != '\0' || n > 65535)
+            {
+                r.error = EAI_SERVICE;
+                return r;
+            }
+            port = htons(static_cast<in_port_t>(n));
+        }
+
+        std::vector<const host *> matches;
+        host numeric[2];
+        for (host &h : numeric)
+        {
+            memset(&h.addr, 0, sizeof(h.addr));
+        }
+        if (node.empty())
+        {
+            numeric[0].family = AF_INET6;
+            numeric[1].family = AF_INET;
+            for (host &h : numeric)
+            {
+                h.addr.ss_family = h.family;
+            }
+            if (!(hints.ai_flags & AI_PASSIVE))
+            {
+                ((sockaddr_in6 *)&numeric[0].addr)->sin6_addr = in6addr_loopback;
+                ((sockaddr_in *)&numeric[1].addr)->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            }
+            matches = {&numeric[0], &numeric[1]};
+        }
+        else if (inet_pton(AF_INET, node.c_str(), &((sockaddr_in *)&numeric[0].addr)->sin_addr) == 1)
+        {
+            numeric[0].family = AF_INET;
+            numeric[0].addr.ss_family = AF_INET;
+            matches = {&numeric[0]};
+        }
+        else if (inet_pton(AF_INET6, node.c_str(), &((sockaddr_in6 *)&numeric[0].addr)->sin6_addr) == 1)
+        {
+            numeric[0].family = AF_INET6;
+            numeric[0].addr.ss_family = AF_INET6;
+            matches = {&numeric[0]};
+        }
+        else if (hints.ai_flags & AI_NUMERICHOST)
+        {
+            r.error = EAI_NONAME;
+            return r;
+        }
+        else
+        {
+            for (const host &h : hosts)
+            {
+                for (const std::string &name : h.names)
+                {
+                    if (strcasecmp(name.c_str(), node.c_str()) == 0)
+                    {
+                        matches.push_back(&h);
+                        break;
+                    }
+                }
+            }
+        }
+
+        std::vector<int> socktypes = {SOCK_STREAM, SOCK_DGRAM};
+        if (hints.ai_socktype != 0)
+        {
+            socktypes = {hints.ai_socktype};
+        }
+        for (const host *h : matches)
+        {
+            if (hints.ai_family != AF_UNSPEC && hints.ai_family != h->family)
+            {
+                continue;
+            }
+            for (const int socktype : socktypes)
+            {
+                man7_resolver::address a;
+                a.family = h->family;
+                a.socktype = socktype;
+                a.protocol = (hints.ai_protocol != 0) ? hints.ai_protocol : ((socktype == SOCK_DGRAM) ? IPPROTO_UDP : IPPROTO_TCP);
+                a.addr = h->addr;
+                if (h->family == AF_INET)
+                {
+                    ((sockaddr_in *)&a.addr)->sin_port = port;
+                    a.addrlen = sizeof(sockaddr_in);
+                }
+                else
+                {
+                    ((sockaddr_in6 *)&a.addr)->sin6_port = port;
+                    a.addrlen = sizeof(sockaddr_in6);
+                }
+                r.addresses.push_back(a);
+            }
+        }
+        if (r.addresses.empty())
+        {
+            r.error = EAI_NONAME;
+        }
+        return r;
+    }
+
+    // For man7_resolver::options::lookup. The table must outlive the resolver.
+    man7_resolver::lookup_function as_lookup() const
+    {
+        return [this](const std::string &node, const std::string &service, const addrinfo &hints)
+        {
+            return lookup(node, service, hints);
+        };
+    }
+};
+
+#endif // SANDBOX_CPP_MAN7_HOSTS_TABLE
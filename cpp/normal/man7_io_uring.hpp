@@ -0,0 +1,394 @@
+#ifndef SANDBOX_CPP_MAN7_IO_URING
+#define SANDBOX_CPP_MAN7_IO_URING
+
+#include <linux/io_uring.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+// An io_uring instance, set up and driven with the raw system calls (there is no liburing
+// here): a submission queue of SQEs that the kernel takes in one io_uring_enter() call, and
+// a completion queue of CQEs that is read without any system call at all.
+//
+// Only what the forwarder and the UDP echo server need is here: getting and preparing SQEs,
+// submitting them while waiting (with a timeout) for completions, going through the CQEs,
+// and rings of provided buffers, from which the kernel picks a buffer for a receive only
+// when data arrives. io_uring_enter() calls are counted, so that callers can tell how many
+// system calls their I/O took.
+class man7_io_uring final
+{
+private:
+    // https://www.man7.org/linux/man-pages/man7/io_uring.7.html
+    // https://www.man7.org/linux/man-pages/man2/io_uring_setup.2.html
+    // https://www.man7.org/linux/man-pages/man2/io_uring_enter.2.html
+    // https://www.man7.org/linux/man-pages/man2/io_uring_register.2.html
+    // https://www.man7.org/linux/man-pages/man3/io_uring_register_buf_ring.3.html
+    // https://kernel.dk/io_uring.pdf
+
+    int ring_fd = -1;
+    io_uring_params params;
+
+    void *sq_ring = MAP_FAILED;
+    void *cq_ring = MAP_FAILED;
+    size_t sq_ring_size = 0;
+    size_t cq_ring_size = 0;
+
+    io_uring_sqe *sqes = static_cast<io_uring_sqe *>(MAP_FAILED);
+    size_t sqes_size = 0;
+
+    // Shared with the kernel
+    unsigned *sq_head = nullptr;
+    unsigned *sq_tail = nullptr;
+    unsigned *sq_mask = nullptr;
+    unsigned *cq_head = nullptr;
+    unsigned *cq_tail = nullptr;
+    unsigned *cq_mask = nullptr;
+    io_uring_cqe *cqes = nullptr;
+
+    // The tail past the SQEs handed out by get_sqe(), and how many of those have not been
+    // submitted yet.
+    unsigned local_sq_tail = 0;
+    unsigned num_unsubmitted = 0;
+
+    uint64_t num_enters = 0;
+
+public:
+    // A ring of equally sized buffers that receives (with IOSQE_BUFFER_SELECT) take from.
+    // The buffer that a receive took is named in its CQE, and stays the caller's until it
+    // is given back with put_back().
+    class buffer_ring final
+    {
+    private:
+        io_uring_buf_ring *ring = static_cast<io_uring_buf_ring *>(MAP_FAILED);
+        size_t ring_size = 0;
+        unsigned num_buffers = 0;
+        unsigned short local_tail = 0;
+        std::vector<char> storage;
+
+    public:
+        size_t buffer_size = 0;
+        unsigned short group_id = 0;
+
+        buffer_ring() = default;
+        buffer_ring(const buffer_ring &) = delete;
+        buffer_ring &operator=(const buffer_ring &) = delete;
+
+        ~buffer_ring()
+        {
+            if (ring != MAP_FAILED)
+            {
+                munmap(ring, ring_size);
+            }
+        }
+
+        // Returns 0, or -1 with errno set. `the_num_buffers` must be a power of 2, up to
+        // 32768. The ring is unregistered when `uring` is closed.
+        int setup(man7_io_uring &uring, unsigned short the_group_id, unsigned the_num_buffers, size_t the_buffer_size)
+        {
+            ring_size = the_num_buffers * sizeof(io_uring_buf);
+            ring = static_cast<io_uring_buf_ring *>(mmap(NULL, ring_size, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0));
+            if (ring == MAP_FAILED)
+            {
+                return -1;
+            }
+
+            io_uring_buf_reg reg;
+            memset(&reg, 0, sizeof(reg));
+            reg.ring_addr = reinterpret_cast<uint64_t>(ring);
+            reg.ring_entries = the_num_buffers;
+            reg.bgid = the_group_id;
+            if (uring.register_resource(IORING_REGISTER_PBUF_RING, &reg, 1) == -1)
+            {
+                return -1;
+            }
+
+            group_id = the_group_id;
+            num_buffers = the_num_buffers;
+            buffer_size = the_buffer_size;
+            storage.resize(num_buffers * buffer_size);
+            for (unsigned i = 0; i < num_buffers; i++)
+            {
+                add(static_cast<unsigned short>(i));
+            }
+            publish();
+            return 0;
+        }
+
+        char *get_buffer(unsigned short buffer_id)
+        {
+            return storage.data() + buffer_id * buffer_size;
+        }
+
+        // Give the buffer back to the kernel.
+        void put_back(unsigned short buffer_id)
+        {
+            add(buffer_id);
+            publish();
+        }
+
+        // The buffer named in a CQE of a receive that took one (IORING_CQE_F_BUFFER)
+        static unsigned short buffer_id_of(const io_uring_cqe &cqe)
+        {
+            return static_cast<unsigned short>(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+        }
+
+    private:
+        void add(unsigned short buffer_id)
+        {
+            // Not `ring->bufs`: in C++, the empty struct in front of that flexible array
+            // takes up room, and moves it.
+            io_uring_buf &b = reinterpret_cast<io_uring_buf *>(ring)[local_tail & (num_buffers - 1)];
+            b.addr = reinterpret_cast<uint64_t>(get_buffer(buffer_id));
+            b.len = static_cast<uint32_t>(buffer_size);
+            b.bid = buffer_id;
+            local_tail++;
+        }
+
+        void publish()
+        {
+            __atomic_store_n(&ring->tail, local_tail, __ATOMIC_RELEASE);
+        }
+    };
+
+public:
+    man7_io_uring()
+    {
+        memset(&params, 0, sizeof(params));
+    }
+
+    man7_io_uring(const man7_io_uring &) = delete;
+    man7_io_uring &operator=(const man7_io_uring &) = delete;
+
+    ~man7_io_uring()
+    {
+        close_ring();
+    }
+
+    // Closing the ring cancels whatever is still in flight.
+    void close_ring()
+    {
+        if (sqes != MAP_FAILED)
+        {
+            munmap(sqes, sqes_size);
+            sqes = static_cast<io_uring_sqe *>(MAP_FAILED);
+        }
+        if (cq_ring != MAP_FAILED && cq_ring != sq_ring)
+        {
+            munmap(cq_ring, cq_ring_size);
+        }
+        cq_ring = MAP_FAILED;
+        if (sq_ring != MAP_FAILED)
+        {
+            munmap(sq_ring, sq_ring_size);
+            sq_ring = MAP_FAILED;
+        }
+        if (ring_fd != -1)
+        {
+            close(ring_fd);
+            ring_fd = -1;
+        }
+    }
+
+    // Returns 0, or -1 with errno set: ENOSYS if the kernel has no io_uring, EPERM if it is
+    // turned off (/proc/sys/kernel/io_uring_disabled), ENOTSUP if the kernel lacks a feature
+    // used here.
+    int init(unsigned num_entries)
+    {
+        memset(&params, 0, sizeof(params));
+        const long fd = syscall(__NR_io_uring_setup, num_entries, &params);
+        if (fd == -1)
+        {
+            return -1;
+        }
+        ring_fd = static_cast<int>(fd);
+
+        // Waiting with a timeout, and polling sockets inside the kernel instead of in a
+        // worker thread
+        const unsigned needed = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_FAST_POLL | IORING_FEAT_EXT_ARG;
+        if ((params.features & needed) != needed)
+        {
+            close_ring();
+            errno = ENOTSUP;
+            return -1;
+        }
+
+        sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        sq_ring_size = (cq_ring_size > sq_ring_size) ? cq_ring_size : sq_ring_size;
+        sq_ring = mmap(NULL, sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQ_RING);
+        if (sq_ring == MAP_FAILED)
+        {
+            const int errnum = errno;
+            close_ring();
+            errno = errnum;
+            return -1;
+        }
+        // IORING_FEAT_SINGLE_MMAP: one mapping holds both rings.
+        cq_ring = sq_ring;
+
+        sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+        sqes = static_cast<io_uring_sqe *>(mmap(NULL, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQES));
+        if (sqes == MAP_FAILED)
+        {
+            const int errnum = errno;
+            close_ring();
+            errno = errnum;
+            return -1;
+        }
+
+        char *const sq = static_cast<char *>(sq_ring);
+        char *const cq = static_cast<char *>(cq_ring);
+        sq_head = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+        sq_tail = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+        sq_mask = reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+        cq_head = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+        cq_tail = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+        cq_mask = reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+        cqes = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+
+        // SQE `i` always sits in slot `i` of the indirection array.
+        unsigned *const array = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+        for (unsigned i = 0; i < params.sq_entries; i++)
+        {
+            array[i] = i;
+        }
+        local_sq_tail = *sq_tail;
+        return 0;
+    }
+
+    // Whether this kernel can run what is here: io_uring itself, the features that init()
+    // checks, and rings of provided buffers (which came with multishot accept, in 5.19).
+    static bool is_supported()
+    {
+        man7_io_uring uring;
+        if (uring.init(2) == -1)
+        {
+            return false;
+        }
+        buffer_ring ring;
+        return ring.setup(uring, 0, 1, 1) == 0;
+    }
+
+    // https://www.man7.org/linux/man-pages/man2/io_uring_register.2.html
+    // Returns 0 (or more), or -1 with errno set.
+    int register_resource(unsigned opcode, void *arg, unsigned num_args)
+    {
+        return static_cast<int>(syscall(__NR_io_uring_register, ring_fd, opcode, arg, num_args));
+    }
+
+    // A zeroed SQE to prepare, or nullptr if the submission queue is full (see make_room()).
+    io_uring_sqe *get_sqe()
+    {
+        const unsigned head = __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+        if (local_sq_tail - head >= params.sq_entries)
+        {
+            return nullptr;
+        }
+        io_uring_sqe *const sqe = &sqes[local_sq_tail & *sq_mask];
+        local_sq_tail++;
+        num_unsubmitted++;
+        memset(sqe, 0, sizeof(*sqe));
+        return sqe;
+    }
+
+    // Make sure that the next `num_sqes` calls of get_sqe() succeed, by submitting what is
+    // queued if there is not enough room left. SQEs that are linked together must go in the
+    // same submission. Returns false only if the submission fails.
+    bool make_room(unsigned num_sqes)
+    {
+        const unsigned head = __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+        return params.sq_entries - (local_sq_tail - head) >= num_sqes || submit_and_wait(0) != -1;
+    }
+
+    static void prepare(io_uring_sqe *sqe, uint8_t opcode, int fd, const void *addr, uint32_t len, uint64_t user_data)
+    {
+        sqe->opcode = opcode;
+        sqe->fd = fd;
+        sqe->addr = reinterpret_cast<uint64_t>(addr);
+        sqe->len = len;
+        sqe->user_data = user_data;
+    }
+
+    // Submit the prepared SQEs, and wait for at least `num_to_wait_for` CQEs, or until
+    // `timeout_ms` milliseconds pass (-1 for no limit). Returns the number of SQEs
+    // submitted, or -1 with errno set: ETIME if the time ran out, EINTR if a signal came.
+    //
+    // io_uring_enter() itself returns the number submitted whenever that is not zero, even
+    // if the wait after it timed out or was interrupted. So with a timeout, fewer CQEs than
+    // were waited for means one or the other (told apart by the time that passed), and is
+    // reported as such, though the SQEs did go. When io_uring_enter() fails, it submitted
+    // nothing, and what was prepared is submitted by the next call.
+    int submit_and_wait(unsigned num_to_wait_for, int timeout_ms = -1)
+    {
+        __atomic_store_n(sq_tail, local_sq_tail, __ATOMIC_RELEASE);
+
+        unsigned flags = (num_to_wait_for > 0) ? IORING_ENTER_GETEVENTS : 0;
+        __kernel_timespec ts;
+        io_uring_getevents_arg arg;
+        memset(&arg, 0, sizeof(arg));
+        const bool timed = (timeout_ms >= 0 && num_to_wait_for > 0);
+        if (timed)
+        {
+            ts.tv_sec = timeout_ms / 1000;
+            ts.tv_nsec = (timeout_ms % 1000) * 1000000LL;
+            arg.ts = reinterpret_cast<uint64_t>(&ts);
+            flags |= IORING_ENTER_EXT_ARG;
+        }
+
+        const std::chrono::steady_clock::time_point start = timed ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+        num_enters++;
+        const long ret = syscall(__NR_io_uring_enter, ring_fd, num_unsubmitted, num_to_wait_for, flags, (flags & IORING_ENTER_EXT_ARG) ? &arg : NULL, sizeof(arg));
+        if (ret < 0)
+        {
+            return -1;
+        }
+        num_unsubmitted -= static_cast<unsigned>(ret);
+
+        if (timed && get_num_cqes_ready() < num_to_wait_for)
+        {
+            errno = (std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(timeout_ms)) ? ETIME : EINTR;
+            return -1;
+        }
+        return static_cast<int>(ret);
+    }
+
+    // The number of CQEs waiting to be gone through
+    unsigned get_num_cqes_ready() const
+    {
+        return __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE) - *cq_head;
+    }
+
+    // Call `f(cqe)` for each CQE there is, oldest first, without any system call. Returns
+    // how many there were.
+    template <typename F>
+    unsigned for_each_cqe(F f)
+    {
+        unsigned head = *cq_head;
+        const unsigned tail = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+        const unsigned num_cqes = tail - head;
+        for (; head != tail; head++)
+        {
+            const io_uring_cqe cqe = cqes[head & *cq_mask];
+
+            // Give the slot back before `f` runs: `f` may submit more.
+            __atomic_store_n(cq_head, head + 1, __ATOMIC_RELEASE);
+            f(cqe);
+        }
+        return num_cqes;
+    }
+
+    // The number of io_uring_enter() calls so far
+    uint64_t get_num_enters() const
+    {
+        return num_enters;
+    }
+};
+
+#endif // SANDBOX_CPP_MAN7_IO_URING
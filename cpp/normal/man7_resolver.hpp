@@ -0,0 +1,446 @@
+#ifndef SANDBOX_CPP_MAN7_RESOLVER
+#define SANDBOX_CPP_MAN7_RESOLVER
+
+#include "man7_gnu_source.hpp"
+
+#include <netdb.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Name resolution over getaddrinfo() (or any other lookup with the same shape, such as
+// man7_hosts_table), with a cache of the results and lookups that run on a few threads
+// of its own:
+//
+// - A result is kept for `ttl` (a failure for `negative_ttl`), and served from memory
+//   until then. getaddrinfo() does not pass on the TTL of DNS records, so the TTL is the
+//   resolver's own. Failures that may go away on their own (EAI_AGAIN, EAI_MEMORY,
+//   EAI_SYSTEM) are not kept at all.
+// - Asking for a name that is being looked up already waits for that lookup, instead of
+//   starting another (coalescing), so a burst of connections to one host costs one lookup.
+// - resolve_async() returns a future straight away; resolve() waits, and looks up on the
+//   calling thread itself when it must.
+//
+// The threads start with the first resolve_async(), and are not carried across fork().
+class man7_resolver final
+{
+private:
+    // https://www.man7.org/linux/man-pages/man3/getaddrinfo.3.html
+    // https://en.cppreference.com/w/cpp/thread/shared_future
+    // https://en.cppreference.com/w/cpp/thread/condition_variable
+
+public:
+    // One entry of getaddrinfo()'s list, copied out of it
+    class address final
+    {
+    public:
+        int family = AF_UNSPEC;
+        int socktype = 0;
+        int protocol = 0;
+        sockaddr_storage addr;
+        socklen_t addrlen = 0;
+    };
+
+    class result final
+    {
+    public:
+        // 0, or what getaddrinfo() returned (EAI_NONAME, ...)
+        int error = 0;
+
+        // errno, for EAI_SYSTEM
+        int errnum = 0;
+
+        std::vector<address> addresses;
+    };
+
+    using result_ptr = std::shared_ptr<const result>;
+    using lookup_future = std::shared_future<result_ptr>;
+
+    // Look up `node` (empty for none) and `service` (empty for none), as getaddrinfo()
+    // does with `hints`. Called on any thread, and on more than one at once.
+    using lookup_function = std::function<result(const std::string &node, const std::string &service, const addrinfo &hints)>;
+
+    class options final
+    {
+    public:
+        std::chrono::milliseconds ttl{30000};
+        std::chrono::milliseconds negative_ttl{5000};
+
+        // The most results kept. To make room, those that have expired go first, and then
+        // the one that would expire soonest.
+        size_t max_entries = 1024;
+
+        // For resolve_async()
+        unsigned num_threads = 4;
+
+        // Empty means lookup_with_getaddrinfo().
+        lookup_function lookup;
+    };
+
+private:
+    class cache_entry final
+    {
+    public:
+        result_ptr value;
+        std::chrono::steady_clock::time_point expiry;
+    };
+
+    options opts;
+
+    std::mutex mutex;
+    std::unordered_map<std::string, cache_entry> cache;
+    std::unordered_map<std::string, lookup_future> in_flight;
+
+    std::vector<std::thread> threads;
+    std::deque<std::function<void()>> tasks;
+    std::condition_variable tasks_changed;
+    bool stopping = false;
+
+    std::atomic<uint64_t> num_requests{0};
+    std::atomic<uint64_t> num_hits{0};
+    std::atomic<uint64_t> num_coalesced{0};
+    std::atomic<uint64_t> num_lookups{0};
+
+public:
+    man7_resolver() : man7_resolver(options())
+    {
+    }
+
+    explicit man7_resolver(const options &the_options) : opts(the_options)
+    {
+        if (!opts.lookup)
+        {
+            opts.lookup = lookup_with_getaddrinfo;
+        }
+    }
+
+    man7_resolver(const man7_resolver &) = delete;
+    man7_resolver &operator=(const man7_resolver &) = delete;
+
+    // Lookups that have not started are abandoned: their futures get
+    // std::future_error (broken_promise).
+    ~man7_resolver()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        tasks_changed.notify_all();
+        for (auto &&thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    // The resolver for those who do not need one of their own
+    static man7_resolver &get_default()
+    {
+        static man7_resolver resolver;
+        return resolver;
+    }
+
+    // The result for `node` and `service`, from the cache, from a lookup already in flight,
+    // or from a lookup on one of the resolver's threads. Never null. May throw
+    // std::system_error, if a thread cannot be started.
+    lookup_future resolve_async(const std::string &node, const std::string &service, const addrinfo *hints = nullptr)
+    {
+        const addrinfo h = hints_or_default(hints);
+        const std::string key = key_of(node, service, h);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        lookup_future f;
+        if (find(key, f))
+        {
+            return f;
+        }
+
+        // Queue the lookup before letting others wait for it: if starting a thread or queueing
+        // throws, nothing is left in flight that would never complete.
+        std::shared_ptr<std::promise<result_ptr>> p = std::make_shared<std::promise<result_ptr>>();
+        f = p->get_future().share();
+        start_threads();
+        tasks.emplace_back([this, key, node, service, h, p]()
+                           {
+            try
+            {
+                p->set_value(complete(key, look_up(node, service, h)));
+            }
+            catch (...)
+            {
+                abandon(key);
+                p->set_exception(std::current_exception());
+            } });
+        in_flight.emplace(key, f);
+        lock.unlock();
+        tasks_changed.notify_one();
+        return f;
+    }
+
+    // Like resolve_async(), but waits for the result. Never null. Throws what the lookup
+    // function throws, and so does the future of resolve_async().
+    result_ptr resolve(const std::string &node, const std::string &service, const addrinfo *hints = nullptr)
+    {
+        const addrinfo h = hints_or_default(hints);
+        const std::string key = key_of(node, service, h);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        lookup_future f;
+        if (find(key, f))
+        {
+            lock.unlock();
+            return f.get();
+        }
+
+        // Look up here rather than hand it to a thread and wait, but let others wait for it.
+        std::promise<result_ptr> p;
+        in_flight.emplace(key, p.get_future().share());
+        lock.unlock();
+
+        try
+        {
+            const result_ptr r = complete(key, look_up(node, service, h));
+            p.set_value(r);
+            return r;
+        }
+        catch (...)
+        {
+            abandon(key);
+            p.set_exception(std::current_exception());
+            throw;
+        }
+    }
+
+    // Forget every result, so that the next request for each looks it up again.
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        cache.clear();
+    }
+
+    uint64_t get_num_requests() const
+    {
+        return num_requests.load(std::memory_order_relaxed);
+    }
+
+    // Requests answered from the cache
+    uint64_t get_num_hits() const
+    {
+        return num_hits.load(std::memory_order_relaxed);
+    }
+
+    // Requests that waited for a lookup that another had started
+    uint64_t get_num_coalesced() const
+    {
+        return num_coalesced.load(std::memory_order_relaxed);
+    }
+
+    // Calls to the lookup function
+    uint64_t get_num_lookups() const
+    {
+        return num_lookups.load(std::memory_order_relaxed);
+    }
+
+    // https://www.man7.org/linux/man-pages/man3/getaddrinfo.3.html
+    // getaddrinfo(), with its list copied into a result and freed.
+    static result lookup_with_getaddrinfo(const std::string &node, const std::string &service, const addrinfo &hints)
+    {
+        result r;
+        addrinfo *list = NULL;
+
+        errno = 0;
+        r.error = getaddrinfo(node.empty() ? NULL : node.c_str(), service.empty() ? NULL : service.c_str(), &hints, &list);
+        r.errnum = errno;
+        if (r.error != 0)
+        {
+            return r;
+        }
+
+        for (addrinfo *ai = list; ai; ai = ai->ai_next)
+        {
+            address a;
+            a.family = ai->ai_family;
+            a.socktype = ai->ai_socktype;
+            a.protocol = ai->ai_protocol;
+            memset(&a.addr, 0, sizeof(a.addr));
+            a.addrlen = (ai->ai_addrlen <= sizeof(a.addr)) ? ai->ai_addrlen : sizeof(a.addr);
+            memcpy(&a.addr, ai->ai_addr, a.addrlen);
+            r.addresses.push_back(a);
+        }
+        freeaddrinfo(list);
+        r.errnum = 0;
+        return r;
+    }
+
+private:
+    // As getaddrinfo() takes a NULL `hints`
+    static addrinfo hints_or_default(const addrinfo *hints)
+    {
+        addrinfo h;
+        memset(&h, 0, sizeof(h));
+        if (hints)
+        {
+            h.ai_flags = hints->ai_flags;
+            h.ai_family = hints->ai_family;
+            h.ai_socktype = hints->ai_socktype;
+            h.ai_protocol = hints->ai_protocol;
+        }
+        else
+        {
+            h.ai_flags = AI_V4MAPPED | AI_ADDRCONFIG;
+        }
+        return h;
+    }
+
+    static std::string key_of(const std::string &node, const std::string &service, const addrinfo &h)
+    {
+        std::string key(node);
+        key += '\0';
+        key += service;
+        for (const int field : {h.ai_flags, h.ai_family, h.ai_socktype, h.ai_protocol})
+        {
+            key += '\0';
+            key += std::to_string(field);
+        }
+        return key;
+    }
+
+    // With `mutex` held: a future for the cached result, or for the lookup in flight.
+    bool find(const std::string &key, lookup_future &f)
+    {
+        num_requests.fetch_add(1, std::memory_order_relaxed);
+
+        const auto cached = cache.find(key);
+        if (cached != cache.end())
+        {
+            if (std::chrono::steady_clock::now() < cached->second.expiry)
+            {
+                num_hits.fetch_add(1, std::memory_order_relaxed);
+                std::promise<result_ptr> p;
+                p.set_value(cached->second.value);
+                f = p.get_future().share();
+                return true;
+            }
+            cache.erase(cached);
+        }
+
+        const auto flying = in_flight.find(key);
+        if (flying != in_flight.end())
+        {
+            num_coalesced.fetch_add(1, std::memory_order_relaxed);
+            f = flying->second;
+            return true;
+        }
+        return false;
+    }
+
+    result look_up(const std::string &node, const std::string &service, const addrinfo &h)
+    {
+        num_lookups.fetch_add(1, std::memory_order_relaxed);
+        return opts.lookup(node, service, h);
+    }
+
+    // Keep `r` for as long as it may be, and let the next request for `key` find it there
+    // rather than in flight.
+    result_ptr complete(const std::string &key, result r)
+    {
+        const result_ptr value = std::make_shared<const result>(std::move(r));
+
+        std::chrono::milliseconds ttl = (value->error == 0) ? opts.ttl : opts.negative_ttl;
+        if (value->error == EAI_AGAIN || value->error == EAI_MEMORY || value->error == EAI_SYSTEM)
+        {
+            ttl = std::chrono::milliseconds(0);
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        in_flight.erase(key);
+        if (ttl.count() > 0 && opts.max_entries > 0)
+        {
+            const auto now = std::chrono::steady_clock::now();
+            if (cache.size() >= opts.max_entries)
+            {
+                make_room(now);
+            }
+            cache_entry &entry = cache[key];
+            entry.value = value;
+            entry.expiry = now + ttl;
+        }
+        return value;
+    }
+
+    // The lookup for `key` threw (std::bad_alloc, or anything from a lookup function other
+    // than getaddrinfo()'s): nothing is kept, and the next request looks up again.
+    void abandon(const std::string &key)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        in_flight.erase(key);
+    }
+
+    // With `mutex` held: drop what has expired, or else what expires first.
+    void make_room(std::chrono::steady_clock::time_point now)
+    {
+        auto first_to_expire = cache.end();
+        for (auto it = cache.begin(); it != cache.end();)
+        {
+            if (it->second.expiry <= now)
+            {
+                it = cache.erase(it);
+                continue;
+            }
+            if (first_to_expire == cache.end() || it->second.expiry < first_to_expire->second.expiry)
+            {
+                first_to_expire = it;
+            }
+            ++it;
+        }
+        if (cache.size() >= opts.max_entries && first_to_expire != cache.end())
+        {
+            cache.erase(first_to_expire);
+        }
+    }
+
+    // With `mutex` held
+    void start_threads()
+    {
+        const unsigned num_threads = (opts.num_threads == 0) ? 1 : opts.num_threads;
+        while (threads.size() < num_threads)
+        {
+            threads.emplace_back(&man7_resolver::work, this);
+        }
+    }
+
+    void work()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;)
+        {
+            tasks_changed.wait(lock, [this]()
+                               { return stopping || !tasks.empty(); });
+            if (stopping)
+            {
+                return;
+            }
+            std::function<void()> task = std::move(tasks.front());
+            tasks.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+};
+
+#endif // SANDBOX_CPP_MAN7_RESOLVER
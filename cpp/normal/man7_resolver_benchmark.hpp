@@ -0,0 +1,141 @@
+#ifndef SANDBOX_MAN7_RESOLVER_BENCHMARK
+#define SANDBOX_MAN7_RESOLVER_BENCHMARK
+
+#include "man7_resolver.hpp"
+#include "man7_hosts_table.hpp"
+
+#include <netdb.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cassert>
+
+class man7_resolver_benchmark
+{
+private:
+    // https://en.cppreference.com/w/cpp/chrono/steady_clock
+    // https://en.cppreference.com/w/cpp/chrono/duration/duration_cast
+    template <typename F>
+    static double seconds_taken(F f)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count();
+    }
+
+    // The `percent`th percentile of `latencies`, which it sorts
+    static double percentile(std::vector<double> &latencies, int percent)
+    {
+        std::sort(latencies.begin(), latencies.end());
+        return latencies[latencies.size() * percent / 100];
+    }
+
+    static void print_row(const std::string &mode, uint64_t num_lookups, std::vector<double> &latencies)
+    {
+        std::cout << mode << '\t' << latencies.size() << '\t' << num_lookups << '\t' << percentile(latencies, 50) * 1e6 << '\t' << percentile(latencies, 99) * 1e6 << '\n';
+    }
+
+    static addrinfo datagram_hints()
+    {
+        addrinfo hints;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_DGRAM;
+        return hints;
+    }
+
+    // `num_callers` threads at once, each resolving `num_requests_each` times through
+    // `resolver`, round robin over `num_names` names ("host0", "host1", ...), starting
+    // each at its own name. Returns the latency of every request.
+    static std::vector<double> resolve_concurrently(man7_resolver &resolver, int num_callers, int num_requests_each, int num_names)
+    {
+        const addrinfo hints = datagram_hints();
+        std::vector<std::vector<double>> per_caller(num_callers);
+        std::vector<std::thread> callers;
+        for (int c = 0; c < num_callers; c++)
+        {
+            callers.emplace_back([&, c]()
+                                 {
+                for (int i = 0; i < num_requests_each; i++)
+                {
+                    const std::string name = "host" + std::to_string((c + i) % num_names);
+                    per_caller[c].push_back(seconds_taken([&]()
+                                                          { resolver.resolve_async(name, "4097", &hints).get(); }));
+                } });
+        }
+        for (auto &&caller : callers)
+        {
+            caller.join();
+        }
+
+        std::vector<double> latencies;
+        for (auto &&l : per_caller)
+        {
+            latencies.insert(latencies.end(), l.begin(), l.end());
+        }
+        return latencies;
+    }
+
+public:
+    // Latency of a name lookup, at the 50th and 99th percentiles, in microseconds:
+    // - getaddrinfo() of "localhost" (from /etc/hosts, through nsswitch.conf), and
+    //   man7_resolver over it when every request misses (a TTL of 0) and when they hit.
+    // - A name server that takes 1 ms (man7_hosts_table with a delay), asked by 8 threads
+    //   at once for 4 names: without a cache, coalescing saves most lookups, and with
+    //   one, all but the first for each name.
+    static void benchmark_resolver()
+    {
+        const int num_requests = 2000;
+        const addrinfo hints = datagram_hints();
+
+        std::cout << "mode\trequests\tlookups\tp50_us\tp99_us\n";
+        {
+            std::vector<double> latencies;
+            for (int i = 0; i < num_requests; i++)
+            {
+                latencies.push_back(seconds_taken([&]()
+                                                  {
+                    addrinfo *list = NULL;
+                    const int getaddrinfo_result = getaddrinfo("localhost", "4097", &hints, &list);
+                    assert(getaddrinfo_result == 0);
+                    freeaddrinfo(list); }));
+            }
+            print_row("getaddrinfo", num_requests, latencies);
+        }
+
+        for (const bool cached : {false, true})
+        {
+            man7_resolver::options o;
+            o.ttl = std::chrono::milliseconds(cached ? 30000 : 0);
+            man7_resolver resolver(o);
+            std::vector<double> latencies;
+            for (int i = 0; i < num_requests; i++)
+            {
+                latencies.push_back(seconds_taken([&]()
+                                                  {
+                    const man7_resolver::result_ptr r = resolver.resolve("localhost", "4097", &hints);
+                    assert(r->error == 0); }));
+            }
+            print_row(cached ? "resolver_hit" : "resolver_miss", resolver.get_num_lookups(), latencies);
+        }
+
+        man7_hosts_table table("10.0.0.1 host0\n10.0.0.2 host1\n10.0.0.3 host2\n10.0.0.4 host3\n", std::chrono::milliseconds(1));
+        for (const bool cached : {false, true})
+        {
+            man7_resolver::options o;
+            o.ttl = std::chrono::milliseconds(cached ? 30000 : 0);
+            o.lookup = table.as_lookup();
+            man7_resolver resolver(o);
+            std::vector<double> latencies = resolve_concurrently(resolver, 8, 250, 4);
+            print_row(cached ? "slow_server_8_callers_cached" : "slow_server_8_callers_coalesced", resolver.get_num_lookups(), latencies);
+        }
+    }
+};
+
+#endif // SANDBOX_MAN7_RESOLVER_BENCHMARK
@@ -0,0 +1,7 @@
+#include "man7_resolver_benchmark.hpp"
+
+int main()
+{
+    man7_resolver_benchmark::benchmark_resolver();
+    return 0;
+}
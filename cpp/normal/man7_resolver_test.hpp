@@ -0,0 +1,267 @@
+#ifndef SANDBOX_MAN7_RESOLVER_TEST
+#define SANDBOX_MAN7_RESOLVER_TEST
+
+#include "man7_resolver.hpp"
+#include "man7_hosts_table.hpp"
+#include "man7_connection.hpp"
+#include "cpp_ip_loopback.hpp"
+
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cassert>
+
+class man7_resolver_test
+{
+private:
+    static const char *hosts_text()
+    {
+        return "# A comment, and a blank line\n"
+               "\n"
+               "10.0.0.1      alpha alpha.example   # Trailing comment\n"
+               "fd00::1       alpha\n"
+               "10.0.0.2      beta\n"
+               "not-an-address gamma\n";
+    }
+
+    static addrinfo stream_hints(int family = AF_UNSPEC)
+    {
+        addrinfo hints;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = family;
+        hints.ai_socktype = SOCK_STREAM;
+        return hints;
+    }
+
+    static std::string address_string(const man7_resolver::address &a)
+    {
+        char s[INET6_ADDRSTRLEN];
+        const void *src = (a.family == AF_INET) ? (const void *)&((const sockaddr_in *)&a.addr)->sin_addr : (const void *)&((const sockaddr_in6 *)&a.addr)->sin6_addr;
+        inet_ntop(a.family, src, s, sizeof(s));
+        const in_port_t port = (a.family == AF_INET) ? ((const sockaddr_in *)&a.addr)->sin_port : ((const sockaddr_in6 *)&a.addr)->sin6_port;
+        return std::string(s) + " " + std::to_string(ntohs(port));
+    }
+
+public:
+    // The stand-in answers as getaddrinfo() would from its lines alone.
+    static void test_man7_hosts_table()
+    {
+        man7_hosts_table table(hosts_text());
+        const addrinfo hints = stream_hints();
+
+        man7_resolver::result r = table.lookup("ALPHA.example", "80", hints);
+        assert(r.error == 0);
+        assert(r.addresses.size() == 1);
+        assert(address_string(r.addresses[0]) == "10.0.0.1 80");
+        assert(r.addresses[0].socktype == SOCK_STREAM && r.addresses[0].protocol == IPPROTO_TCP);
+
+        r = table.lookup("alpha", "443", hints);
+        assert(r.error == 0);
+        assert(r.addresses.size() == 2);
+        assert(address_string(r.addresses[0]) == "10.0.0.1 443");
+        assert(address_string(r.addresses[1]) == "fd00::1 443");
+        assert(r.addresses[1].addrlen == sizeof(sockaddr_in6));
+
+        r = table.lookup("alpha", "443", stream_hints(AF_INET6));
+        assert(r.error == 0 && r.addresses.size() == 1 && r.addresses[0].family == AF_INET6);
+
+        // Without a socket type, one of each.
+        addrinfo any;
+        memset(&any, 0, sizeof(any));
+        r = table.lookup("beta", "", any);
+        assert(r.error == 0 && r.addresses.size() == 2);
+        assert(r.addresses[1].socktype == SOCK_DGRAM && r.addresses[1].protocol == IPPROTO_UDP);
+
+        r = table.lookup(IPv6_LOOPBACK_STRING_LITERAL, "4097", hints);
+        assert(r.error == 0 && r.addresses.size() == 1);
+        assert(address_string(r.addresses[0]) == "::1 4097");
+
+        assert(table.lookup("gamma", "80", hints).error == EAI_NONAME);
+        assert(table.lookup("delta", "80", hints).error == EAI_NONAME);
+        assert(table.lookup("beta", "http", hints).error == EAI_SERVICE);
+        assert(table.get_num_lookups() == 8);
+    }
+
+    // Results are kept for their TTL, failures for theirs, and then looked up again.
+    static void test_man7_resolver_cache()
+    {
+        man7_hosts_table table(hosts_text());
+        man7_resolver::options o;
+        o.ttl = std::chrono::milliseconds(200);
+        o.negative_ttl = std::chrono::milliseconds(100);
+        o.lookup = table.as_lookup();
+        man7_resolver resolver(o);
+        const addrinfo hints = stream_hints();
+
+        const man7_resolver::result_ptr first = resolver.resolve("alpha", "80", &hints);
+        assert(first->error == 0 && first->addresses.size() == 2);
+        const man7_resolver::result_ptr second = resolver.resolve("alpha", "80", &hints);
+        assert(second == first);
+        assert(table.get_num_lookups() == 1);
+
+        // Another service, or other hints, is another entry.
+        resolver.resolve("alpha", "81", &hints);
+        const addrinfo v6 = stream_hints(AF_INET6);
+        assert(resolver.resolve("alpha", "80", &v6)->addresses.size() == 1);
+        assert(table.get_num_lookups() == 3);
+
+        assert(resolver.resolve("delta", "80", &hints)->error == EAI_NONAME);
+        assert(resolver.resolve("delta", "80", &hints)->error == EAI_NONAME);
+        assert(table.get_num_lookups() == 4);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(150));
+        resolver.resolve("delta", "80", &hints);
+        resolver.resolve("alpha", "80", &hints);
+        assert(table.get_num_lookups() == 5);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        const man7_resolver::result_ptr third = resolver.resolve("alpha", "80", &hints);
+        assert(third != first && third->addresses.size() == 2);
+        assert(table.get_num_lookups() == 6);
+        assert(resolver.get_num_requests() == 9 && resolver.get_num_hits() == 3);
+
+        // Once full, the entries that expire first make room.
+        o.max_entries = 2;
+        o.ttl = std::chrono::milliseconds(60000);
+        man7_resolver small(o);
+        for (const char *service : {"1", "2", "3", "3", "1"})
+        {
+            small.resolve("beta", service, &hints);
+        }
+        assert(small.get_num_lookups() == 4);
+    }
+
+    // Concurrent requests for one name share one lookup, and lookups of different names
+    // run at once on the resolver's threads.
+    static void test_man7_resolver_async()
+    {
+        const std::chrono::milliseconds delay(200);
+        man7_hosts_table table(hosts_text(), delay);
+        man7_resolver::options o;
+        o.num_threads = 4;
+        o.lookup = table.as_lookup();
+        man7_resolver resolver(o);
+        const addrinfo hints = stream_hints();
+
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<man7_resolver::lookup_future> futures;
+        for (int i = 0; i < 8; i++)
+        {
+            futures.push_back(resolver.resolve_async("alpha", "80", &hints));
+        }
+        futures.push_back(resolver.resolve_async("beta", "80", &hints));
+        futures.push_back(resolver.resolve_async("delta", "80", &hints));
+
+        // resolve() waits for the lookup in flight rather than start its own.
+        std::vector<man7_resolver::result_ptr> waited(4);
+        std::vector<std::thread> waiters;
+        for (auto &&w : waited)
+        {
+            waiters.emplace_back([&]()
+                                 { w = resolver.resolve("alpha", "80", &hints); });
+        }
+        for (auto &&waiter : waiters)
+        {
+            waiter.join();
+        }
+
+        for (int i = 0; i < 8; i++)
+        {
+            assert(futures[i].get() == futures[0].get());
+        }
+        for (auto &&w : waited)
+        {
+            assert(w == futures[0].get());
+        }
+        assert(futures[0].get()->addresses.size() == 2);
+        assert(futures[8].get()->addresses.size() == 1);
+        assert(futures[9].get()->error == EAI_NONAME);
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        assert(table.get_num_lookups() == 3);
+        assert(resolver.get_num_coalesced() == 11);
+        assert(elapsed < 3 * delay);
+
+        // Cached now: ready at once.
+        man7_resolver::lookup_future cached = resolver.resolve_async("beta", "80", &hints);
+        assert(cached.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+        assert(table.get_num_lookups() == 3);
+    }
+
+    // A lookup that throws: the request, and those that waited for it, get the exception,
+    // nothing is kept, and the next request looks up again.
+    static void test_man7_resolver_throwing_lookup()
+    {
+        std::atomic<int> num_calls{0};
+        man7_resolver::options o;
+        o.num_threads = 1;
+        o.lookup = [&](const std::string &, const std::string &, const addrinfo &) -> man7_resolver::result
+        {
+            if (num_calls.fetch_add(1) < 2)
+            {
+                throw std::runtime_error("lookup");
+            }
+            return man7_resolver::result();
+        };
+        man7_resolver resolver(o);
+        const addrinfo hints = stream_hints();
+
+        bool thrown = false;
+        try
+        {
+            resolver.resolve_async("alpha", "80", &hints).get();
+        }
+        catch (const std::runtime_error &)
+        {
+            thrown = true;
+        }
+        assert(thrown);
+
+        thrown = false;
+        try
+        {
+            resolver.resolve("alpha", "80", &hints);
+        }
+        catch (const std::runtime_error &)
+        {
+            thrown = true;
+        }
+        assert(thrown);
+
+        // The thread that ran the first lookup is still there for the next.
+        assert(resolver.resolve_async("alpha", "80", &hints).get()->error == 0);
+        assert(resolver.resolve("alpha", "80", &hints)->error == 0);
+        assert(resolver.get_num_lookups() == 3 && num_calls == 3);
+    }
+
+    // With getaddrinfo() itself, for a name that needs no name server.
+    static void test_man7_resolver_getaddrinfo()
+    {
+        man7_resolver resolver;
+        addrinfo hints;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_DGRAM;
+        hints.ai_flags = AI_NUMERICHOST;
+
+        const man7_resolver::result_ptr r = resolver.resolve_async(IPv4_LOOPBACK_STRING_LITERAL, "4097", &hints).get();
+        man7_connection::write_function_results(__func__, "man7_resolver::resolve_async", r->error, r->errnum);
+        assert(r->error == 0 && r->addresses.size() == 1);
+        assert(address_string(r->addresses[0]) == "127.0.0.1 4097");
+        assert(resolver.resolve(IPv4_LOOPBACK_STRING_LITERAL, "4097", &hints) == r);
+        assert(resolver.get_num_lookups() == 1);
+
+        assert(resolver.resolve("bad host name!", "4097", &hints)->error != 0);
+    }
+};
+
+#endif // SANDBOX_MAN7_RESOLVER_TEST
@@ -0,0 +1,11 @@
+#include "man7_resolver_test.hpp"
+
+int main()
+{
+    man7_resolver_test::test_man7_hosts_table();
+    man7_resolver_test::test_man7_resolver_cache();
+    man7_resolver_test::test_man7_resolver_async();
+    man7_resolver_test::test_man7_resolver_throwing_lookup();
+    man7_resolver_test::test_man7_resolver_getaddrinfo();
+    return 0;
+}
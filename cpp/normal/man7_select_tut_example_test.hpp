@@ -2,9 +2,732 @@
 #define SANDBOX_MAN7_SELECT_TUT_EXAMPLE_TEST
 
 #include "man7_select_tut_example.hpp"
+#include "man7_forwarder.hpp"
+#include "man7_forwarder_pool.hpp"
+#include "man7_echo_server.hpp"
+#include "cpp_waitpid.hpp"
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cassert>
 
 class man7_select_tut_example_test
 {
+private:
+    // https://www.man7.org/linux/man-pages/man2/connect.2.html
+    // A blocking connection to `port` on the loopback address `host`, or -1.
+    static int connect_to(const char *host, int port)
+    {
+        sockaddr_storage addr;
+        memset(&addr, 0, sizeof(addr));
+        socklen_t addrlen = sizeof(sockaddr_in);
+        if (inet_pton(AF_INET, host, &((sockaddr_in *)&addr)->sin_addr) == 1)
+        {
+            addr.ss_family = AF_INET;
+            ((sockaddr_in *)&addr)->sin_port = htons(port);
+        }
+        else
+        {
+            inet_pton(AF_INET6, host, &((sockaddr_in6 *)&addr)->sin6_addr);
+            addr.ss_family = AF_INET6;
+            ((sockaddr_in6 *)&addr)->sin6_port = htons(port);
+            addrlen = sizeof(sockaddr_in6);
+        }
+
+        const int fd = socket(addr.ss_family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd != -1 && connect(fd, (const sockaddr *)&addr, addrlen) == -1)
+        {
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    // https://www.man7.org/linux/man-pages/man2/getsockname.2.html
+    // A TCP port on the loopback address `host` that nothing uses just now
+    static int free_port(const char *host)
+    {
+        sockaddr_storage addr;
+        memset(&addr, 0, sizeof(addr));
+        socklen_t addrlen = sizeof(sockaddr_in);
+        if (inet_pton(AF_INET, host, &((sockaddr_in *)&addr)->sin_addr) == 1)
+        {
+            addr.ss_family = AF_INET;
+        }
+        else
+        {
+            inet_pton(AF_INET6, host, &((sockaddr_in6 *)&addr)->sin6_addr);
+            addr.ss_family = AF_INET6;
+            addrlen = sizeof(sockaddr_in6);
+        }
+
+        const int fd = socket(addr.ss_family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        assert(fd != -1);
+        int ret = bind(fd, (const sockaddr *)&addr, addrlen);
+        assert(ret == 0);
+        ret = getsockname(fd, (sockaddr *)&addr, &addrlen);
+        assert(ret == 0);
+        close(fd);
+        return ntohs((addr.ss_family == AF_INET) ? ((sockaddr_in *)&addr)->sin_port : ((sockaddr_in6 *)&addr)->sin6_port);
+    }
+
+    static void read_exactly(int fd, char *buffer, size_t size)
+    {
+        for (size_t done = 0; done < size;)
+        {
+            const ssize_t r = read(fd, buffer + done, size - done);
+            assert(r > 0);
+            done += r;
+        }
+    }
+
+    // Relay many connections at once through `forwarder`, which forwards to an echo server.
+    static void test_many_connections(const char *host, int port)
+    {
+        const int num_connections = 50;
+        const size_t chunk_size = 4000;
+        const int num_chunks = 25;
+
+        std::vector<int> fds;
+        for (int i = 0; i < num_connections; i++)
+        {
+            const int fd = connect_to(host, port);
+            assert(fd != -1);
+            fds.push_back(fd);
+        }
+
+        // Interleave the connections, each with its own bytes.
+        std::vector<char> sent(chunk_size), received(chunk_size);
+        for (int k = 0; k < num_chunks; k++)
+        {
+            for (int i = 0; i < num_connections; i++)
+            {
+                for (size_t j = 0; j < chunk_size; j++)
+                {
+                    sent[j] = static_cast<char>(i * 31 + k * 7 + j);
+                }
+                const ssize_t w = write(fds[i], sent.data(), chunk_size);
+                assert(w == static_cast<ssize_t>(chunk_size));
+                read_exactly(fds[i], received.data(), chunk_size);
+                assert(sent == received);
+            }
+        }
+
+        // Closing the client's sending side closes the echo server's, and so the connection.
+        for (auto &&fd : fds)
+        {
+            shutdown(fd, SHUT_WR);
+            char c;
+            const ssize_t r = read(fd, &c, 1);
+            assert(r == 0);
+            close(fd);
+        }
+    }
+
+    // https://www.man7.org/linux/man-pages/man7/tcp.7.html ("Sockets API")
+    // An urgent byte from the client reaches the upstream side as an urgent byte, whatever
+    // the data path.
+    static void test_urgent_byte(const char *host, man7_forwarder::data_path path)
+    {
+        int upstream_listen_fd = socket(strchr(host, ':') ? AF_INET6 : AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        sockaddr_storage addr;
+        memset(&addr, 0, sizeof(addr));
+        socklen_t addrlen = sizeof(addr);
+        addr.ss_family = strchr(host, ':') ? AF_INET6 : AF_INET;
+        int ret = bind(upstream_listen_fd, (const sockaddr *)&addr, (addr.ss_family == AF_INET) ? sizeof(sockaddr_in) : sizeof(sockaddr_in6));
+        assert(ret == 0);
+        ret = listen(upstream_listen_fd, 1);
+        assert(ret == 0);
+        ret = getsockname(upstream_listen_fd, (sockaddr *)&addr, &addrlen);
+        assert(ret == 0);
+
+        man7_forwarder::options o;
+        o.forward_port = ntohs((addr.ss_family == AF_INET) ? ((sockaddr_in *)&addr)->sin_port : ((sockaddr_in6 *)&addr)->sin6_port);
+        o.forward_address = host;
+        o.path = path;
+
+        man7_forwarder forwarder(o);
+        ret = forwarder.start();
+        assert(ret == 0);
+        std::thread forwarder_thread([&]()
+                                     { forwarder.run(); });
+
+        const int client_fd = connect_to(host, forwarder.get_listen_port());
+        assert(client_fd != -1);
+        const int upstream_fd = accept(upstream_listen_fd, NULL, NULL);
+        assert(upstream_fd != -1);
+
+        ssize_t w = send(client_fd, "a", 1, 0);
+        assert(w == 1);
+        w = send(client_fd, "!", 1, MSG_OOB);
+        assert(w == 1);
+
+        pollfd pfd;
+        pfd.fd = upstream_fd;
+        pfd.events = POLLPRI;
+        ret = poll(&pfd, 1, 5000);
+        assert(ret == 1);
+        char c = 0;
+        const ssize_t r = recv(upstream_fd, &c, 1, MSG_OOB);
+        assert(r == 1 && c == '!');
+
+        close(upstream_fd);
+        close(client_fd);
+        close(upstream_listen_fd);
+        forwarder.request_stop();
+        forwarder_thread.join();
+    }
+
+public:
+    // Based on man7_select_tut_example_test::test_man7_select_tut_example()
+    static void test_man7_forwarder(const char *host, man7_forwarder::data_path path, man7_forwarder::backend b = man7_forwarder::backend::EPOLL)
+    {
+        man7_echo_server echo_server;
+        bool started = echo_server.start(host);
+        assert(started);
+
+        man7_forwarder::options o;
+        o.forward_port = echo_server.get_port();
+        o.forward_address = host;
+
+        // Smaller than each chunk, so that the buffers fill up. (Pipes are at least a page.)
+        // With io_uring, there are fewer provided buffers than directions, so that some
+        // receives wait for a buffer.
+        o.buffer_size = 1024;
+        o.path = path;
+        o.requested_backend = b;
+
+        man7_forwarder forwarder(o);
+        const int start_result = forwarder.start();
+        assert(start_result == 0);
+
+        int run_result = -1;
+        int run_errnum = 0;
+        std::thread forwarder_thread([&]()
+                                     {
+            errno = 0;
+            run_result = forwarder.run();
+            run_errnum = errno; });
+
+        test_many_connections(host, forwarder.get_listen_port());
+
+        // Nothing listens on the forward-to port any more, so the client is cut off.
+        const int listen_port = forwarder.get_listen_port();
+        echo_server.stop();
+        const int fd = connect_to(host, listen_port);
+        assert(fd != -1);
+        char c;
+        const ssize_t r = read(fd, &c, 1);
+        assert(r <= 0);
+        close(fd);
+
+        forwarder.request_stop();
+        forwarder_thread.join();
+        man7_connection::write_function_results(__func__, "run", run_result, run_errnum);
+        assert(run_result == 0);
+
+        // The io_uring backend does not relay urgent bytes.
+        if (forwarder.get_backend() == man7_forwarder::backend::EPOLL)
+        {
+            test_urgent_byte(host, path);
+        }
+    }
+
+    // Everything that run() started has ended when it returns, so the listening port is free
+    // at once for the next forwarder. (With io_uring, closing the ring cancels the accept in
+    // flight only in the background.)
+    static void test_man7_forwarder_restart(const char *host, man7_forwarder::backend b)
+    {
+        man7_forwarder::options o;
+        o.forward_port = 4097;
+        o.forward_address = host;
+        o.requested_backend = b;
+
+        for (int i = 0; i < 50; i++)
+        {
+            man7_forwarder forwarder(o);
+            const int start_result = forwarder.start();
+            assert(start_result == 0);
+            o.listen_port = forwarder.get_listen_port();
+
+            int run_result = -1;
+            std::thread forwarder_thread([&]()
+                                         { run_result = forwarder.run(); });
+            forwarder.request_stop();
+            forwarder_thread.join();
+            assert(run_result == 0);
+        }
+    }
+
+    // A number of provided buffers that is not a power of 2 is refused, and one that the
+    // kernel refuses makes the forwarder fall back to epoll, with a listening socket that is
+    // still non-blocking (or it would block in accept4() for good).
+    static void test_man7_forwarder_io_uring_fallback(const char *host)
+    {
+        man7_echo_server echo_server;
+        bool started = echo_server.start(host);
+        assert(started);
+
+        man7_forwarder::options o;
+        o.forward_port = echo_server.get_port();
+        o.forward_address = host;
+        o.buffer_size = 1024;
+        o.requested_backend = man7_forwarder::backend::IO_URING;
+
+        {
+            o.num_provided_buffers = 48;
+            man7_forwarder forwarder(o);
+            errno = 0;
+            const int start_result = forwarder.start();
+            assert(start_result == -1 && errno == EINVAL);
+        }
+
+        o.num_provided_buffers = 65536;
+        man7_forwarder forwarder(o);
+        const int start_result = forwarder.start();
+        assert(start_result == 0);
+        assert(forwarder.get_backend() == man7_forwarder::backend::EPOLL);
+
+        int run_result = -1;
+        std::thread forwarder_thread([&]()
+                                     { run_result = forwarder.run(); });
+
+        test_many_connections(host, forwarder.get_listen_port());
+
+        forwarder.request_stop();
+        forwarder_thread.join();
+        assert(run_result == 0);
+        echo_server.stop();
+    }
+
+    // With a single provided buffer, connections that send at once take turns with it, and
+    // a receive that found none gets one once it is given back, however the completions of
+    // the give-back and of the receive fall in a batch.
+    static void test_man7_forwarder_one_provided_buffer(const char *host)
+    {
+        man7_echo_server echo_server;
+        bool started = echo_server.start(host);
+        assert(started);
+
+        man7_forwarder::options o;
+        o.forward_port = echo_server.get_port();
+        o.forward_address = host;
+        o.buffer_size = 1024;
+        o.requested_backend = man7_forwarder::backend::IO_URING;
+        o.num_provided_buffers = 1;
+
+        man7_forwarder forwarder(o);
+        const int start_result = forwarder.start();
+        assert(start_result == 0);
+
+        int run_result = -1;
+        std::thread forwarder_thread([&]()
+                                     { run_result = forwarder.run(); });
+
+        const int num_connections = 8;
+        const size_t chunk_size = 4000;
+        const int num_chunks = 100;
+        std::vector<std::thread> clients;
+        for (int i = 0; i < num_connections; i++)
+        {
+            clients.emplace_back([&, i]()
+                                 {
+                const int fd = connect_to(host, forwarder.get_listen_port());
+                assert(fd != -1);
+                // A stalled receive fails the test rather than hang it.
+                const timeval timeout = {5, 0};
+                const int setsockopt_result = setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+                assert(setsockopt_result == 0);
+
+                std::vector<char> sent(chunk_size), received(chunk_size);
+                for (int k = 0; k < num_chunks; k++)
+                {
+                    for (size_t j = 0; j < chunk_size; j++)
+                    {
+                        sent[j] = static_cast<char>(i * 31 + k * 7 + j);
+                    }
+                    const ssize_t w = write(fd, sent.data(), chunk_size);
+                    assert(w == static_cast<ssize_t>(chunk_size));
+                    read_exactly(fd, received.data(), chunk_size);
+                    assert(sent == received);
+                }
+                close(fd); });
+        }
+        for (auto &&client : clients)
+        {
+            client.join();
+        }
+
+        forwarder.request_stop();
+        forwarder_thread.join();
+        assert(run_result == 0);
+        echo_server.stop();
+    }
+
+    // A direction holds a buffer only while data is in it: connections that have gone idle
+    // hold none, after a bulk transfer that grew their buffers and wrapped them around.
+    // Without adaptive buffers, each direction holds one of `buffer_size` until it closes.
+    static void test_man7_forwarder_buffers(const char *host)
+    {
+        man7_echo_server echo_server;
+        bool started = echo_server.start(host);
+        assert(started);
+
+        for (const bool adaptive : {true, false})
+        {
+            man7_forwarder::options o;
+            o.forward_port = echo_server.get_port();
+            o.forward_address = host;
+            o.buffer_size = 64 * 1024;
+            o.min_buffer_size = 4 * 1024;
+            o.adaptive_buffers = adaptive;
+
+            man7_forwarder forwarder(o);
+            const int start_result = forwarder.start();
+            assert(start_result == 0);
+            std::thread forwarder_thread([&]()
+                                         { forwarder.run(); });
+
+            const int num_connections = 10;
+            std::vector<int> fds;
+            for (int i = 0; i < num_connections; i++)
+            {
+                const int fd = connect_to(host, forwarder.get_listen_port());
+                assert(fd != -1);
+                fds.push_back(fd);
+            }
+
+            // Writes of an odd size, while the echo comes back in reads of another.
+            const size_t num_bytes = 1000 * 1000;
+            std::thread writer([&]()
+                               {
+                std::vector<char> sent(777);
+                for (size_t done = 0; done < num_bytes;)
+                {
+                    const size_t n = std::min(sent.size(), num_bytes - done);
+                    for (size_t j = 0; j < n; j++)
+                    {
+                        sent[j] = static_cast<char>((done + j) % 251);
+                    }
+                    const ssize_t w = write(fds[0], sent.data(), n);
+                    assert(w > 0);
+                    done += w;
+                } });
+            std::vector<char> received(num_bytes);
+            read_exactly(fds[0], received.data(), num_bytes);
+            writer.join();
+            for (size_t j = 0; j < num_bytes; j++)
+            {
+                assert(received[j] == static_cast<char>(j % 251));
+            }
+
+            // The forwarder gives the buffers back just after it has sent their last bytes.
+            const size_t expected = adaptive ? 0 : num_connections * 2 * o.buffer_size;
+            for (int i = 0; i < 5000 && forwarder.get_num_buffer_bytes_in_use() != expected; i++)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            assert(forwarder.get_num_buffer_bytes_in_use() == expected);
+
+            for (auto &&fd : fds)
+            {
+                close(fd);
+            }
+            forwarder.request_stop();
+            forwarder_thread.join();
+            assert(forwarder.get_num_buffer_bytes_in_use() == 0);
+        }
+        echo_server.stop();
+    }
+
+private:
+    // https://www.man7.org/linux/man-pages/man2/getrlimit.2.html
+    // https://www.man7.org/linux/man-pages/man3/sigwait.3.html
+    // A child process that runs a forwarder with only enough file descriptors left for one
+    // connection (its two sockets), until SIGTERM, and then exits with 0 if run() succeeded.
+    // Returns its PID, with the forwarder's port in `port`.
+    static pid_t fork_forwarder_with_fds_for_one_connection(const man7_forwarder::options &o, int &port)
+    {
+        int pipe_fds[2];
+        int ret = pipe2(pipe_fds, O_CLOEXEC);
+        assert(ret == 0);
+
+        const pid_t pid = fork();
+        assert(pid != -1);
+        if (pid == 0)
+        {
+            int exit_status = 1;
+            {
+                sigset_t set;
+                sigemptyset(&set);
+                sigaddset(&set, SIGTERM);
+                pthread_sigmask(SIG_BLOCK, &set, NULL);
+
+                man7_forwarder forwarder(o);
+                port = (forwarder.start() == 0) ? forwarder.get_listen_port() : -1;
+
+                // The lowest 2 that are free: the first connection gets those, and no other.
+                int fds[2];
+                for (auto &&fd : fds)
+                {
+                    fd = dup(STDERR_FILENO);
+                }
+                for (const int fd : fds)
+                {
+                    close(fd);
+                }
+                rlimit limit;
+                getrlimit(RLIMIT_NOFILE, &limit);
+                limit.rlim_cur = static_cast<rlim_t>(fds[1]) + 1;
+                if (fds[1] == -1 || setrlimit(RLIMIT_NOFILE, &limit) == -1)
+                {
+                    port = -1;
+                }
+
+                const ssize_t w = write(pipe_fds[1], &port, sizeof(port));
+                if (port != -1 && w == sizeof(port))
+                {
+                    std::thread stopper([&]()
+                                        {
+                        int sig = 0;
+                        sigwait(&set, &sig);
+                        forwarder.request_stop(); });
+                    exit_status = (forwarder.run() == 0) ? 0 : 1;
+                    stopper.join();
+                }
+            }
+            // Not exit(): the parent's objects are not the child's to destroy.
+            _exit(exit_status);
+        }
+
+        close(pipe_fds[1]);
+        const ssize_t r = read(pipe_fds[0], &port, sizeof(port));
+        assert(r == sizeof(port) && port != -1);
+        close(pipe_fds[0]);
+        return pid;
+    }
+
+public:
+    // A connection that waits in the backlog while the forwarder is out of file descriptors
+    // is accepted once another connection closes, without a new connection to wake it.
+    static void test_man7_forwarder_out_of_fds(const char *host, man7_forwarder::backend b = man7_forwarder::backend::EPOLL)
+    {
+        man7_echo_server echo_server;
+        bool started = echo_server.start(host);
+        assert(started);
+
+        man7_forwarder::options o;
+        o.forward_port = echo_server.get_port();
+        o.forward_address = host;
+        o.requested_backend = b;
+
+        int port = -1;
+        const pid_t pid = fork_forwarder_with_fds_for_one_connection(o, port);
+
+        char c = 'a';
+        const int held_fd = connect_to(host, port);
+        assert(held_fd != -1);
+        ssize_t w = write(held_fd, &c, 1);
+        assert(w == 1);
+        read_exactly(held_fd, &c, 1);
+        assert(c == 'a');
+
+        // The forwarder has no file descriptor left to accept this one with.
+        const int waiting_fd = connect_to(host, port);
+        assert(waiting_fd != -1);
+        const timeval timeout = {5, 0};
+        const int setsockopt_result = setsockopt(waiting_fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        assert(setsockopt_result == 0);
+        c = 'b';
+        w = write(waiting_fd, &c, 1);
+        assert(w == 1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        shutdown(held_fd, SHUT_WR);
+        ssize_t r = read(held_fd, &c, 1);
+        assert(r == 0);
+        close(held_fd);
+
+        c = 0;
+        r = read(waiting_fd, &c, 1);
+        assert(r == 1 && c == 'b');
+        close(waiting_fd);
+
+        kill(pid, SIGTERM);
+        const int waitpid_result = cpp_waitpid::waitpid_special(pid);
+        assert(waitpid_result == 0);
+        echo_server.stop();
+    }
+
+private:
+    // https://www.man7.org/linux/man-pages/man2/sigaction.2.html
+    // Run `forwarder_main` with `argv` on a thread, relay a byte through `port` on `host`
+    // once it has set its signal handlers, and stop it with `sig`. Returns what it returned.
+    static int run_main_until_signal(int (*forwarder_main)(int, char const *[]), int argc, char const *argv[], const char *host, int port, int sig)
+    {
+        struct sigaction before, act;
+        sigaction(sig, NULL, &before);
+
+        int result = -1;
+        std::thread main_thread([&]()
+                                { result = forwarder_main(argc, argv); });
+
+        // The handler goes in once the forwarder has started listening.
+        for (int i = 0; i < 500; i++)
+        {
+            sigaction(sig, NULL, &act);
+            if (act.sa_handler != before.sa_handler)
+            {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        assert(act.sa_handler != before.sa_handler);
+
+        const int fd = connect_to(host, port);
+        assert(fd != -1);
+        char c = 'x';
+        const ssize_t w = write(fd, &c, 1);
+        assert(w == 1);
+        c = 0;
+        read_exactly(fd, &c, 1);
+        assert(c == 'x');
+        close(fd);
+
+        kill(getpid(), sig);
+        main_thread.join();
+
+        // And put back the handler that was there before
+        sigaction(sig, NULL, &act);
+        assert(act.sa_handler == before.sa_handler);
+        return result;
+    }
+
+public:
+    // man7_forwarder::man7_forwarder_main(), as "fwd <listen-port> <forward-to-port>
+    // <forward-to-ip-address>" would run it, until SIGTERM
+    static void test_man7_forwarder_main(const char *host)
+    {
+        man7_echo_server echo_server;
+        bool started = echo_server.start(host);
+        assert(started);
+
+        const int port = free_port(host);
+        const std::string listen_port = std::to_string(port);
+        const std::string forward_port = std::to_string(echo_server.get_port());
+
+        {
+            const char *argv[] = {"fwd", listen_port.c_str(), forward_port.c_str()};
+            errno = 0;
+            const int result = man7_forwarder::man7_forwarder_main(3, argv);
+            assert(result == 1 && errno == EINVAL);
+        }
+        {
+            const char *argv[] = {"fwd", "not-a-port", forward_port.c_str(), host};
+            const int result = man7_forwarder::man7_forwarder_main(4, argv);
+            assert(result == 2);
+        }
+        {
+            // Below LOWER_BOUND_FOR_LOCAL_IP_PORT
+            const char *argv[] = {"fwd", "80", forward_port.c_str(), host};
+            const int result = man7_forwarder::man7_forwarder_main(4, argv);
+            assert(result == 3);
+        }
+
+        const char *argv[] = {"fwd", listen_port.c_str(), forward_port.c_str(), host};
+        const int result = run_main_until_signal(man7_forwarder::man7_forwarder_main, 4, argv, host, port, SIGTERM);
+        assert(result == 0);
+        echo_server.stop();
+    }
+
+    // Connections spread over the workers of a man7_forwarder_pool, each of which relays
+    // the ones that it accepted.
+    static void test_man7_forwarder_pool(const char *host)
+    {
+        man7_echo_server echo_server;
+        bool started = echo_server.start(host);
+        assert(started);
+
+        man7_forwarder_pool::options o;
+        o.forwarder_options.forward_port = echo_server.get_port();
+        o.forwarder_options.forward_address = host;
+        o.num_workers = 3;
+
+        man7_forwarder_pool pool(o);
+        const int start_result = pool.start();
+        assert(start_result == 0);
+        assert(pool.get_num_workers() == 3);
+
+        int run_result = -1;
+        std::thread pool_thread([&]()
+                                { run_result = pool.run(); });
+
+        test_many_connections(host, pool.get_listen_port());
+
+        pool.request_stop();
+        pool_thread.join();
+        assert(run_result == 0);
+
+        // Each connection has its own source port, which the kernel hashes to pick the
+        // listening socket: all 50 landing on fewer than 3 workers is next to impossible.
+        uint64_t num_accepted = 0;
+        for (size_t i = 0; i < pool.get_num_workers(); i++)
+        {
+            assert(pool.get_num_accepted(i) > 0);
+            num_accepted += pool.get_num_accepted(i);
+        }
+        assert(num_accepted == 50);
+        echo_server.stop();
+    }
+
+    // man7_forwarder_pool::man7_forwarder_pool_main(), as "fwd <listen-port> <forward-to-port>
+    // <forward-to-ip-address> <num-workers>" would run it, until SIGINT
+    static void test_man7_forwarder_pool_main(const char *host)
+    {
+        man7_echo_server echo_server;
+        bool started = echo_server.start(host);
+        assert(started);
+
+        const int port = free_port(host);
+        const std::string listen_port = std::to_string(port);
+        const std::string forward_port = std::to_string(echo_server.get_port());
+
+        {
+            const char *argv[] = {"fwd", listen_port.c_str(), forward_port.c_str(), host};
+            errno = 0;
+            const int result = man7_forwarder_pool::man7_forwarder_pool_main(4, argv);
+            assert(result == 1 && errno == EINVAL);
+        }
+        {
+            const char *argv[] = {"fwd", listen_port.c_str(), forward_port.c_str(), host, "-1"};
+            const int result = man7_forwarder_pool::man7_forwarder_pool_main(5, argv);
+            assert(result == 2);
+        }
+        {
+            const char *argv[] = {"fwd", listen_port.c_str(), forward_port.c_str(), host, "two"};
+            const int result = man7_forwarder_pool::man7_forwarder_pool_main(5, argv);
+            assert(result == 2);
+        }
+
+        const char *argv[] = {"fwd", listen_port.c_str(), forward_port.c_str(), host, "2"};
+        const int result = run_main_until_signal(man7_forwarder_pool::man7_forwarder_pool_main, 5, argv, host, port, SIGINT);
+        assert(result == 0);
+        echo_server.stop();
+    }
+
 public:
     static void test_man7_select_tut_example(const char *host)
     {
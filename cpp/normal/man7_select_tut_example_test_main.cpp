@@ -5,5 +5,28 @@ int main()
 {
     man7_select_tut_example_test::test_man7_select_tut_example(IPv4_LOOPBACK_STRING_LITERAL);
     man7_select_tut_example_test::test_man7_select_tut_example(IPv6_LOOPBACK_STRING_LITERAL);
+    man7_select_tut_example_test::test_man7_forwarder(IPv4_LOOPBACK_STRING_LITERAL, man7_forwarder::data_path::COPY);
+    man7_select_tut_example_test::test_man7_forwarder(IPv6_LOOPBACK_STRING_LITERAL, man7_forwarder::data_path::COPY);
+    man7_select_tut_example_test::test_man7_forwarder(IPv4_LOOPBACK_STRING_LITERAL, man7_forwarder::data_path::SPLICE);
+    man7_select_tut_example_test::test_man7_forwarder(IPv6_LOOPBACK_STRING_LITERAL, man7_forwarder::data_path::SPLICE);
+    man7_select_tut_example_test::test_man7_forwarder(IPv4_LOOPBACK_STRING_LITERAL, man7_forwarder::data_path::COPY, man7_forwarder::backend::IO_URING);
+    man7_select_tut_example_test::test_man7_forwarder(IPv6_LOOPBACK_STRING_LITERAL, man7_forwarder::data_path::COPY, man7_forwarder::backend::IO_URING);
+    man7_select_tut_example_test::test_man7_forwarder_restart(IPv4_LOOPBACK_STRING_LITERAL, man7_forwarder::backend::EPOLL);
+    man7_select_tut_example_test::test_man7_forwarder_restart(IPv4_LOOPBACK_STRING_LITERAL, man7_forwarder::backend::IO_URING);
+    man7_select_tut_example_test::test_man7_forwarder_restart(IPv6_LOOPBACK_STRING_LITERAL, man7_forwarder::backend::IO_URING);
+    man7_select_tut_example_test::test_man7_forwarder_io_uring_fallback(IPv4_LOOPBACK_STRING_LITERAL);
+    man7_select_tut_example_test::test_man7_forwarder_io_uring_fallback(IPv6_LOOPBACK_STRING_LITERAL);
+    man7_select_tut_example_test::test_man7_forwarder_one_provided_buffer(IPv4_LOOPBACK_STRING_LITERAL);
+    man7_select_tut_example_test::test_man7_forwarder_buffers(IPv4_LOOPBACK_STRING_LITERAL);
+    man7_select_tut_example_test::test_man7_forwarder_buffers(IPv6_LOOPBACK_STRING_LITERAL);
+    man7_select_tut_example_test::test_man7_forwarder_out_of_fds(IPv4_LOOPBACK_STRING_LITERAL);
+    man7_select_tut_example_test::test_man7_forwarder_out_of_fds(IPv6_LOOPBACK_STRING_LITERAL);
+    man7_select_tut_example_test::test_man7_forwarder_out_of_fds(IPv4_LOOPBACK_STRING_LITERAL, man7_forwarder::backend::IO_URING);
+    man7_select_tut_example_test::test_man7_forwarder_main(IPv4_LOOPBACK_STRING_LITERAL);
+    man7_select_tut_example_test::test_man7_forwarder_main(IPv6_LOOPBACK_STRING_LITERAL);
+    man7_select_tut_example_test::test_man7_forwarder_pool(IPv4_LOOPBACK_STRING_LITERAL);
+    man7_select_tut_example_test::test_man7_forwarder_pool(IPv6_LOOPBACK_STRING_LITERAL);
+    man7_select_tut_example_test::test_man7_forwarder_pool_main(IPv4_LOOPBACK_STRING_LITERAL);
+    man7_select_tut_example_test::test_man7_forwarder_pool_main(IPv6_LOOPBACK_STRING_LITERAL);
     return 0;
 }
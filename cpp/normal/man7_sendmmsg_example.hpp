@@ -8,6 +8,8 @@
 
 #include <arpa/inet.h>
 #include <netinet/in.h>
+#include <netinet/udp.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -16,8 +18,13 @@
 
 class man7_sendmmsg_example
 {
+private:
+    static const uint16_t GSO_SEGMENT_SIZE = 8;
+
 public:
-    static int man7_sendmmsg_example_main(void)
+    // With `use_gso`, the bytes of the three messages go as one, which the kernel cuts into
+    // datagrams of GSO_SEGMENT_SIZE bytes each (see set_segment_size()).
+    static int man7_sendmmsg_example_main(bool use_gso = false)
     {
 #ifdef _GNU_SOURCE
         int errnum = 0;
@@ -83,13 +90,26 @@ public:
         msg[2].msg_hdr.msg_iov = &msg3;
         msg[2].msg_hdr.msg_iovlen = 1;
 
-        write_mmsghdrs(msg, sizeof(msg) / sizeof(mmsghdr));
+        // "abcdefgh", "ijklmnop", "qrstuvwx" and "yz01234"
+        iovec all[] = {msg1[0], msg1[1], msg1[2], msg2, msg3};
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(uint16_t))];
+        unsigned num_messages = sizeof(msg) / sizeof(mmsghdr);
+        if (use_gso)
+        {
+            memset(msg, 0, sizeof(msg));
+            msg[0].msg_hdr.msg_iov = all;
+            msg[0].msg_hdr.msg_iovlen = sizeof(all) / sizeof(iovec);
+            set_segment_size(msg[0].msg_hdr, control, GSO_SEGMENT_SIZE);
+            num_messages = 1;
+        }
+
+        write_mmsghdrs(msg, num_messages);
 
         errno = 0;
-        const int sendmmsg_result = sendmmsg(sockfd, msg, sizeof(msg) / sizeof(mmsghdr), 0);
+        const int sendmmsg_result = sendmmsg(sockfd, msg, num_messages, 0);
         errnum = errno;
 
-        write_mmsghdrs(msg, sizeof(msg) / sizeof(mmsghdr));
+        write_mmsghdrs(msg, num_messages);
 
         write_sendmmsg_results(__func__, sendmmsg_result, errnum);
 
@@ -104,6 +124,24 @@ public:
 #endif // _GNU_SOURCE
     }
 
+    // https://www.man7.org/linux/man-pages/man7/udp.7.html ("UDP_SEGMENT")
+    // https://www.man7.org/linux/man-pages/man3/cmsg.3.html
+    // Make `msg` a message that the kernel cuts into datagrams of `segment_size` bytes each
+    // (the last may be shorter), however its bytes are spread over its iovecs, with a
+    // UDP_SEGMENT control message in `control`. `control` must hold
+    // CMSG_SPACE(sizeof(uint16_t)) bytes, aligned for a cmsghdr, until `msg` has been sent.
+    static void set_segment_size(msghdr &msg, char *control, uint16_t segment_size)
+    {
+        memset(control, 0, CMSG_SPACE(sizeof(uint16_t)));
+        msg.msg_control = control;
+        msg.msg_controllen = CMSG_SPACE(sizeof(uint16_t));
+        cmsghdr *const cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_UDP;
+        cmsg->cmsg_type = UDP_SEGMENT;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+        memcpy(CMSG_DATA(cmsg), &segment_size, sizeof(segment_size));
+    }
+
 private:
     // https://www.man7.org/linux/man-pages/man2/write.2.html
     // https://www.man7.org/linux/man-pages/man3/write.3p.html
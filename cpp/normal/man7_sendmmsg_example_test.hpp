@@ -2,9 +2,73 @@
 #define SANDBOX_MAN7_SENDMMSG_EXAMPLE_TEST
 
 #include "man7_sendmmsg_example.hpp"
+#include "man7_udp_echo.hpp"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cassert>
 
 class man7_sendmmsg_example_test
 {
+private:
+    // https://www.man7.org/linux/man-pages/man7/udp.7.html ("UDP_GRO")
+    // What man7_sendmmsg_example_main(use_gso) sends, as received by a socket on the port
+    // it sends to, with or without GRO: each datagram as it is cut up by the segment size
+    // that came with it.
+    static std::vector<std::string> receive_datagrams(bool use_gso, bool use_gro)
+    {
+        const int fd = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        assert(fd != -1);
+        sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = htons(LOWER_BOUND_FOR_LOCAL_IP_PORT);
+        int ret = bind(fd, (const sockaddr *)&addr, sizeof(addr));
+        assert(ret == 0);
+        const int yes = 1;
+        if (use_gro)
+        {
+            ret = setsockopt(fd, SOL_UDP, UDP_GRO, &yes, sizeof(yes));
+            assert(ret == 0);
+        }
+
+        ret = man7_sendmmsg_example::man7_sendmmsg_example_main(use_gso);
+        assert(ret == 0);
+
+        std::vector<std::string> datagrams;
+        for (;;)
+        {
+            char buffer[256];
+            alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+            iovec iov = {buffer, sizeof(buffer)};
+            msghdr msg;
+            memset(&msg, 0, sizeof(msg));
+            msg.msg_iov = &iov;
+            msg.msg_iovlen = 1;
+            msg.msg_control = control;
+            msg.msg_controllen = sizeof(control);
+            const ssize_t r = recvmsg(fd, &msg, MSG_DONTWAIT);
+            if (r == -1)
+            {
+                break;
+            }
+            const size_t segment_size = man7_udp_echo::segment_size_of(msg, r);
+            for (size_t offset = 0; offset < static_cast<size_t>(r); offset += segment_size)
+            {
+                datagrams.emplace_back(buffer + offset, std::min(segment_size, r - offset));
+            }
+        }
+        close(fd);
+        return datagrams;
+    }
+
 public:
     static void test_man7_sendmmsg_example()
     {
@@ -16,6 +80,19 @@ public:
 
         man7_connection::write_function_results(__func__, "man7_sendmmsg_example_main", result, errnum);
     }
+
+    // The datagrams come through as they were sent, or as GSO cut them up, whether or not
+    // GRO glued them back together on the way in.
+    static void test_man7_sendmmsg_example_segments()
+    {
+        const std::vector<std::string> sent = {"abcdefg", "hijklmno", "pqrstuvwxyz01234"};
+        const std::vector<std::string> segmented = {"abcdefgh", "ijklmnop", "qrstuvwx", "yz01234"};
+
+        assert(receive_datagrams(false, false) == sent);
+        assert(receive_datagrams(false, true) == sent);
+        assert(receive_datagrams(true, false) == segmented);
+        assert(receive_datagrams(true, true) == segmented);
+    }
 };
 
 #endif // SANDBOX_MAN7_SENDMMSG_EXAMPLE_TEST
@@ -3,5 +3,6 @@
 int main()
 {
     man7_sendmmsg_example_test::test_man7_sendmmsg_example();
+    man7_sendmmsg_example_test::test_man7_sendmmsg_example_segments();
     return 0;
 }
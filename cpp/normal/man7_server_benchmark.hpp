@@ -0,0 +1,235 @@
+#ifndef SANDBOX_MAN7_SERVER_BENCHMARK
+#define SANDBOX_MAN7_SERVER_BENCHMARK
+
+#include "man7_connection.hpp"
+#include "man7_server_pool.hpp"
+#include "man7_server_epoll.hpp"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/resource.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cassert>
+
+class man7_server_benchmark
+{
+private:
+    // https://en.cppreference.com/w/cpp/chrono/steady_clock
+    // https://en.cppreference.com/w/cpp/chrono/duration/duration_cast
+    template <typename F>
+    static double seconds_taken(F f)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count();
+    }
+
+    static void write_result(const std::string &name, int num_workers, int num_clients, double connections_per_second, double requests_per_second)
+    {
+        std::cout << name << '\t' << num_workers << '\t' << num_clients << '\t' << connections_per_second << '\t' << requests_per_second << '\n';
+    }
+
+    // https://www.man7.org/linux/man-pages/man2/connect.2.html
+    // Wait for the server to start listening.
+    static int connect_to_server()
+    {
+        sockaddr_un addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        strncpy(addr.sun_path, SOCKET_NAME, sizeof(addr.sun_path) - 1);
+
+        for (int num_tries_left = 5000; num_tries_left > 0; num_tries_left--)
+        {
+            const int data_socket = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+            assert(data_socket != -1);
+            if (connect(data_socket, (const sockaddr *)&addr, sizeof(addr)) == 0)
+            {
+                return data_socket;
+            }
+            close(data_socket);
+            usleep(1000);
+        }
+        return -1;
+    }
+
+    // One client's connection: send `num_summands` numbers and "END", then read the sum.
+    static void sum(int num_summands)
+    {
+        const int data_socket = connect_to_server();
+        assert(data_socket != -1);
+
+        for (int i = 1; i <= num_summands; i++)
+        {
+            const std::string summand = std::to_string(i);
+            const ssize_t w = write(data_socket, summand.c_str(), summand.size() + 1);
+            assert(w == static_cast<ssize_t>(summand.size() + 1));
+        }
+        ssize_t w = write(data_socket, "END", 4);
+        assert(w == 4);
+
+        char buffer[BUFFER_SIZE];
+        const ssize_t r = read(data_socket, buffer, sizeof(buffer));
+        assert(r == sizeof(buffer));
+        assert(std::stoi(buffer) == num_summands * (num_summands + 1) / 2);
+        close(data_socket);
+    }
+
+    // https://www.man7.org/linux/man-pages/man2/dup.2.html
+    // Start `server_main` in a child process, with its output thrown away.
+    static pid_t fork_server(const std::function<int()> &server_main)
+    {
+        const pid_t pid = fork();
+        assert(pid != -1);
+        if (pid == 0)
+        {
+            const int fd = open("/dev/null", O_WRONLY);
+            dup2(fd, STDOUT_FILENO);
+            close(fd);
+            exit(server_main());
+        }
+        return pid;
+    }
+
+    static void shut_down_server(pid_t pid)
+    {
+        const int data_socket = connect_to_server();
+        assert(data_socket != -1);
+        ssize_t w = write(data_socket, "DOWN", 5);
+        assert(w == 5);
+        w = write(data_socket, "END", 4);
+        assert(w == 4);
+        char buffer[BUFFER_SIZE];
+        const ssize_t r = read(data_socket, buffer, sizeof(buffer));
+        assert(r == sizeof(buffer));
+        close(data_socket);
+
+        int wstatus = 0;
+        waitpid(pid, &wstatus, 0);
+        assert(WIFEXITED(wstatus) && WEXITSTATUS(wstatus) == 0);
+    }
+
+private:
+    // Run `num_clients` client threads against a server started by `server_main`, each
+    // making `num_connections_per_client` connections of `num_summands` numbers.
+    static void benchmark_server(const std::string &name, const std::function<int()> &server_main, int num_workers, int num_clients, int num_connections_per_client, int num_summands)
+    {
+        const pid_t pid = fork_server(server_main);
+
+        // Let the server start before the clock does.
+        close(connect_to_server());
+
+        const double seconds = seconds_taken([&]()
+                                             {
+            std::vector<std::thread> threads;
+            for (int t = 0; t < num_clients; t++)
+            {
+                threads.emplace_back([&]()
+                                     {
+                    for (int k = 0; k < num_connections_per_client; k++)
+                    {
+                        sum(num_summands);
+                    } });
+            }
+            for (auto &&thread : threads)
+            {
+                thread.join();
+            } });
+
+        shut_down_server(pid);
+
+        const double num_connections = static_cast<double>(num_clients) * num_connections_per_client;
+        write_result(name, num_workers, num_clients, num_connections / seconds, num_connections * (num_summands + 1) / seconds);
+    }
+
+public:
+    // Compare the pool with its number of workers. A request is one packet: a number or
+    // "END". The workers only run in parallel if there are cores for them.
+    static void benchmark_server_pool()
+    {
+        std::cout << "server\tnum_workers\tnum_clients\tconnections_per_second\trequests_per_second\n";
+
+        const int num_clients = 8;
+        const int num_connections_per_client = 2000;
+        const int num_summands = 10;
+
+        for (const int num_workers : {1, 2, 4, 8})
+        {
+            benchmark_server(
+                "man7_server_pool", [&]()
+                { return man7_server_pool::man7_server_pool_main(num_workers); },
+                num_workers, num_clients, num_connections_per_client, num_summands);
+        }
+    }
+
+    // https://www.man7.org/linux/man-pages/man2/getrlimit.2.html
+    // The load generator: open `num_connections` connections to man7_server_epoll and
+    // leave each of them in the middle of a sum, then finish them all. Each side needs a
+    // file descriptor per connection, so the soft limit is raised as far as it goes.
+    static void benchmark_server_epoll()
+    {
+        std::cout << "server\tnum_concurrent_connections\tseconds_to_connect\tseconds_to_finish\n";
+
+        rlimit limit;
+        getrlimit(RLIMIT_NOFILE, &limit);
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+
+        const int num_connections = (limit.rlim_cur >= 10100) ? 10000 : static_cast<int>(limit.rlim_cur) - 100;
+
+        const pid_t pid = fork_server(man7_server_epoll::man7_server_epoll_main);
+        close(connect_to_server());
+
+        std::vector<int> data_sockets;
+        const double connect_seconds = seconds_taken([&]()
+                                                     {
+            for (int i = 0; i < num_connections; i++)
+            {
+                const int data_socket = connect_to_server();
+                assert(data_socket != -1);
+                const ssize_t w = write(data_socket, "1", 2);
+                assert(w == 2);
+                data_sockets.push_back(data_socket);
+            } });
+
+        const double finish_seconds = seconds_taken([&]()
+                                                    {
+            for (auto &&data_socket : data_sockets)
+            {
+                const ssize_t w = write(data_socket, "END", 4);
+                assert(w == 4);
+            }
+            for (auto &&data_socket : data_sockets)
+            {
+                char buffer[BUFFER_SIZE];
+                const ssize_t r = read(data_socket, buffer, sizeof(buffer));
+                assert(r == sizeof(buffer) && std::string(buffer) == "1");
+                close(data_socket);
+            } });
+
+        shut_down_server(pid);
+
+        std::cout << "man7_server_epoll\t" << num_connections << '\t' << connect_seconds << '\t' << finish_seconds << '\n';
+
+        const int num_clients = 8;
+        const int num_connections_per_client = 2000;
+        const int num_summands = 10;
+
+        std::cout << "server\tnum_workers\tnum_clients\tconnections_per_second\trequests_per_second\n";
+        benchmark_server("man7_server_epoll", man7_server_epoll::man7_server_epoll_main, 1, num_clients, num_connections_per_client, num_summands);
+    }
+};
+
+#endif // SANDBOX_MAN7_SERVER_BENCHMARK
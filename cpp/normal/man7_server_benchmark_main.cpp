@@ -0,0 +1,8 @@
+#include "man7_server_benchmark.hpp"
+
+int main()
+{
+    man7_server_benchmark::benchmark_server_pool();
+    man7_server_benchmark::benchmark_server_epoll();
+    return 0;
+}
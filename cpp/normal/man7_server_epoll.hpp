@@ -0,0 +1,263 @@
+#ifndef SANDBOX_CPP_MAN7_SERVER_EPOLL
+#define SANDBOX_CPP_MAN7_SERVER_EPOLL
+
+// For accept4()
+#include "man7_gnu_source.hpp"
+
+#include "man7_connection.hpp"
+#include "man7_server_session.hpp"
+#include "man7_server_socket.hpp"
+
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <cerrno>
+#include <memory>
+#include <string>
+#include <vector>
+
+// man7_server::man7_server_main() as one edge-triggered epoll event loop, so that thousands
+// of clients, idle or slow, can be connected at once. The socket name and protocol are the
+// same, so man7_client works unchanged.
+//
+// Every socket is non-blocking. Each connection has its own state machine: it reads
+// packets into its man7_server_session until "END", then writes the reply (waiting for
+// the socket to become writable if it has to), then closes. After the connection with
+// "DOWN" has been replied to, the server closes every connection and returns.
+class man7_server_epoll
+{
+private:
+    // https://www.man7.org/linux/man-pages/man7/epoll.7.html
+    // https://www.man7.org/linux/man-pages/man2/epoll_ctl.2.html
+    // https://www.man7.org/linux/man-pages/man2/epoll_wait.2.html
+    // https://www.man7.org/linux/man-pages/man2/accept4.2.html
+    // "Edge-triggered" means that each socket is read (or accepted on) until EAGAIN,
+    // because no further event comes until new data does.
+
+    static const int MAX_NUM_EVENTS = 256;
+
+    class connection final
+    {
+    public:
+        enum class state
+        {
+            READING,
+            WRITING,
+        };
+
+        state current_state = state::READING;
+        man7_server_session session;
+        char buffer[BUFFER_SIZE];
+    };
+
+    // Indexed by file descriptor, which the kernel keeps small.
+    typedef std::vector<std::unique_ptr<connection>> connection_table;
+
+    enum class outcome
+    {
+        WAITING,
+        CLOSED,
+        DOWN,
+    };
+
+    static void close_connection(connection_table &connections, int fd)
+    {
+        // Closing the socket also takes it out of the epoll set.
+        close(fd);
+        connections[fd].reset();
+    }
+
+    // Accept every pending connection. Returns false if accept4() fails for a reason other
+    // than running out of connections or file descriptors. Sets `out_of_fds` if it ran out
+    // of file descriptors: the rest wait in the backlog, and since the connection socket is
+    // edge-triggered, no event comes for them, so accept_all() must be called again once a
+    // connection has closed.
+    static bool accept_all(int epoll_fd, int connection_socket, connection_table &connections, bool &out_of_fds)
+    {
+        out_of_fds = false;
+        for (;;)
+        {
+            const int data_socket = accept4(connection_socket, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (data_socket == -1)
+            {
+                if (errno == EINTR || errno == ECONNABORTED)
+                {
+                    continue;
+                }
+                if (errno == EAGAIN || errno == EWOULDBLOCK)
+                {
+                    return true;
+                }
+                man7_connection::write_function_results(__func__, "accept4", data_socket, errno);
+
+                out_of_fds = (errno == EMFILE || errno == ENFILE);
+                return out_of_fds;
+            }
+
+            epoll_event event;
+            event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+            event.data.fd = data_socket;
+            if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, data_socket, &event) == -1)
+            {
+                man7_connection::write_function_results(__func__, "epoll_ctl", -1, errno);
+                close(data_socket);
+                continue;
+            }
+
+            if (static_cast<size_t>(data_socket) >= connections.size())
+            {
+                connections.resize(static_cast<size_t>(data_socket) * 2);
+            }
+            connections[data_socket].reset(new connection());
+        }
+    }
+
+    // Advance one connection's state machine as far as its socket allows.
+    static outcome advance(connection &c, int data_socket)
+    {
+        while (c.current_state == connection::state::READING)
+        {
+            const ssize_t r = read(data_socket, c.buffer, sizeof(c.buffer));
+            if (r == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return (errno == EAGAIN || errno == EWOULDBLOCK) ? outcome::WAITING : outcome::CLOSED;
+            }
+            if (r == 0)
+            {
+                // Closed before "END"
+                return outcome::CLOSED;
+            }
+            if (c.session.handle_packet(c.buffer, static_cast<size_t>(r)))
+            {
+                c.session.get_reply(c.buffer);
+                c.current_state = connection::state::WRITING;
+            }
+        }
+
+        // A SOCK_SEQPACKET write sends the whole packet or nothing.
+        ssize_t w;
+        do
+        {
+            w = write(data_socket, c.buffer, sizeof(c.buffer));
+        } while (w == -1 && errno == EINTR);
+        if (w == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            return outcome::WAITING;
+        }
+        return c.session.is_down() ? outcome::DOWN : outcome::CLOSED;
+    }
+
+public:
+    // Returns 0 after "DOWN", otherwise nonzero with errno set.
+    static int man7_server_epoll_main(void)
+    {
+        int errnum = 0;
+
+        const int connection_socket = man7_server_socket::open_connection_socket(__func__, SOMAXCONN, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (connection_socket == -1)
+        {
+            return 1;
+        }
+
+        errno = 0;
+        const int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        errnum = errno;
+        man7_connection::write_function_results(__func__, "epoll_create1", epoll_fd, errnum);
+
+        if (epoll_fd == -1)
+        {
+            man7_server_socket::close_connection_socket(__func__, connection_socket);
+            return 2;
+        }
+
+        epoll_event event;
+        event.events = EPOLLIN | EPOLLET;
+        event.data.fd = connection_socket;
+        if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, connection_socket, &event) == -1)
+        {
+            man7_connection::write_function_results(__func__, "epoll_ctl", -1, errno);
+            man7_connection::close_without_changing_errno(__func__, epoll_fd);
+            man7_server_socket::close_connection_socket(__func__, connection_socket);
+            return 3;
+        }
+
+        connection_table connections(1024);
+        epoll_event events[MAX_NUM_EVENTS];
+        int return_value = -1;
+        bool accept_waits_for_close = false;
+
+        while (return_value == -1)
+        {
+            const int num_events = epoll_wait(epoll_fd, events, MAX_NUM_EVENTS, -1);
+            if (num_events == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                man7_connection::write_function_results(__func__, "epoll_wait", num_events, errno);
+                return_value = 4;
+                break;
+            }
+
+            for (int i = 0; i < num_events && return_value == -1; i++)
+            {
+                const int fd = events[i].data.fd;
+
+                if (fd == connection_socket)
+                {
+                    if (!accept_all(epoll_fd, connection_socket, connections, accept_waits_for_close))
+                    {
+                        return_value = 5;
+                    }
+                    continue;
+                }
+
+                // A connection closed earlier in this batch
+                if (!connections[fd])
+                {
+                    continue;
+                }
+
+                switch (advance(*connections[fd], fd))
+                {
+                case outcome::WAITING:
+                    break;
+                case outcome::CLOSED:
+                    close_connection(connections, fd);
+                    // A file descriptor is free for the connections left in the backlog.
+                    if (accept_waits_for_close && !accept_all(epoll_fd, connection_socket, connections, accept_waits_for_close))
+                    {
+                        return_value = 5;
+                    }
+                    break;
+                case outcome::DOWN:
+                    close_connection(connections, fd);
+                    return_value = 0;
+                    break;
+                }
+            }
+        }
+
+        const int errnum_2 = errno;
+        for (size_t fd = 0; fd < connections.size(); fd++)
+        {
+            if (connections[fd])
+            {
+                close_connection(connections, static_cast<int>(fd));
+            }
+        }
+        man7_connection::close_without_changing_errno(__func__, epoll_fd);
+        man7_server_socket::close_connection_socket(__func__, connection_socket);
+
+        errno = (return_value == 0) ? 0 : errnum_2;
+        return return_value;
+    }
+};
+
+#endif // SANDBOX_CPP_MAN7_SERVER_EPOLL
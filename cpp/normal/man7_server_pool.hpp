@@ -0,0 +1,180 @@
+#ifndef SANDBOX_CPP_MAN7_SERVER_POOL
+#define SANDBOX_CPP_MAN7_SERVER_POOL
+
+#include "man7_connection.hpp"
+#include "man7_server_session.hpp"
+#include "man7_server_socket.hpp"
+
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <string>
+#include <vector>
+
+// man7_server::man7_server_main() with its listening socket shared by `num_workers`
+// pre-forked worker processes, so that up to `num_workers` clients are served at once
+// instead of waiting in the listen backlog.
+//
+// Each worker accepts and serves connections on its own, with the same protocol (see
+// man7_server_session). A worker exits after the connection on which it gets "DOWN", and
+// then the parent stops the other workers, closes the listening socket and unlinks it.
+// Unlike man7_server_main(), nothing is written per packet, so that the logging does not
+// set the pace.
+class man7_server_pool
+{
+private:
+    // https://www.man7.org/linux/man-pages/man2/accept.2.html
+    // https://www.man7.org/linux/man-pages/man2/read.2.html
+    // https://www.man7.org/linux/man-pages/man2/write.2.html
+    // https://www.man7.org/linux/man-pages/man2/fork.2.html
+    // https://www.man7.org/linux/man-pages/man2/kill.2.html
+    // https://www.man7.org/linux/man-pages/man2/wait.2.html
+
+    static const int BACKLOG = 128;
+
+    // Serve one connection until "END". Returns false if the connection failed or was
+    // closed before "END".
+    static bool serve_connection(int data_socket, man7_server_session &session)
+    {
+        char buffer[BUFFER_SIZE];
+
+        for (;;)
+        {
+            const ssize_t r = read(data_socket, buffer, sizeof(buffer));
+            if (r == -1 && errno == EINTR)
+            {
+                continue;
+            }
+            if (r <= 0)
+            {
+                return false;
+            }
+            if (session.handle_packet(buffer, static_cast<size_t>(r)))
+            {
+                break;
+            }
+        }
+
+        session.get_reply(buffer);
+
+        ssize_t w;
+        do
+        {
+            w = write(data_socket, buffer, sizeof(buffer));
+        } while (w == -1 && errno == EINTR);
+        return w != -1;
+    }
+
+    // Returns the worker's exit status: 0 after "DOWN", or 4 if accept() fails.
+    static int work(int connection_socket)
+    {
+        for (;;)
+        {
+            const int data_socket = accept(connection_socket, NULL, NULL);
+            if (data_socket == -1)
+            {
+                // The connection was reset before it was accepted.
+                if (errno == EINTR || errno == ECONNABORTED)
+                {
+                    continue;
+                }
+                man7_connection::write_function_results(__func__, "accept", data_socket, errno);
+                return 4;
+            }
+
+            man7_server_session session;
+            serve_connection(data_socket, session);
+            close(data_socket);
+
+            if (session.is_down())
+            {
+                return 0;
+            }
+        }
+    }
+
+public:
+    // Returns 0 if the pool was shut down with "DOWN", otherwise nonzero with errno set.
+    static int man7_server_pool_main(int num_workers)
+    {
+        int errnum = 0;
+
+        if (num_workers < 1)
+        {
+            errno = EINVAL;
+            return 1;
+        }
+
+        const int connection_socket = man7_server_socket::open_connection_socket(__func__, BACKLOG);
+        if (connection_socket == -1)
+        {
+            return 2;
+        }
+
+        std::vector<pid_t> worker_pids;
+        for (int i = 0; i < num_workers; i++)
+        {
+            errno = 0;
+            const pid_t pid = fork();
+            errnum = errno;
+
+            if (pid == 0)
+            {
+                exit(work(connection_socket));
+            }
+
+            man7_connection::write_function_results(__func__, "fork", pid, errnum);
+
+            if (pid < 0)
+            {
+                break;
+            }
+            worker_pids.push_back(pid);
+        }
+
+        // Wait for the first worker to exit, which it does after "DOWN" (or a failure of
+        // fork() above, or of accept()). Then stop the rest.
+        int return_value = 3;
+        if (worker_pids.size() == static_cast<size_t>(num_workers))
+        {
+            int wstatus = 0;
+            pid_t pid;
+            do
+            {
+                errno = 0;
+                pid = wait(&wstatus);
+                errnum = errno;
+            } while (pid == -1 && errnum == EINTR);
+            man7_connection::write_function_results(__func__, "wait", pid, errnum);
+
+            if (pid != -1)
+            {
+                return_value = (WIFEXITED(wstatus) && WEXITSTATUS(wstatus) == 0) ? 0 : 4;
+                worker_pids.erase(std::find(worker_pids.begin(), worker_pids.end(), pid));
+            }
+        }
+
+        for (auto &&pid : worker_pids)
+        {
+            kill(pid, SIGTERM);
+        }
+        for (auto &&pid : worker_pids)
+        {
+            while (waitpid(pid, NULL, 0) == -1 && errno == EINTR)
+            {
+            }
+        }
+
+        man7_server_socket::close_connection_socket(__func__, connection_socket);
+
+        errno = (return_value == 0) ? 0 : ECHILD;
+        return return_value;
+    }
+};
+
+#endif // SANDBOX_CPP_MAN7_SERVER_POOL
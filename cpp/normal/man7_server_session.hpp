@@ -0,0 +1,74 @@
+// The protocol of the "File server.c" section of https://www.man7.org/linux/man-pages/man7/unix.7.html
+
+#ifndef SANDBOX_CPP_MAN7_SERVER_SESSION
+#define SANDBOX_CPP_MAN7_SERVER_SESSION
+
+#include "man7_connection.hpp"
+
+#include <stdio.h>
+#include <string.h>
+#include <cerrno>
+#include <string>
+#include <stdexcept>
+
+// One connection's state in the protocol of man7_server::man7_server_main(): each packet is
+// a number to add to the sum, "DOWN" (shut the server down after this connection, ignoring
+// any later numbers), or "END" (reply with the sum). Servers that handle many connections
+// at once keep one of these per connection, and feed it packets as they arrive.
+class man7_server_session final
+{
+private:
+    int result = 0;
+    bool down_flag = false;
+
+public:
+    // `buffer` holds a packet of `size` bytes, and is changed to be 0-terminated.
+    // Returns true if the packet is "END", after which the reply (see get_reply()) is due.
+    bool handle_packet(char (&buffer)[BUFFER_SIZE], size_t size)
+    {
+        // Ensure buffer is 0-terminated.
+        buffer[(size < sizeof(buffer)) ? size : (sizeof(buffer) - 1)] = 0;
+
+        if (!strncmp(buffer, "DOWN", sizeof(buffer)))
+        {
+            down_flag = true;
+            return false;
+        }
+
+        if (!strncmp(buffer, "END", sizeof(buffer)))
+        {
+            return true;
+        }
+
+        if (down_flag)
+        {
+            return false;
+        }
+
+        // As in man7_server::man7_server_main(), anything that is not a number counts as 0.
+        // https://en.cppreference.com/w/cpp/string/basic_string/stol
+        const int errnum = errno;
+        try
+        {
+            result += std::stoi(buffer);
+        }
+        catch (const std::logic_error &)
+        {
+        }
+        errno = errnum;
+        return false;
+    }
+
+    void get_reply(char (&buffer)[BUFFER_SIZE]) const
+    {
+        snprintf(buffer, sizeof(buffer), "%d", result);
+        buffer[sizeof(buffer) - 1] = 0;
+    }
+
+    bool is_down() const
+    {
+        return down_flag;
+    }
+};
+
+#endif // SANDBOX_CPP_MAN7_SERVER_SESSION
@@ -0,0 +1,82 @@
+// Adapted from the "File server.c" section of https://www.man7.org/linux/man-pages/man7/unix.7.html
+
+#ifndef SANDBOX_CPP_MAN7_SERVER_SOCKET
+#define SANDBOX_CPP_MAN7_SERVER_SOCKET
+
+#include "man7_connection.hpp"
+
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cerrno>
+#include <string>
+
+// The listening socket of man7_server::man7_server_main(), for the servers that share its
+// socket name and protocol.
+class man7_server_socket final
+{
+public:
+    // https://www.man7.org/linux/man-pages/man2/socket.2.html
+    // https://www.man7.org/linux/man-pages/man2/bind.2.html
+    // https://www.man7.org/linux/man-pages/man2/listen.2.html
+    // Returns the listening socket, or -1 with errno set. `type_flags` is or'ed into
+    // SOCK_SEQPACKET (for example, SOCK_NONBLOCK).
+    static int open_connection_socket(const std::string &name_of_calling_function, int backlog, int type_flags = 0)
+    {
+        int errnum = 0;
+
+        errno = 0;
+        const int connection_socket = socket(AF_UNIX, SOCK_SEQPACKET | type_flags, 0);
+        errnum = errno;
+        man7_connection::write_function_results(name_of_calling_function, "socket", connection_socket, errnum);
+
+        if (connection_socket == -1)
+        {
+            return -1;
+        }
+
+        sockaddr_un name;
+        memset(&name, 0, sizeof(name));
+        name.sun_family = AF_UNIX;
+        strncpy(name.sun_path, SOCKET_NAME, sizeof(name.sun_path) - 1);
+        name.sun_path[sizeof(name.sun_path) - 1] = 0;
+
+        errno = 0;
+        int ret = bind(connection_socket, (const sockaddr *)&name, sizeof(name));
+        errnum = errno;
+        man7_connection::write_function_results(name_of_calling_function, "bind", ret, errnum);
+
+        if (ret == -1)
+        {
+            close_connection_socket(name_of_calling_function, connection_socket);
+            return -1;
+        }
+
+        errno = 0;
+        ret = listen(connection_socket, backlog);
+        errnum = errno;
+        man7_connection::write_function_results(name_of_calling_function, "listen", ret, errnum);
+
+        if (ret == -1)
+        {
+            close_connection_socket(name_of_calling_function, connection_socket);
+            return -1;
+        }
+
+        return connection_socket;
+    }
+
+    // https://www.man7.org/linux/man-pages/man3/unlink.3p.html
+    // Close the listening socket and unlink its name. Don't change errno.
+    static void close_connection_socket(const std::string &name_of_calling_function, int connection_socket)
+    {
+        const int errnum = errno;
+        man7_connection::close_without_changing_errno(name_of_calling_function, connection_socket);
+        unlink(SOCKET_NAME);
+        errno = errnum;
+    }
+};
+
+#endif // SANDBOX_CPP_MAN7_SERVER_SOCKET
@@ -3,8 +3,15 @@
 
 #include "man7_client.hpp"
 #include "man7_server.hpp"
+#include "man7_server_pool.hpp"
+#include "man7_server_epoll.hpp"
 #include "cpp_waitpid.hpp"
 
+#include <sys/resource.h>
+#include <sys/time.h>
+
+#include <cassert>
+
 class man7_test
 {
 private:
@@ -75,6 +82,33 @@ private:
         return man7_client_main_fork(argc, argv);
     }
 
+    // https://www.man7.org/linux/man-pages/man2/connect.2.html
+    // A connection to the server, on which nothing has been sent yet, or -1. Like
+    // man7_client::man7_client_main(), wait for the server to start listening.
+    static int connect_to_server()
+    {
+        sockaddr_un addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        strncpy(addr.sun_path, SOCKET_NAME, sizeof(addr.sun_path) - 1);
+
+        for (int num_tries_left = 5; num_tries_left > 0; num_tries_left--)
+        {
+            const int data_socket = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+            if (data_socket == -1)
+            {
+                return -1;
+            }
+            if (connect(data_socket, (const sockaddr *)&addr, sizeof(addr)) == 0)
+            {
+                return data_socket;
+            }
+            close(data_socket);
+            sleep(1);
+        }
+        return -1;
+    }
+
 public:
     // Adapted from the "Example output" section of https://www.man7.org/linux/man-pages/man7/unix.7.html
     // https://www.man7.org/linux/man-pages/man2/fork.2.html
@@ -131,6 +165,186 @@ public:
             man7_connection::write_function_results(__func__, "waitpid_special", waitpid_special_result, errnum);
         }
     }
+
+private:
+    // Based on man7_test::test_man7()
+    // One client holds a connection open in the middle of its sum, and the other clients
+    // are served in the meantime.
+    static void test_concurrent_server(const char *name_of_server_main, int (*server_main)())
+    {
+        int errnum = 0;
+
+        errno = 0;
+        const pid_t pid_server = fork();
+        errnum = errno;
+
+        if (pid_server < 0)
+        {
+            man7_connection::write_function_results(__func__, "fork (error)", pid_server, errnum);
+        }
+        else if (pid_server == 0)
+        {
+            errno = 0;
+            int server_result = server_main();
+            errnum = errno;
+            man7_connection::write_function_results(__func__, name_of_server_main, server_result, errnum);
+
+            exit(server_result);
+        }
+        else
+        {
+            man7_connection::write_function_results(__func__, "fork (parent process)", pid_server, errnum);
+
+            const int held_socket = connect_to_server();
+            assert(held_socket != -1);
+            ssize_t w = write(held_socket, "40", 3);
+            assert(w == 3);
+
+            int call_1_result = man7_client_main_fork_call_1();
+            man7_connection::write_function_results(__func__, "man7_client_main_fork_call_1", call_1_result, errno);
+            assert(call_1_result == 0);
+
+            int call_2_result = man7_client_main_fork_call_2();
+            man7_connection::write_function_results(__func__, "man7_client_main_fork_call_2", call_2_result, errno);
+            assert(call_2_result == 0);
+
+            char buffer[BUFFER_SIZE];
+            w = write(held_socket, "2", 2);
+            assert(w == 2);
+            w = write(held_socket, "END", 4);
+            assert(w == 4);
+            const ssize_t r = read(held_socket, buffer, sizeof(buffer));
+            assert(r == sizeof(buffer));
+            assert(std::string(buffer) == "42");
+            man7_connection::close_without_changing_errno(__func__, held_socket);
+
+            int call_3_result = man7_client_main_fork_call_3();
+            man7_connection::write_function_results(__func__, "man7_client_main_fork_call_3", call_3_result, errno);
+            assert(call_3_result == 0);
+
+            errno = 0;
+            int waitpid_special_result = cpp_waitpid::waitpid_special(pid_server);
+            errnum = errno;
+
+            man7_connection::write_function_results(__func__, "waitpid_special", waitpid_special_result, errnum);
+            assert(waitpid_special_result == 0);
+        }
+    }
+
+    static int man7_server_pool_main_with_3_workers()
+    {
+        return man7_server_pool::man7_server_pool_main(3);
+    }
+
+public:
+    static void test_man7_server_pool()
+    {
+        test_concurrent_server("man7_server_pool_main", man7_server_pool_main_with_3_workers);
+    }
+
+    static void test_man7_server_epoll()
+    {
+        test_concurrent_server("man7_server_epoll_main", man7_server_epoll::man7_server_epoll_main);
+    }
+
+private:
+    // https://www.man7.org/linux/man-pages/man2/getrlimit.2.html
+    // man7_server_epoll::man7_server_epoll_main(), with only enough file descriptors for its
+    // connection socket, its epoll instance, and one connection.
+    static int man7_server_epoll_main_with_3_fds()
+    {
+        // The lowest 3 that are free: the server gets those, and no other.
+        int fds[3];
+        for (auto &&fd : fds)
+        {
+            fd = dup(STDERR_FILENO);
+        }
+        for (const int fd : fds)
+        {
+            close(fd);
+        }
+
+        rlimit limit;
+        getrlimit(RLIMIT_NOFILE, &limit);
+        limit.rlim_cur = static_cast<rlim_t>(fds[2]) + 1;
+        if (fds[2] == -1 || setrlimit(RLIMIT_NOFILE, &limit) == -1)
+        {
+            return 100;
+        }
+        return man7_server_epoll::man7_server_epoll_main();
+    }
+
+public:
+    // A connection that waits in the backlog while the server is out of file descriptors
+    // is accepted once another connection closes, without a new connection to wake it.
+    static void test_man7_server_epoll_out_of_fds()
+    {
+        int errnum = 0;
+
+        errno = 0;
+        const pid_t pid_server = fork();
+        errnum = errno;
+
+        if (pid_server < 0)
+        {
+            man7_connection::write_function_results(__func__, "fork (error)", pid_server, errnum);
+        }
+        else if (pid_server == 0)
+        {
+            errno = 0;
+            int server_result = man7_server_epoll_main_with_3_fds();
+            errnum = errno;
+            man7_connection::write_function_results(__func__, "man7_server_epoll_main_with_3_fds", server_result, errnum);
+
+            exit(server_result);
+        }
+        else
+        {
+            man7_connection::write_function_results(__func__, "fork (parent process)", pid_server, errnum);
+
+            const int held_socket = connect_to_server();
+            assert(held_socket != -1);
+            ssize_t w = write(held_socket, "40", 3);
+            assert(w == 3);
+
+            // The server has no file descriptor left to accept this one with.
+            const int waiting_socket = connect_to_server();
+            assert(waiting_socket != -1);
+            const timeval timeout = {5, 0};
+            const int setsockopt_result = setsockopt(waiting_socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+            assert(setsockopt_result == 0);
+            w = write(waiting_socket, "5", 2);
+            assert(w == 2);
+            w = write(waiting_socket, "END", 4);
+            assert(w == 4);
+
+            char buffer[BUFFER_SIZE];
+            w = write(held_socket, "2", 2);
+            assert(w == 2);
+            w = write(held_socket, "END", 4);
+            assert(w == 4);
+            ssize_t r = read(held_socket, buffer, sizeof(buffer));
+            assert(r == sizeof(buffer));
+            assert(std::string(buffer) == "42");
+            man7_connection::close_without_changing_errno(__func__, held_socket);
+
+            r = read(waiting_socket, buffer, sizeof(buffer));
+            assert(r == sizeof(buffer));
+            assert(std::string(buffer) == "5");
+            man7_connection::close_without_changing_errno(__func__, waiting_socket);
+
+            int call_3_result = man7_client_main_fork_call_3();
+            man7_connection::write_function_results(__func__, "man7_client_main_fork_call_3", call_3_result, errno);
+            assert(call_3_result == 0);
+
+            errno = 0;
+            int waitpid_special_result = cpp_waitpid::waitpid_special(pid_server);
+            errnum = errno;
+
+            man7_connection::write_function_results(__func__, "waitpid_special", waitpid_special_result, errnum);
+            assert(waitpid_special_result == 0);
+        }
+    }
 };
 
 #endif // SANDBOX_MAN7_TEST
@@ -3,5 +3,8 @@
 int main(int argc, char const *argv[])
 {
     man7_test::test_man7();
+    man7_test::test_man7_server_pool();
+    man7_test::test_man7_server_epoll();
+    man7_test::test_man7_server_epoll_out_of_fds();
     return 0;
 }
@@ -0,0 +1,709 @@
+#ifndef SANDBOX_CPP_MAN7_UDP_ECHO
+#define SANDBOX_CPP_MAN7_UDP_ECHO
+
+// For recvmmsg() and sendmmsg()
+#include "man7_gnu_source.hpp"
+
+#include "man7_connection.hpp"
+#include "man7_io_uring.hpp"
+
+#include <fcntl.h>
+#include <netinet/udp.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <vector>
+
+// The echo loop of man7_getaddrinfo_example_server::man7_getaddrinfo_example_server_main(),
+// without a line of output per datagram, on a bound UDP socket that it does not own. It
+// runs until request_stop() is called, or until no datagram has come for
+// `idle_timeout_ms`.
+//
+// With backend::EPOLL, the socket is made non-blocking, and each wakeup of epoll_wait()
+// is followed by recvfrom() and sendto() until recvfrom() runs dry.
+//
+// With backend::MMSG, each wakeup is instead followed by recvmmsg() of up to `num_slots`
+// datagrams at once, each into its own slot's buffer and peer address, and sendmmsg() of
+// them all back from the same slots: the iovecs are only cut down to the lengths received,
+// and the peer addresses are used as they are. That goes on while a batch comes back full.
+// With `gro`, a receive can bring many datagrams from one peer at once, coalesced by the
+// kernel, with their size in a UDP_GRO control message; and with `gso`, the replies to one
+// peer that are all of one size (but the last) go in one message with a UDP_SEGMENT control
+// message, for the kernel to cut up. Without `gso`, the coalesced datagrams are replied to
+// one by one.
+//
+// With backend::IO_URING, `num_slots` receives are always in flight, each into its own
+// buffer and peer address. When one completes, the reply and the slot's next receive are
+// submitted as a linked pair, so the receive starts only once the reply has left the
+// buffer; and all of that for every slot that completed goes in one io_uring_enter()
+// call, which also waits for the next completions. If the kernel cannot run it (see
+// man7_io_uring::is_supported()), start() falls back to backend::EPOLL.
+class man7_udp_echo final
+{
+private:
+    // https://www.man7.org/linux/man-pages/man7/epoll.7.html
+    // https://www.man7.org/linux/man-pages/man2/recvmsg.2.html
+    // https://www.man7.org/linux/man-pages/man2/recvmmsg.2.html
+    // https://www.man7.org/linux/man-pages/man2/sendmmsg.2.html
+    // https://www.man7.org/linux/man-pages/man7/udp.7.html ("UDP_SEGMENT", "UDP_GRO")
+    // https://www.man7.org/linux/man-pages/man3/cmsg.3.html
+    // https://www.man7.org/linux/man-pages/man3/io_uring_prep_recvmsg.3.html
+    // https://www.man7.org/linux/man-pages/man3/io_uring_prep_link_timeout.3.html ("IOSQE_IO_LINK")
+
+public:
+    enum class backend
+    {
+        EPOLL,
+        IO_URING,
+        MMSG,
+    };
+
+    class options final
+    {
+    public:
+        backend requested_backend = backend::EPOLL;
+
+        // -1 means no limit.
+        int idle_timeout_ms = -1;
+
+        // Longer datagrams are cut short.
+        size_t max_datagram_size = 2048;
+
+        // For backend::IO_URING: the number of receives in flight. For backend::MMSG: the
+        // most datagrams received (and sent back) with one system call.
+        unsigned num_slots = 64;
+
+        // For backend::MMSG: receive coalesced datagrams (UDP_GRO), if the kernel lets
+        // the socket, and send coalesced replies (UDP_SEGMENT).
+        bool gro = false;
+        bool gso = false;
+    };
+
+private:
+    static const int MAX_NUM_EVENTS = 2;
+
+    // What one receive can bring with GRO, and what one send can take with GSO: a UDP
+    // datagram's most (with the IPv6 and UDP headers), and the segments that older kernels
+    // take at most (UDP_MAX_SEGMENTS).
+    static const size_t MAX_COALESCED_SIZE = 65535;
+    static const size_t MAX_GSO_SIZE = 65535 - 40 - 8;
+    static const size_t MAX_GSO_SEGMENTS = 64;
+
+    // user_data of the poll of `stop_fd`, and of the cancellation of the receives in flight
+    // (see finish_io_uring()). Slots have `(index << 1) | op` instead.
+    static const uint64_t STOP_TAG = UINT64_MAX;
+    static const uint64_t CANCEL_TAG = UINT64_MAX - 1;
+
+    enum op
+    {
+        RECEIVE = 0,
+        REPLY = 1,
+    };
+
+    // For backend::IO_URING and backend::MMSG: one datagram's buffer, and the messages that
+    // receive it and send it back, which share the buffer and the peer address. (MMSG uses
+    // `receive_msg` for both.)
+    class slot final
+    {
+    public:
+        std::vector<char> buffer;
+        sockaddr_storage peer_addr;
+        iovec receive_iov;
+        iovec reply_iov;
+        msghdr receive_msg;
+        msghdr reply_msg;
+
+        // For the UDP_GRO control message
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+    };
+
+    // For backend::MMSG with `gro` or `gso`: a reply, made of `num_iovs` pieces (from
+    // `first_iov` in `reply_iovs`) of received datagrams, to the peer of slot `index`.
+    // With more than one segment, it goes with a UDP_SEGMENT control message.
+    class reply final
+    {
+    public:
+        size_t index;
+        size_t first_iov;
+        size_t num_iovs;
+        size_t num_bytes;
+        size_t segment_size;
+        size_t num_segments;
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(uint16_t))];
+    };
+
+private:
+    int sfd;
+    options opts;
+    backend the_backend = backend::EPOLL;
+
+    int stop_fd = -1;
+    int epoll_fd = -1;
+    man7_io_uring uring;
+    std::vector<slot> slots;
+
+    // For backend::IO_URING: the slots' operations that have not completed yet
+    unsigned num_in_flight = 0;
+
+    // For backend::MMSG: `slots[i].receive_msg`, in a row
+    std::vector<mmsghdr> messages;
+
+    // For backend::MMSG with `gro` or `gso`
+    bool gro_enabled = false;
+    std::vector<reply> replies;
+    std::vector<iovec> reply_iovs;
+    std::vector<mmsghdr> reply_messages;
+
+    uint64_t num_datagrams = 0;
+    uint64_t num_syscalls = 0;
+
+public:
+    man7_udp_echo(int the_sfd, const options &the_options) : sfd(the_sfd), opts(the_options)
+    {
+    }
+
+    man7_udp_echo(const man7_udp_echo &) = delete;
+    man7_udp_echo &operator=(const man7_udp_echo &) = delete;
+
+    ~man7_udp_echo()
+    {
+        uring.close_ring();
+        for (int fd : {epoll_fd, stop_fd})
+        {
+            if (fd != -1)
+            {
+                close(fd);
+            }
+        }
+    }
+
+    // Returns 0, or -1 with errno set.
+    int start()
+    {
+        int errnum = 0;
+
+        errno = 0;
+        stop_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        errnum = errno;
+        man7_connection::write_function_results(__func__, "eventfd", stop_fd, errnum);
+        if (stop_fd == -1)
+        {
+            return -1;
+        }
+
+        if (opts.requested_backend == backend::IO_URING)
+        {
+            errno = 0;
+            const int init_result = man7_io_uring::is_supported() ? uring.init(2 * opts.num_slots + 1) : -1;
+            errnum = errno;
+            man7_connection::write_function_results(__func__, "man7_io_uring::init", init_result, errnum);
+            if (init_result == 0)
+            {
+                the_backend = backend::IO_URING;
+                return 0;
+            }
+            man7_connection::write_str("io_uring is not available, falling back to epoll");
+        }
+
+        the_backend = (opts.requested_backend == backend::MMSG) ? backend::MMSG : backend::EPOLL;
+
+        if (the_backend == backend::MMSG && opts.gro)
+        {
+            const int yes = 1;
+            errno = 0;
+            const int setsockopt_result = setsockopt(sfd, SOL_UDP, UDP_GRO, &yes, sizeof(yes));
+            errnum = errno;
+            man7_connection::write_function_results(__func__, "setsockopt", setsockopt_result, errnum);
+            // Without it, datagrams simply come one by one.
+            gro_enabled = (setsockopt_result == 0);
+        }
+
+        errno = 0;
+        epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        errnum = errno;
+        man7_connection::write_function_results(__func__, "epoll_create1", epoll_fd, errnum);
+
+        if (epoll_fd == -1 || fcntl(sfd, F_SETFL, fcntl(sfd, F_GETFL) | O_NONBLOCK) == -1 || !add_to_epoll(sfd) || !add_to_epoll(stop_fd))
+        {
+            return -1;
+        }
+        return 0;
+    }
+
+    // The backend that start() settled on
+    backend get_backend() const
+    {
+        return the_backend;
+    }
+
+    // Make run() return. Safe to call from another thread, or from a signal handler.
+    void request_stop()
+    {
+        const uint64_t one = 1;
+        const int errnum = errno;
+        if (write(stop_fd, &one, sizeof(one)) == -1)
+        {
+            // The counter is full, so a stop is pending anyway.
+        }
+        errno = errnum;
+    }
+
+    // Echo until request_stop() is called, or until the socket has been idle for
+    // `idle_timeout_ms`. Returns 0, or -1 with errno set.
+    int run()
+    {
+        switch (the_backend)
+        {
+        case backend::IO_URING:
+            return run_io_uring();
+        case backend::MMSG:
+            return run_mmsg();
+        default:
+            return run_epoll();
+        }
+    }
+
+    // The datagrams received, counting each of those coalesced by GRO
+    uint64_t get_num_datagrams() const
+    {
+        return num_datagrams;
+    }
+
+    // The size of the datagrams that a receive of `length` bytes into `msg` brought, as
+    // its UDP_GRO control message says, or `length` (one datagram) if it has none. All of
+    // them are that size but the last, which may be shorter.
+    static size_t segment_size_of(msghdr &msg, size_t length)
+    {
+        for (cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg))
+        {
+            if (cmsg->cmsg_level == SOL_UDP && cmsg->cmsg_type == UDP_GRO)
+            {
+                int segment_size;
+                memcpy(&segment_size, CMSG_DATA(cmsg), sizeof(segment_size));
+                if (segment_size > 0)
+                {
+                    return static_cast<size_t>(segment_size);
+                }
+            }
+        }
+        return length;
+    }
+
+    // The number of system calls that run() made for I/O
+    uint64_t get_num_syscalls() const
+    {
+        return num_syscalls + uring.get_num_enters();
+    }
+
+private:
+    bool add_to_epoll(int fd)
+    {
+        epoll_event event;
+        memset(&event, 0, sizeof(event));
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        return epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) == 0;
+    }
+
+    // Wait until the socket is readable. Returns 1, or 0 (with errno 0) if a stop was
+    // requested or the socket has been idle for `idle_timeout_ms`, or -1 with errno set.
+    int wait_for_datagrams()
+    {
+        epoll_event events[MAX_NUM_EVENTS];
+
+        for (;;)
+        {
+            num_syscalls++;
+            const int num_events = epoll_wait(epoll_fd, events, MAX_NUM_EVENTS, opts.idle_timeout_ms);
+            if (num_events == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                man7_connection::write_function_results(__func__, "epoll_wait", num_events, errno);
+                return -1;
+            }
+
+            for (int i = 0; i < num_events; i++)
+            {
+                if (events[i].data.fd == stop_fd)
+                {
+                    errno = 0;
+                    return 0;
+                }
+            }
+            errno = 0;
+            return (num_events == 0) ? 0 : 1;
+        }
+    }
+
+    int run_epoll()
+    {
+        std::vector<char> buffer(opts.max_datagram_size);
+
+        for (;;)
+        {
+            const int wait_result = wait_for_datagrams();
+            if (wait_result != 1)
+            {
+                return wait_result;
+            }
+
+            for (;;)
+            {
+                sockaddr_storage peer_addr;
+                socklen_t peer_addrlen = sizeof(peer_addr);
+                num_syscalls++;
+                const ssize_t nread = recvfrom(sfd, buffer.data(), buffer.size(), 0, (sockaddr *)&peer_addr, &peer_addrlen);
+                if (nread == -1)
+                {
+                    // EAGAIN, or a failed request to ignore
+                    break;
+                }
+                num_datagrams++;
+                num_syscalls++;
+                sendto(sfd, buffer.data(), nread, 0, (const sockaddr *)&peer_addr, peer_addrlen);
+            }
+        }
+    }
+
+    // Give every slot its buffer, and point its messages at the buffer and the peer address.
+    void make_slots()
+    {
+        slots.resize(opts.num_slots);
+        for (size_t i = 0; i < slots.size(); i++)
+        {
+            slot &s = slots[i];
+            s.buffer.resize((gro_enabled && opts.max_datagram_size < MAX_COALESCED_SIZE) ? MAX_COALESCED_SIZE : opts.max_datagram_size);
+            memset(&s.receive_msg, 0, sizeof(s.receive_msg));
+            s.receive_iov.iov_base = s.buffer.data();
+            s.receive_iov.iov_len = s.buffer.size();
+            s.receive_msg.msg_name = &s.peer_addr;
+            s.receive_msg.msg_namelen = sizeof(s.peer_addr);
+            s.receive_msg.msg_iov = &s.receive_iov;
+            s.receive_msg.msg_iovlen = 1;
+            s.reply_iov = s.receive_iov;
+            s.reply_msg = s.receive_msg;
+            s.reply_msg.msg_iov = &s.reply_iov;
+        }
+    }
+
+    // Whether the datagrams of slot `index`, `length` bytes in segments of `segment_size`,
+    // can go at the end of `r` under one UDP_SEGMENT: to the same peer, after nothing but
+    // full segments, and of the same size, or one shorter datagram to end with.
+    bool can_join(const reply &r, size_t index, size_t length, size_t segment_size) const
+    {
+        const msghdr &a = slots[r.index].receive_msg;
+        const msghdr &b = slots[index].receive_msg;
+        const bool same_size = (segment_size == r.segment_size) || (segment_size == length && length < r.segment_size);
+        const bool same_peer = a.msg_namelen == b.msg_namelen && memcmp(a.msg_name, b.msg_name, a.msg_namelen) == 0;
+        const bool room = r.num_bytes + length <= MAX_GSO_SIZE && r.num_segments + (length + segment_size - 1) / segment_size <= MAX_GSO_SEGMENTS;
+        return same_peer && same_size && room && r.num_bytes % r.segment_size == 0;
+    }
+
+    // The replies to the `num_received` messages received: with GSO, as few as can be;
+    // otherwise one per datagram, coalesced or not.
+    void build_replies(int num_received)
+    {
+        replies.clear();
+        reply_iovs.clear();
+        for (int i = 0; i < num_received; i++)
+        {
+            slot &s = slots[i];
+            const size_t length = messages[i].msg_len;
+            const size_t segment_size = segment_size_of(messages[i].msg_hdr, length);
+            const size_t num_segments = (segment_size == 0) ? 1 : (length + segment_size - 1) / segment_size;
+            num_datagrams += num_segments;
+
+            if (opts.gso && segment_size > 0)
+            {
+                if (replies.empty() || !can_join(replies.back(), i, length, segment_size))
+                {
+                    replies.push_back(reply{static_cast<size_t>(i), reply_iovs.size(), 0, 0, segment_size, 0, {}});
+                }
+                reply &r = replies.back();
+                reply_iovs.push_back(iovec{s.buffer.data(), length});
+                r.num_iovs++;
+                r.num_bytes += length;
+                r.num_segments += num_segments;
+                continue;
+            }
+
+            for (size_t offset = 0, k = 0; k < num_segments; offset += segment_size, k++)
+            {
+                const size_t segment_length = std::min(segment_size, length - offset);
+                replies.push_back(reply{static_cast<size_t>(i), reply_iovs.size(), 1, segment_length, segment_length, 1, {}});
+                reply_iovs.push_back(iovec{s.buffer.data() + offset, segment_length});
+            }
+        }
+
+        // Only now that `reply_iovs` has stopped growing can the messages point into it.
+        reply_messages.resize(replies.size());
+        for (size_t j = 0; j < replies.size(); j++)
+        {
+            reply &r = replies[j];
+            msghdr &msg = reply_messages[j].msg_hdr;
+            memset(&msg, 0, sizeof(msg));
+            msg.msg_name = slots[r.index].receive_msg.msg_name;
+            msg.msg_namelen = messages[r.index].msg_hdr.msg_namelen;
+            msg.msg_iov = &reply_iovs[r.first_iov];
+            msg.msg_iovlen = r.num_iovs;
+            if (r.num_segments > 1)
+            {
+                msg.msg_control = r.control;
+                msg.msg_controllen = sizeof(r.control);
+                cmsghdr *const cmsg = CMSG_FIRSTHDR(&msg);
+                cmsg->cmsg_level = SOL_UDP;
+                cmsg->cmsg_type = UDP_SEGMENT;
+                cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+                const uint16_t segment_size = static_cast<uint16_t>(r.segment_size);
+                memcpy(CMSG_DATA(cmsg), &segment_size, sizeof(segment_size));
+            }
+        }
+    }
+
+    // Send `n` messages from `batch`. Like a sendto() that fails, the ones that cannot be
+    // sent are dropped.
+    void send_batch(mmsghdr *batch, int n)
+    {
+        for (int num_sent = 0; num_sent < n;)
+        {
+            num_syscalls++;
+            const int sendmmsg_result = sendmmsg(sfd, batch + num_sent, static_cast<unsigned>(n - num_sent), 0);
+            if (sendmmsg_result <= 0)
+            {
+                break;
+            }
+            num_sent += sendmmsg_result;
+        }
+    }
+
+    int run_mmsg()
+    {
+        make_slots();
+        messages.resize(slots.size());
+        memset(messages.data(), 0, messages.size() * sizeof(mmsghdr));
+        const bool rebuild = gro_enabled || opts.gso;
+
+        for (;;)
+        {
+            const int wait_result = wait_for_datagrams();
+            if (wait_result != 1)
+            {
+                return wait_result;
+            }
+
+            for (;;)
+            {
+                for (size_t i = 0; i < slots.size(); i++)
+                {
+                    slots[i].receive_iov.iov_len = slots[i].buffer.size();
+                    slots[i].receive_msg.msg_namelen = sizeof(slots[i].peer_addr);
+                    if (gro_enabled)
+                    {
+                        slots[i].receive_msg.msg_control = slots[i].control;
+                        slots[i].receive_msg.msg_controllen = sizeof(slots[i].control);
+                    }
+                    messages[i].msg_hdr = slots[i].receive_msg;
+                }
+
+                num_syscalls++;
+                const int num_received = recvmmsg(sfd, messages.data(), static_cast<unsigned>(messages.size()), 0, NULL);
+                if (num_received <= 0)
+                {
+                    // EAGAIN, or a failed request to ignore
+                    break;
+                }
+
+                if (rebuild)
+                {
+                    // `can_join()` compares the peer addresses of the slots.
+                    for (int i = 0; i < num_received; i++)
+                    {
+                        slots[i].receive_msg.msg_namelen = messages[i].msg_hdr.msg_namelen;
+                    }
+                    build_replies(num_received);
+                    send_batch(reply_messages.data(), static_cast<int>(reply_messages.size()));
+                }
+                else
+                {
+                    // The replies go out from where the datagrams came in: only the lengths
+                    // change.
+                    num_datagrams += num_received;
+                    for (int i = 0; i < num_received; i++)
+                    {
+                        messages[i].msg_hdr.msg_iov->iov_len = messages[i].msg_len;
+                    }
+                    send_batch(messages.data(), num_received);
+                }
+
+                // A short batch means that the socket has run dry (for now), and epoll_wait()
+                // says when it has not.
+                if (num_received < static_cast<int>(messages.size()))
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    bool submit_receive(size_t index)
+    {
+        slot &s = slots[index];
+        s.receive_iov.iov_len = s.buffer.size();
+        s.receive_msg.msg_namelen = sizeof(s.peer_addr);
+
+        if (!uring.make_room(1))
+        {
+            return false;
+        }
+        io_uring_sqe *const sqe = uring.get_sqe();
+        man7_io_uring::prepare(sqe, IORING_OP_RECVMSG, sfd, &s.receive_msg, 1, index << 1 | RECEIVE);
+        num_in_flight++;
+        return true;
+    }
+
+    // The reply, linked to the next receive into the same slot
+    bool submit_reply(size_t index, size_t length)
+    {
+        slot &s = slots[index];
+        s.reply_iov.iov_len = length;
+        s.reply_msg.msg_namelen = s.receive_msg.msg_namelen;
+
+        if (!uring.make_room(2))
+        {
+            return false;
+        }
+        io_uring_sqe *const sqe = uring.get_sqe();
+        man7_io_uring::prepare(sqe, IORING_OP_SENDMSG, sfd, &s.reply_msg, 1, index << 1 | REPLY);
+        sqe->flags |= IOSQE_IO_LINK;
+        num_in_flight++;
+        return submit_receive(index);
+    }
+
+    // https://www.man7.org/linux/man-pages/man3/io_uring_prep_cancel_fd.3.html
+    // Cancel the slots' operations, wait for them to end, and close the ring. Closing the
+    // ring alone would cancel them too, but in the background: the socket would stay in
+    // use for a while after run() returns, and binding its address again could fail.
+    // Returns 0, or -1 with errno set.
+    int finish_io_uring()
+    {
+        if (!uring.make_room(1))
+        {
+            return -1;
+        }
+        io_uring_sqe *const sqe = uring.get_sqe();
+        man7_io_uring::prepare(sqe, IORING_OP_ASYNC_CANCEL, sfd, NULL, 0, CANCEL_TAG);
+        sqe->cancel_flags = IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL;
+
+        bool cancelled = false;
+        while (num_in_flight > 0 || !cancelled)
+        {
+            if (uring.submit_and_wait(1) == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return -1;
+            }
+            uring.for_each_cqe([&](const io_uring_cqe &cqe)
+                               {
+                if (cqe.user_data == CANCEL_TAG)
+                {
+                    cancelled = true;
+                }
+                else if (cqe.user_data != STOP_TAG)
+                {
+                    num_in_flight--;
+                } });
+        }
+        uring.close_ring();
+        errno = 0;
+        return 0;
+    }
+
+    int run_io_uring()
+    {
+        make_slots();
+        for (size_t i = 0; i < slots.size(); i++)
+        {
+            if (!submit_receive(i))
+            {
+                return -1;
+            }
+        }
+
+        if (!uring.make_room(1))
+        {
+            return -1;
+        }
+        io_uring_sqe *const sqe = uring.get_sqe();
+        man7_io_uring::prepare(sqe, IORING_OP_POLL_ADD, stop_fd, NULL, 0, STOP_TAG);
+        sqe->poll32_events = POLLIN;
+
+        for (;;)
+        {
+            if (uring.submit_and_wait(1, opts.idle_timeout_ms) == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                if (errno == ETIME)
+                {
+                    return finish_io_uring();
+                }
+                man7_connection::write_function_results(__func__, "io_uring_enter", -1, errno);
+                return -1;
+            }
+
+            bool stopped = false;
+            bool failed = false;
+            uring.for_each_cqe([&](const io_uring_cqe &cqe)
+                               {
+                if (cqe.user_data == STOP_TAG)
+                {
+                    stopped = true;
+                    return;
+                }
+                const size_t index = static_cast<size_t>(cqe.user_data >> 1);
+                num_in_flight--;
+                if ((cqe.user_data & 1) == REPLY)
+                {
+                    // A failed reply cancels the linked receive, which is submitted again
+                    // when its CQE comes.
+                    return;
+                }
+                if (cqe.res >= 0)
+                {
+                    num_datagrams++;
+                    failed |= !submit_reply(index, static_cast<size_t>(cqe.res));
+                }
+                else
+                {
+                    failed |= !submit_receive(index);
+                } });
+
+            if (stopped)
+            {
+                return finish_io_uring();
+            }
+            if (failed)
+            {
+                return -1;
+            }
+        }
+    }
+};
+
+#endif // SANDBOX_CPP_MAN7_UDP_ECHO
@@ -0,0 +1,302 @@
+#ifndef SANDBOX_MAN7_UDP_ECHO_BENCHMARK
+#define SANDBOX_MAN7_UDP_ECHO_BENCHMARK
+
+// For recvmmsg() and sendmmsg()
+#include "man7_gnu_source.hpp"
+
+#include "man7_udp_echo.hpp"
+#include "man7_udp_echo_pool.hpp"
+#include "man7_sendmmsg_example.hpp"
+#include "cpp_ip_loopback.hpp"
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sched.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <cassert>
+
+class man7_udp_echo_benchmark
+{
+private:
+    // https://en.cppreference.com/w/cpp/chrono/steady_clock
+    // https://en.cppreference.com/w/cpp/chrono/duration/duration_cast
+    template <typename F>
+    static double seconds_taken(F f)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration_cast<std::chrono::duration<double>>(stop - start).count();
+    }
+
+    // https://www.man7.org/linux/man-pages/man2/dup.2.html
+    // The echo server writes a line per setup call, which would get in the way of the table.
+    static void run_quietly(const std::function<void()> &f)
+    {
+        fflush(stdout);
+        const int saved_stdout = dup(STDOUT_FILENO);
+        const int fd = open("/dev/null", O_WRONLY);
+        dup2(fd, STDOUT_FILENO);
+        close(fd);
+
+        f();
+
+        dup2(saved_stdout, STDOUT_FILENO);
+        close(saved_stdout);
+    }
+
+    // A UDP socket bound to any free port on the IPv4 loopback address
+    static int bind_to_loopback(sockaddr_in &addr)
+    {
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        inet_pton(AF_INET, IPv4_LOOPBACK_STRING_LITERAL, &addr.sin_addr);
+
+        const int fd = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        assert(fd != -1);
+        int ret = bind(fd, (const sockaddr *)&addr, sizeof(addr));
+        assert(ret == 0);
+        socklen_t addrlen = sizeof(addr);
+        ret = getsockname(fd, (sockaddr *)&addr, &addrlen);
+        assert(ret == 0);
+        return fd;
+    }
+
+    // https://www.man7.org/linux/man-pages/man2/recvmmsg.2.html ("MSG_WAITFORONE")
+    // Send `num_datagrams` of `datagram_size` bytes to `addr`, `window` at a time (with one
+    // sendmmsg()), and wait for each window to be echoed (with as few recvmmsg() as it
+    // takes), so that the generator makes fewer system calls than the server it loads. A
+    // datagram that is dropped is sent again once a receive has timed out. With `gso`, each
+    // window goes as one message, for the kernel to cut up (see
+    // man7_sendmmsg_example::set_segment_size()). Returns the seconds taken.
+    static double generate_load(const sockaddr_in &addr, int num_datagrams, int window, size_t datagram_size, bool gso = false)
+    {
+        const int fd = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        assert(fd != -1);
+        int ret = connect(fd, (const sockaddr *)&addr, sizeof(addr));
+        assert(ret == 0);
+        timeval timeout = {0, 100000};
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+        // Every datagram of a window is sent from, and received into, the same bytes.
+        std::vector<char> datagram(datagram_size, 'x');
+        iovec iov;
+        iov.iov_base = datagram.data();
+        iov.iov_len = datagram.size();
+        std::vector<mmsghdr> messages(window);
+        memset(messages.data(), 0, messages.size() * sizeof(mmsghdr));
+        for (auto &&message : messages)
+        {
+            message.msg_hdr.msg_iov = &iov;
+            message.msg_hdr.msg_iovlen = 1;
+        }
+
+        // With GSO, the window goes in one piece, and comes back cut up.
+        std::vector<char> segments(window * datagram_size, 'x');
+        iovec segments_iov;
+        segments_iov.iov_base = segments.data();
+        segments_iov.iov_len = segments.size();
+        mmsghdr segmented;
+        memset(&segmented, 0, sizeof(segmented));
+        segmented.msg_hdr.msg_iov = &segments_iov;
+        segmented.msg_hdr.msg_iovlen = 1;
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(uint16_t))];
+        man7_sendmmsg_example::set_segment_size(segmented.msg_hdr, control, static_cast<uint16_t>(datagram_size));
+
+        const double seconds = seconds_taken([&]()
+                                             {
+            for (int sent = 0; sent < num_datagrams; sent += window)
+            {
+                const int sendmmsg_result = gso ? sendmmsg(fd, &segmented, 1, 0) : sendmmsg(fd, messages.data(), window, 0);
+                assert(sendmmsg_result > 0);
+                int num_outstanding = gso ? window : sendmmsg_result;
+                while (num_outstanding > 0)
+                {
+                    const int num_received = recvmmsg(fd, messages.data(), num_outstanding, MSG_WAITFORONE, NULL);
+                    if (num_received <= 0)
+                    {
+                        // Lost: send one more in its place.
+                        num_outstanding -= (send(fd, datagram.data(), datagram.size(), 0) != static_cast<ssize_t>(datagram.size()));
+                        continue;
+                    }
+                    num_outstanding -= num_received;
+                }
+            } });
+        close(fd);
+        return seconds;
+    }
+
+public:
+    // Datagrams echoed by man7_udp_echo with each backend, one at a time and a window at a
+    // time: datagrams per second, and how many system calls the echo server made for each.
+    static void benchmark_backends()
+    {
+        const std::vector<std::pair<man7_udp_echo::backend, std::string>> backends = {
+            {man7_udp_echo::backend::EPOLL, "epoll"},
+            {man7_udp_echo::backend::IO_URING, "io_uring"},
+            {man7_udp_echo::backend::MMSG, "mmsg"}};
+        const int num_datagrams = 200000;
+        const size_t datagram_size = 64;
+
+        std::cout << "backend\twindow\tdatagrams_per_second\tsyscalls_per_datagram\n";
+        for (const int window : {1, 32, 64})
+        {
+            for (const auto &backend : backends)
+            {
+                sockaddr_in addr;
+                const int sfd = bind_to_loopback(addr);
+
+                man7_udp_echo::options o;
+                o.requested_backend = backend.first;
+                double seconds = 0.0;
+                uint64_t num_syscalls = 0, num_echoed = 0;
+                run_quietly([&]()
+                            {
+                    man7_udp_echo echo(sfd, o);
+                    const int start_result = echo.start();
+                    assert(start_result == 0);
+                    std::thread echo_thread([&]()
+                                            { echo.run(); });
+                    seconds = generate_load(addr, num_datagrams, window, datagram_size);
+                    echo.request_stop();
+                    echo_thread.join();
+                    num_syscalls = echo.get_num_syscalls();
+                    num_echoed = echo.get_num_datagrams(); });
+                close(sfd);
+
+                std::cout << backend.second << '\t' << window << '\t' << num_echoed / seconds << '\t' << static_cast<double>(num_syscalls) / num_echoed << '\n';
+            }
+        }
+    }
+
+    // Datagrams of 1200 bytes (as QUIC sends), a window of 32 at a time, echoed one by one
+    // (plain: recvfrom() and sendto()), in batches (mmsg), and in batches of coalesced
+    // datagrams (mmsg with GRO and GSO, loaded by a generator that sends with GSO, which
+    // loopback passes on in one piece). Throughput counts both directions.
+    static void benchmark_segmentation()
+    {
+        struct mode
+        {
+            std::string name;
+            man7_udp_echo::backend backend;
+            bool segmented;
+        };
+        const std::vector<mode> modes = {
+            {"plain", man7_udp_echo::backend::EPOLL, false},
+            {"mmsg", man7_udp_echo::backend::MMSG, false},
+            {"mmsg+gro+gso", man7_udp_echo::backend::MMSG, true}};
+        const int num_datagrams = 200000;
+        const int window = 32;
+        const size_t datagram_size = 1200;
+
+        std::cout << "mode\tdatagram_size\tdatagrams_per_second\tgbit_per_second\tsyscalls_per_datagram\n";
+        for (const auto &m : modes)
+        {
+            sockaddr_in addr;
+            const int sfd = bind_to_loopback(addr);
+
+            man7_udp_echo::options o;
+            o.requested_backend = m.backend;
+            o.gro = m.segmented;
+            o.gso = m.segmented;
+            double seconds = 0.0;
+            uint64_t num_syscalls = 0, num_echoed = 0;
+            run_quietly([&]()
+                        {
+                man7_udp_echo echo(sfd, o);
+                const int start_result = echo.start();
+                assert(start_result == 0);
+                std::thread echo_thread([&]()
+                                        { echo.run(); });
+                seconds = generate_load(addr, num_datagrams, window, datagram_size, m.segmented);
+                echo.request_stop();
+                echo_thread.join();
+                num_syscalls = echo.get_num_syscalls();
+                num_echoed = echo.get_num_datagrams(); });
+            close(sfd);
+
+            std::cout << m.name << '\t' << datagram_size << '\t' << num_echoed / seconds << '\t' << 2.0 * num_echoed * datagram_size * 8 / seconds / 1e9 << '\t' << static_cast<double>(num_syscalls) / num_echoed << '\n';
+        }
+    }
+
+    // Datagrams echoed by a man7_udp_echo_pool of 1, 2, 4, ... workers (up to one per CPU,
+    // and at least up to 4), loaded by as many generators as the most workers, each from a
+    // port of its own, so that the hash spreads them. On loopback, a generator's datagrams
+    // are received on its own CPU, so the packets per second can only grow with the workers
+    // as far as there are CPUs for both: with a single CPU, the table stays flat. The
+    // busiest worker's share shows how evenly the kernel spread the load.
+    static void benchmark_workers()
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        const int num_cpus = (sched_getaffinity(0, sizeof(set), &set) == 0) ? CPU_COUNT(&set) : 1;
+        const int max_num_workers = (num_cpus > 4) ? num_cpus : 4;
+        const int num_generators = max_num_workers;
+        const int num_datagrams_per_generator = 50000;
+        const int window = 32;
+        const size_t datagram_size = 64;
+
+        std::cout << "cpus\tworkers\tdatagrams_per_second\tbusiest_worker_share\n";
+        for (int num_workers = 1; num_workers <= max_num_workers; num_workers *= 2)
+        {
+            sockaddr_in addr;
+            memset(&addr, 0, sizeof(addr));
+            addr.sin_family = AF_INET;
+            inet_pton(AF_INET, IPv4_LOOPBACK_STRING_LITERAL, &addr.sin_addr);
+
+            man7_udp_echo_pool::options o;
+            o.echo_options.requested_backend = man7_udp_echo::backend::MMSG;
+            o.num_workers = static_cast<unsigned>(num_workers);
+            double seconds = 0.0;
+            std::vector<uint64_t> num_echoed(num_workers);
+            run_quietly([&]()
+                        {
+                man7_udp_echo_pool pool(o);
+                const int start_result = pool.start((const sockaddr *)&addr, sizeof(addr));
+                assert(start_result == 0);
+                addr.sin_port = htons(pool.get_port());
+                std::thread pool_thread([&]()
+                                        { pool.run(); });
+                seconds = seconds_taken([&]()
+                                        {
+                    std::vector<std::thread> generators;
+                    for (int i = 0; i < num_generators; i++)
+                    {
+                        generators.emplace_back([&]()
+                                                { generate_load(addr, num_datagrams_per_generator, window, datagram_size); });
+                    }
+                    for (auto &&generator : generators)
+                    {
+                        generator.join();
+                    } });
+                pool.request_stop();
+                pool_thread.join();
+                for (int i = 0; i < num_workers; i++)
+                {
+                    num_echoed[i] = pool.get_num_datagrams(i);
+                } });
+
+            uint64_t total = 0;
+            for (const uint64_t n : num_echoed)
+            {
+                total += n;
+            }
+            const uint64_t busiest = *std::max_element(num_echoed.begin(), num_echoed.end());
+            std::cout << num_cpus << '\t' << num_workers << '\t' << total / seconds << '\t' << static_cast<double>(busiest) / total << '\n';
+        }
+    }
+};
+
+#endif // SANDBOX_MAN7_UDP_ECHO_BENCHMARK
@@ -0,0 +1,9 @@
+#include "man7_udp_echo_benchmark.hpp"
+
+int main()
+{
+    man7_udp_echo_benchmark::benchmark_backends();
+    man7_udp_echo_benchmark::benchmark_segmentation();
+    man7_udp_echo_benchmark::benchmark_workers();
+    return 0;
+}
@@ -0,0 +1,344 @@
+#ifndef SANDBOX_CPP_MAN7_UDP_ECHO_POOL
+#define SANDBOX_CPP_MAN7_UDP_ECHO_POOL
+
+// For pthread_setaffinity_np() and CPU_SET()
+#include "man7_gnu_source.hpp"
+
+#include "man7_udp_echo.hpp"
+#include "man7_connection.hpp"
+#include "cpp_join_guard.hpp"
+
+#include <linux/filter.h>
+#include <netinet/in.h>
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// man7_udp_echo on `num_workers` threads at once, each with its own UDP socket bound to
+// the same address (SO_REUSEPORT) and each pinned to a CPU of its own (as far as there are
+// enough of them). The kernel picks a socket for each datagram, by a hash of its addresses
+// and ports unless told otherwise (see steering), so the workers share nothing and take no
+// locks. A worker that has been idle for `idle_timeout_ms` closes its socket and ends, and
+// the kernel then spreads the datagrams among the sockets that are left (but see
+// steering::CPU_BPF).
+class man7_udp_echo_pool final
+{
+private:
+    // https://www.man7.org/linux/man-pages/man7/socket.7.html ("SO_REUSEPORT", "SO_INCOMING_CPU", "SO_ATTACH_REUSEPORT_CBPF")
+    // https://www.kernel.org/doc/html/latest/networking/filter.html
+    // https://www.man7.org/linux/man-pages/man3/pthread_setaffinity_np.3.html
+
+public:
+    // How the kernel picks the socket for a datagram
+    enum class steering
+    {
+        // By a hash of the datagram's addresses and ports, so that each peer sticks to
+        // one worker
+        HASH,
+
+        // The socket of the worker pinned to the CPU that received the datagram, if there
+        // is one (SO_INCOMING_CPU), and otherwise by hash
+        INCOMING_CPU,
+
+        // The socket at index (CPU that received the datagram) % num_workers, by a classic
+        // BPF program on the group (SO_ATTACH_REUSEPORT_CBPF). Worker i is pinned to the
+        // i-th CPU that the process may run on, so this keeps a datagram on its CPU when
+        // those are numbered from 0 without gaps.
+        //
+        // Only until the first worker ends, though. The index is a position in the group,
+        // and when a socket leaves it, the kernel moves the last socket into its place: from
+        // then on, datagrams go to the wrong workers, and an index past the end of the
+        // smaller group falls back to the hash. So with an `idle_timeout_ms`, the workers
+        // should end together, or the steering not matter by then.
+        CPU_BPF,
+    };
+
+    class options final
+    {
+    public:
+        // For every worker
+        man7_udp_echo::options echo_options;
+
+        // 0 means one per CPU that this process may run on.
+        unsigned num_workers = 0;
+
+        bool pin_to_cpus = true;
+
+        steering steer = steering::HASH;
+    };
+
+private:
+    options opts;
+    std::vector<int> sfds;
+    std::vector<std::unique_ptr<man7_udp_echo>> echoes;
+    int port = -1;
+
+    // The CPUs that this process may run on, in order
+    std::vector<int> cpus;
+
+public:
+    explicit man7_udp_echo_pool(const options &the_options) : opts(the_options)
+    {
+    }
+
+    man7_udp_echo_pool(const man7_udp_echo_pool &) = delete;
+    man7_udp_echo_pool &operator=(const man7_udp_echo_pool &) = delete;
+
+    ~man7_udp_echo_pool()
+    {
+        close_sockets();
+    }
+
+    // Bind a socket per worker to `addr`. The first one picks the port, if it is 0, and the
+    // others bind to the same. Returns 0, or -1 with errno set.
+    int start(const sockaddr *addr, socklen_t addrlen)
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(0, sizeof(set), &set) == 0)
+        {
+            for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+            {
+                if (CPU_ISSET(cpu, &set))
+                {
+                    cpus.push_back(cpu);
+                }
+            }
+        }
+        if (opts.num_workers == 0)
+        {
+            opts.num_workers = cpus.empty() ? 1 : static_cast<unsigned>(cpus.size());
+        }
+
+        sockaddr_storage bound;
+        memset(&bound, 0, sizeof(bound));
+        memcpy(&bound, addr, addrlen);
+        for (unsigned i = 0; i < opts.num_workers; i++)
+        {
+            if (open_socket(i, (const sockaddr *)&bound, addrlen) == -1 || (i == 0 && !after_first_socket(bound, addrlen)))
+            {
+                const int errnum = errno;
+                close_sockets();
+                errno = errnum;
+                return -1;
+            }
+        }
+
+        for (const int sfd : sfds)
+        {
+            echoes.emplace_back(new man7_udp_echo(sfd, opts.echo_options));
+            if (echoes.back()->start() == -1)
+            {
+                const int errnum = errno;
+                echoes.clear();
+                close_sockets();
+                errno = errnum;
+                return -1;
+            }
+        }
+        return 0;
+    }
+
+    // Returns -1 if start() has not succeeded.
+    int get_port() const
+    {
+        return echoes.empty() ? -1 : port;
+    }
+
+    size_t get_num_workers() const
+    {
+        return echoes.size();
+    }
+
+    // The datagrams echoed by worker `worker`. Only meaningful once run() has returned.
+    uint64_t get_num_datagrams(size_t worker) const
+    {
+        return echoes[worker]->get_num_datagrams();
+    }
+
+    // The system calls that worker `worker` made for I/O. Only meaningful once run() has
+    // returned.
+    uint64_t get_num_syscalls(size_t worker) const
+    {
+        return echoes[worker]->get_num_syscalls();
+    }
+
+    // Make run() return. Safe to call from another thread, or from a signal handler.
+    void request_stop()
+    {
+        for (auto &&echo : echoes)
+        {
+            echo->request_stop();
+        }
+    }
+
+private:
+    int cpu_of(size_t worker) const
+    {
+        return cpus.empty() ? -1 : cpus[worker % cpus.size()];
+    }
+
+    int open_socket(size_t worker, const sockaddr *addr, socklen_t addrlen)
+    {
+        int errnum = 0;
+
+        errno = 0;
+        const int sfd = socket(addr->sa_family, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        errnum = errno;
+        man7_connection::write_function_results(__func__, "socket", sfd, errnum);
+        if (sfd == -1)
+        {
+            return -1;
+        }
+        sfds.push_back(sfd);
+
+        const int yes = 1;
+        errno = 0;
+        int ret = setsockopt(sfd, SOL_SOCKET, SO_REUSEPORT, &yes, sizeof(yes));
+        errnum = errno;
+        man7_connection::write_function_results(__func__, "setsockopt", ret, errnum);
+        if (ret == -1)
+        {
+            return -1;
+        }
+
+        if (opts.steer == steering::INCOMING_CPU && cpu_of(worker) != -1)
+        {
+            const int cpu = cpu_of(worker);
+            errno = 0;
+            ret = setsockopt(sfd, SOL_SOCKET, SO_INCOMING_CPU, &cpu, sizeof(cpu));
+            errnum = errno;
+            man7_connection::write_function_results(__func__, "setsockopt", ret, errnum);
+            if (ret == -1)
+            {
+                return -1;
+            }
+        }
+
+        errno = 0;
+        ret = bind(sfd, addr, addrlen);
+        errnum = errno;
+        man7_connection::write_function_results(__func__, "bind", ret, errnum);
+        return ret;
+    }
+
+    // Take the port that the first socket was given, and attach the steering program to
+    // the group that it started.
+    bool after_first_socket(sockaddr_storage &bound, socklen_t addrlen)
+    {
+        int errnum = 0;
+
+        socklen_t bound_len = addrlen;
+        errno = 0;
+        int ret = getsockname(sfds.front(), (sockaddr *)&bound, &bound_len);
+        errnum = errno;
+        man7_connection::write_function_results(__func__, "getsockname", ret, errnum);
+        if (ret == -1)
+        {
+            return false;
+        }
+        port = ntohs((bound.ss_family == AF_INET) ? ((const sockaddr_in *)&bound)->sin_port : ((const sockaddr_in6 *)&bound)->sin6_port);
+
+        if (opts.steer == steering::CPU_BPF)
+        {
+            sock_filter code[] = {
+                {BPF_LD | BPF_W | BPF_ABS, 0, 0, static_cast<uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+                {BPF_ALU | BPF_MOD | BPF_K, 0, 0, opts.num_workers},
+                {BPF_RET | BPF_A, 0, 0, 0},
+            };
+            sock_fprog program;
+            program.len = sizeof(code) / sizeof(code[0]);
+            program.filter = code;
+
+            errno = 0;
+            ret = setsockopt(sfds.front(), SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program, sizeof(program));
+            errnum = errno;
+            man7_connection::write_function_results(__func__, "setsockopt", ret, errnum);
+            if (ret == -1)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void close_sockets()
+    {
+        for (auto &&sfd : sfds)
+        {
+            if (sfd != -1)
+            {
+                close(sfd);
+                sfd = -1;
+            }
+        }
+    }
+
+    void work(size_t worker, int &run_result)
+    {
+        if (opts.pin_to_cpus && cpu_of(worker) != -1)
+        {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu_of(worker), &set);
+            const int errnum = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+            if (errnum != 0)
+            {
+                man7_connection::write_function_results(__func__, "pthread_setaffinity_np", -1, errnum);
+            }
+        }
+        run_result = echoes[worker]->run();
+
+        // Leave the group, so that the kernel stops picking this socket. (This moves the last
+        // socket of the group into its place, which steering::CPU_BPF does not follow.)
+        close(sfds[worker]);
+        sfds[worker] = -1;
+    }
+
+public:
+    // Run every worker until request_stop() is called, or until each has been idle for
+    // `idle_timeout_ms`. Returns 0, or -1 if any worker's run() failed. May throw
+    // std::system_error, if a thread cannot be started, once the workers that did start
+    // have stopped.
+    int run()
+    {
+        std::vector<int> run_results(echoes.size(), -1);
+        std::vector<std::thread> threads;
+        cpp_join_guard join_guard(threads);
+        try
+        {
+            for (size_t i = 0; i < echoes.size(); i++)
+            {
+                threads.emplace_back(&man7_udp_echo_pool::work, this, i, std::ref(run_results[i]));
+            }
+        }
+        catch (...)
+        {
+            // The workers that started run until they are stopped, and join_guard waits
+            // for them.
+            request_stop();
+            throw;
+        }
+        join_guard.join();
+
+        for (const int run_result : run_results)
+        {
+            if (run_result != 0)
+            {
+                return -1;
+            }
+        }
+        errno = 0;
+        return 0;
+    }
+};
+
+#endif // SANDBOX_CPP_MAN7_UDP_ECHO_POOL